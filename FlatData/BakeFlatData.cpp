@@ -0,0 +1,182 @@
+#include <iostream>
+#include <cmath>
+#include <vector>
+#include <algorithm>
+#include <BakeFlatData.h>
+#include <FlatDataLoader.h>
+#include <FlatDataPose.h>
+#include <FlatDataSkinning.h>
+#include <FlatDataWriter.h>
+#include <WorkStealingPool.h>
+
+// Frames skinned by one pool task
+static const int bake_frames_per_task = 4;
+
+// Skinned frames of one clip before quantization
+struct BakeClipFrames
+{
+	int start_time, end_time;
+	std::vector<float> points;
+};
+
+// Copies the topology of mesh_in, leaving out the region bone weights baking made unneeded
+static flatbuffers::Offset<CreatureFlatData::mesh>
+CopyBakedMesh(flatbuffers::FlatBufferBuilder& fbb, const CreatureFlatData::mesh * mesh_in)
+{
+	std::vector<flatbuffers::Offset<CreatureFlatData::meshRegion> > regions;
+	for (flatbuffers::uoffset_t r = 0; r < mesh_in->regions()->size(); r++)
+	{
+		auto cur_region = mesh_in->regions()->Get(r);
+		auto write_name = cur_region->name() ? fbb.CreateString(cur_region->name()->c_str()) : 0;
+		regions.push_back(CreatureFlatData::CreatemeshRegion(fbb, write_name,
+			cur_region->start_pt_index(), cur_region->end_pt_index(),
+			cur_region->start_index(), cur_region->end_index(), cur_region->id()));
+	}
+
+	auto write_points = fbb.CreateVector(mesh_in->points()->data(), mesh_in->points()->size());
+	auto write_uvs = mesh_in->uvs() ? fbb.CreateVector(mesh_in->uvs()->data(), mesh_in->uvs()->size()) : 0;
+	auto write_indices = mesh_in->indices() ? fbb.CreateVector(mesh_in->indices()->data(), mesh_in->indices()->size()) : 0;
+	auto write_regions = fbb.CreateVector(regions);
+	auto write_regions_by_name = mesh_in->regions_by_name() ?
+		fbb.CreateVector(mesh_in->regions_by_name()->data(), mesh_in->regions_by_name()->size()) : 0;
+
+	return CreatureFlatData::Createmesh(fbb, write_points, write_uvs, write_indices,
+		write_regions, write_regions_by_name);
+}
+
+// Quantizes one clip's frames against their x and y bounds, keeping the largest error in max_error_io
+static flatbuffers::Offset<CreatureFlatData::bakedClip>
+WriteBakedClip(flatbuffers::FlatBufferBuilder& fbb, const char * clip_name,
+	const BakeClipFrames& frames_in, float& max_error_io)
+{
+	float bounds_min[2] = { 0.0f, 0.0f }, bounds_max[2] = { 0.0f, 0.0f };
+	for (size_t i = 0; i < frames_in.points.size(); i++)
+	{
+		float cur_value = frames_in.points[i];
+		if (i < 2)
+		{
+			bounds_min[i] = bounds_max[i] = cur_value;
+		}
+
+		bounds_min[i & 1] = std::min(bounds_min[i & 1], cur_value);
+		bounds_max[i & 1] = std::max(bounds_max[i & 1], cur_value);
+	}
+
+	float bounds_extent[2] = { bounds_max[0] - bounds_min[0], bounds_max[1] - bounds_min[1] };
+	std::vector<uint16_t> points_q(frames_in.points.size(), 0);
+	for (size_t i = 0; i < frames_in.points.size(); i++)
+	{
+		float cur_extent = bounds_extent[i & 1];
+		if (cur_extent <= 0.0f)
+		{
+			continue;
+		}
+
+		float cur_value = frames_in.points[i];
+		float scaled_value = (cur_value - bounds_min[i & 1]) / cur_extent * 65535.0f;
+		points_q[i] = (uint16_t)std::min(std::max(std::floor(scaled_value + 0.5f), 0.0f), 65535.0f);
+
+		float read_value = bounds_min[i & 1] + (float)points_q[i] * cur_extent / 65535.0f;
+		max_error_io = std::max(max_error_io, std::fabs(read_value - cur_value));
+	}
+
+	auto write_name = fbb.CreateString(clip_name);
+	auto write_bounds_min = fbb.CreateVector(bounds_min, 2);
+	auto write_bounds_extent = fbb.CreateVector(bounds_extent, 2);
+	auto write_points_q = fbb.CreateVector(points_q);
+
+	return CreatureFlatData::CreatebakedClip(fbb, write_name, frames_in.start_time, frames_in.end_time,
+		write_bounds_min, write_bounds_extent, write_points_q);
+}
+
+bool BakeFlatDataFile(const std::string& flat_filename_in,
+	const std::string& baked_filename_out,
+	int thread_count,
+	bool verbose)
+{
+	FlatDataLoader file_loader;
+	if (!file_loader.Open(flat_filename_in, true))
+	{
+		return false;
+	}
+
+	auto root_data = file_loader.GetRootData();
+	FlatDataSkinMesh skin_mesh;
+	if (!skin_mesh.Init(root_data))
+	{
+		std::cerr << "Error: No skinnable mesh to bake in: " << flat_filename_in << std::endl;
+		return false;
+	}
+
+	FlatDataPoseSampler sampler(root_data);
+	int point_count = skin_mesh.GetPointCount();
+	int clip_count = sampler.GetClipCount();
+
+	flatbuffers::FlatBufferBuilder fbb;
+	auto mesh_loc = CopyBakedMesh(fbb, root_data->dataMesh());
+
+	// Clips are baked one at a time, each quantized into the builder before the next is
+	// skinned, so only one clip's float frames are held. Its frames are independent and
+	// spread over the pool.
+	float max_error = 0.0f;
+	size_t baked_frame_count = 0;
+	std::vector<flatbuffers::Offset<CreatureFlatData::bakedClip> > baked_clips;
+	WorkStealingPool bake_pool(thread_count);
+	BakeClipFrames cur_frames;
+	for (int c = 0; c < clip_count; c++)
+	{
+		cur_frames.points.clear();
+		if (!sampler.GetClipTimeRange(c, cur_frames.start_time, cur_frames.end_time))
+		{
+			cur_frames.start_time = cur_frames.end_time = 0;
+		}
+		else
+		{
+			int frame_count = cur_frames.end_time - cur_frames.start_time + 1;
+			cur_frames.points.assign((size_t)frame_count * point_count * 2, 0.0f);
+			for (int task_start = 0; task_start < frame_count; task_start += bake_frames_per_task)
+			{
+				int task_end = std::min(task_start + bake_frames_per_task, frame_count);
+				bake_pool.Submit([&, c, task_start, task_end]() {
+					FlatDataPose task_pose;
+					task_pose.Init(root_data);
+					for (int f = task_start; f < task_end; f++)
+					{
+						sampler.Sample(c, (float)(cur_frames.start_time + f), task_pose);
+						skin_mesh.Skin(task_pose, cur_frames.points.data() + (size_t)f * point_count * 2);
+					}
+				});
+			}
+
+			bake_pool.Wait();
+			baked_frame_count += (size_t)frame_count;
+		}
+
+		auto cur_name = root_data->dataAnimation()->clips()->Get(c)->name();
+		baked_clips.push_back(WriteBakedClip(fbb, cur_name ? cur_name->c_str() : "", cur_frames, max_error));
+	}
+
+	auto clips_by_name = root_data->dataAnimation()->clips_by_name();
+	auto write_clips = fbb.CreateVector(baked_clips);
+	auto write_clips_by_name = clips_by_name ? fbb.CreateVector(clips_by_name->data(), clips_by_name->size()) : 0;
+	auto baked_loc = CreatureFlatData::CreatebakedAnimation(fbb, point_count, write_clips, write_clips_by_name);
+
+	auto root_loc = CreatureFlatData::CreaterootData(fbb, mesh_loc, 0, 0, 0, 0, root_data->version(), baked_loc);
+	CreatureFlatData::FinishrootDataBuffer(fbb, root_loc);
+
+	if (!WriteFlatDataFile(fbb, baked_filename_out, verbose))
+	{
+		return false;
+	}
+
+	if (verbose)
+	{
+		std::cout << "Baked " << clip_count << " clips, " << baked_frame_count << " frames of " << point_count
+			<< " points (" << point_count * 4 << " bytes per frame) to " << fbb.GetSize()
+			<< " bytes, against " << file_loader.GetSize() << " bytes skeletal ("
+			<< (file_loader.GetSize() > 0 ? (double)fbb.GetSize() / (double)file_loader.GetSize() : 0.0)
+			<< "x). Largest quantization error: " << max_error << std::endl;
+	}
+
+	return true;
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+#include <string>
+
+// Evaluates every frame of every clip of the Creature FlatData file flat_filename_in:
+// samples the bones and displacements and skins the mesh with its weights, regions
+// skinned as their use_dq flags ask. Writes baked_filename_out with the mesh topology
+// and a bakedAnimation of the frames quantized to 16 bits, and no skeleton or skeletal
+// animation, so playback only blends two stored frames. UV swaps, opacities and anchor
+// points are not baked. Frames are skinned on thread_count threads, 0 for one per core.
+bool BakeFlatDataFile(const std::string& flat_filename_in,
+	const std::string& baked_filename_out,
+	int thread_count = 0,
+	bool verbose = true);
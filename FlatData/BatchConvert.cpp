@@ -0,0 +1,319 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <cstdio>
+#include <algorithm>
+#include <chrono>
+#include <mutex>
+#include <condition_variable>
+#include <memory>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <dirent.h>
+#endif
+#include <BatchConvert.h>
+#include <WorkStealingPool.h>
+#include <ConvertCache.h>
+
+// Peak memory of a conversion as a multiple of its input size, measured on a 220 MB
+// character: the DOM holds about 5x the JSON, parsing in place adds the read buffer
+// and the streaming engine holds little more than the output
+static double
+GetConvertMemoryFactor(const ConvertFlatDataOptions& options)
+{
+	if (options.stream_parse)
+	{
+		return 1.5;
+	}
+
+	return options.parse_insitu ? 7.0 : 5.0;
+}
+
+static long long
+GetFileSize(const std::string& filename_in)
+{
+	FILE* fp = fopen(filename_in.c_str(), "rb");
+	if (!fp)
+	{
+		return -1;
+	}
+
+	fseek(fp, 0, SEEK_END);
+	long long file_size = (long long)ftell(fp);
+	fclose(fp);
+
+	return file_size;
+}
+
+static std::string
+GetFlatFilename(const std::string& json_filename, const std::string& output_dir)
+{
+	std::string base_name = json_filename;
+	if (!output_dir.empty())
+	{
+		size_t slash_pos = base_name.find_last_of("/\\");
+		if (slash_pos != std::string::npos)
+		{
+			base_name = base_name.substr(slash_pos + 1);
+		}
+
+		base_name = output_dir + "/" + base_name;
+	}
+
+	size_t ext_pos = base_name.rfind(".json");
+	if ((ext_pos != std::string::npos) && (ext_pos + 5 == base_name.size()))
+	{
+		base_name.erase(ext_pos);
+	}
+
+	return base_name + ".fbb";
+}
+
+// Limits the estimated memory of the conversions running at the same time
+class MemoryBudget
+{
+public:
+	MemoryBudget(long long limit_bytes_in)
+		: limit_bytes(limit_bytes_in), used_bytes(0)
+	{
+	}
+
+	void Acquire(long long bytes)
+	{
+		std::unique_lock<std::mutex> budget_guard(lock);
+		budget_free.wait(budget_guard, [&]() {
+			return (limit_bytes <= 0) || (used_bytes == 0) || (used_bytes + bytes <= limit_bytes);
+		});
+
+		used_bytes += bytes;
+	}
+
+	void Release(long long bytes)
+	{
+		{
+			std::lock_guard<std::mutex> budget_guard(lock);
+			used_bytes -= bytes;
+		}
+
+		budget_free.notify_all();
+	}
+
+private:
+	long long limit_bytes, used_bytes;
+	std::mutex lock;
+	std::condition_variable budget_free;
+};
+
+bool ReadBatchManifest(const std::string& manifest_filename,
+	const std::string& output_dir,
+	std::vector<BatchConvertEntry>& entries_out)
+{
+	std::ifstream manifest_file(manifest_filename.c_str());
+	if (!manifest_file)
+	{
+		std::cerr << "Error: Could not open Batch Manifest: " << manifest_filename << std::endl;
+		return false;
+	}
+
+	std::string cur_line;
+	while (std::getline(manifest_file, cur_line))
+	{
+		std::istringstream line_stream(cur_line);
+		BatchConvertEntry new_entry;
+		if (!(line_stream >> new_entry.json_filename) || (new_entry.json_filename[0] == '#'))
+		{
+			continue;
+		}
+
+		if (!(line_stream >> new_entry.flat_filename))
+		{
+			new_entry.flat_filename = GetFlatFilename(new_entry.json_filename, output_dir);
+		}
+
+		entries_out.push_back(new_entry);
+	}
+
+	return true;
+}
+
+bool ReadBatchDirectory(const std::string& input_dir,
+	const std::string& output_dir,
+	std::vector<BatchConvertEntry>& entries_out)
+{
+	std::vector<std::string> json_names;
+
+#ifdef _WIN32
+	WIN32_FIND_DATAA find_data;
+	HANDLE find_handle = FindFirstFileA((input_dir + "\\*.json").c_str(), &find_data);
+	if (find_handle == INVALID_HANDLE_VALUE)
+	{
+		std::cerr << "Error: Could not read Input Directory: " << input_dir << std::endl;
+		return false;
+	}
+
+	do
+	{
+		if (!(find_data.dwFileAttributes & FILE_ATTRIBUTE_DIRECTORY))
+		{
+			json_names.push_back(find_data.cFileName);
+		}
+	} while (FindNextFileA(find_handle, &find_data));
+
+	FindClose(find_handle);
+#else
+	DIR * read_dir = opendir(input_dir.c_str());
+	if (!read_dir)
+	{
+		std::cerr << "Error: Could not read Input Directory: " << input_dir << std::endl;
+		return false;
+	}
+
+	while (dirent * cur_entry = readdir(read_dir))
+	{
+		std::string cur_name(cur_entry->d_name);
+		if ((cur_name.size() > 5) && (cur_name.compare(cur_name.size() - 5, 5, ".json") == 0))
+		{
+			json_names.push_back(cur_name);
+		}
+	}
+
+	closedir(read_dir);
+#endif
+
+	// Directory order differs between file systems
+	std::sort(json_names.begin(), json_names.end());
+
+	for (auto& cur_name : json_names)
+	{
+		BatchConvertEntry new_entry;
+		new_entry.json_filename = input_dir + "/" + cur_name;
+		new_entry.flat_filename = GetFlatFilename(new_entry.json_filename,
+			output_dir.empty() ? input_dir : output_dir);
+		entries_out.push_back(new_entry);
+	}
+
+	return true;
+}
+
+bool BatchConvertToFlatData(const std::vector<BatchConvertEntry>& entries,
+	const BatchConvertOptions& options)
+{
+	// Each conversion is one task of the batch pool, so clips are not converted in parallel
+	// and the per file reports are replaced by one line per file
+	ConvertFlatDataOptions convert_options = options.convert_options;
+	convert_options.parallel_clips = false;
+	convert_options.verbose = false;
+
+	struct BatchResult
+	{
+		long long json_size;
+		long long flat_size;
+		double seconds;
+		bool success;
+		bool cache_hit;
+	};
+
+	std::vector<BatchResult> results(entries.size());
+	std::vector<size_t> convert_order(entries.size());
+	for (size_t i = 0; i < entries.size(); i++)
+	{
+		results[i].json_size = GetFileSize(entries[i].json_filename);
+		results[i].flat_size = 0;
+		results[i].seconds = 0.0;
+		results[i].success = false;
+		results[i].cache_hit = false;
+		convert_order[i] = i;
+	}
+
+	// Workers run the newest task of their queue first, so submitting the smallest inputs
+	// first starts the largest ones early and a big file does not hold up the end of the batch
+	std::stable_sort(convert_order.begin(), convert_order.end(), [&](size_t a, size_t b) {
+		return results[a].json_size < results[b].json_size;
+	});
+
+	double memory_factor = GetConvertMemoryFactor(convert_options);
+	MemoryBudget memory_budget((long long)options.memory_limit_mb * 1024 * 1024);
+	std::mutex print_lock;
+
+	std::unique_ptr<ConvertCache> convert_cache;
+	if (!options.cache_dir.empty())
+	{
+		convert_cache.reset(new ConvertCache(options.cache_dir));
+	}
+
+	auto batch_start = std::chrono::steady_clock::now();
+	int thread_count = 0;
+	{
+		WorkStealingPool batch_pool(options.thread_count);
+		thread_count = batch_pool.GetThreadCount();
+
+		for (size_t cur_index : convert_order)
+		{
+			batch_pool.Submit([&, cur_index]() {
+				const BatchConvertEntry& cur_entry = entries[cur_index];
+				BatchResult& cur_result = results[cur_index];
+
+				// A cache hit only copies, but whether it hits is not known until the input is hashed
+				long long memory_estimate = (long long)(std::max(cur_result.json_size, 0LL) * memory_factor);
+				memory_budget.Acquire(memory_estimate);
+
+				auto convert_start = std::chrono::steady_clock::now();
+				if (convert_cache)
+				{
+					cur_result.success = convert_cache->Convert(cur_entry.json_filename, cur_entry.flat_filename,
+						convert_options, cur_result.cache_hit);
+				}
+				else
+				{
+					cur_result.success = ConvertToFlatData(cur_entry.json_filename, cur_entry.flat_filename, convert_options);
+				}
+				auto convert_end = std::chrono::steady_clock::now();
+
+				memory_budget.Release(memory_estimate);
+
+				cur_result.seconds = std::chrono::duration<double>(convert_end - convert_start).count();
+				cur_result.flat_size = cur_result.success ? GetFileSize(cur_entry.flat_filename) : 0;
+
+				std::lock_guard<std::mutex> print_guard(print_lock);
+				if (cur_result.success)
+				{
+					std::cout << (cur_result.cache_hit ? "Cached " : "Converted ") << cur_entry.json_filename
+						<< " to " << cur_entry.flat_filename << " (" << cur_result.flat_size << " bytes) in "
+						<< cur_result.seconds << " s" << std::endl;
+				}
+				else
+				{
+					std::cerr << "Error: Failed to convert " << cur_entry.json_filename << std::endl;
+				}
+			});
+		}
+
+		batch_pool.Wait();
+	}
+	auto batch_end = std::chrono::steady_clock::now();
+
+	int success_count = 0;
+	long long total_json_size = 0, total_flat_size = 0;
+	double total_convert_seconds = 0.0;
+	for (auto& cur_result : results)
+	{
+		success_count += cur_result.success ? 1 : 0;
+		total_json_size += std::max(cur_result.json_size, 0LL);
+		total_flat_size += cur_result.flat_size;
+		total_convert_seconds += cur_result.seconds;
+	}
+
+	double batch_seconds = std::chrono::duration<double>(batch_end - batch_start).count();
+	std::cout << "Batch converted " << success_count << " of " << entries.size() << " files on "
+		<< thread_count << " threads in " << batch_seconds << " s (" << total_convert_seconds
+		<< " s of conversions), " << total_json_size << " JSON bytes to " << total_flat_size
+		<< " FlatData bytes" << std::endl;
+
+	if (convert_cache)
+	{
+		convert_cache->PrintStats();
+	}
+
+	return success_count == (int)entries.size();
+}
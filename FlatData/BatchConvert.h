@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <ConvertFlatData.h>
+
+// One input Creature JSON and the Creature FlatData Binary file it converts to
+struct BatchConvertEntry
+{
+	std::string json_filename;
+	std::string flat_filename;
+};
+
+// Options controlling a batch of conversions
+struct BatchConvertOptions
+{
+	BatchConvertOptions()
+		: thread_count(0),
+		memory_limit_mb(0)
+	{
+	}
+
+	// Conversions run at the same time, 0 for one per hardware core
+	int thread_count;
+
+	// Caps the estimated memory of the conversions running at the same time,
+	// 0 for no cap. A conversion that alone exceeds the cap still runs, by itself.
+	int memory_limit_mb;
+
+	// If not empty, unchanged inputs are copied from the conversion cache in this directory
+	std::string cache_dir;
+
+	// Options for each conversion
+	ConvertFlatDataOptions convert_options;
+};
+
+// Reads a batch manifest. Each line holds an input Creature JSON and optionally the
+// output FlatData file, separated by whitespace. Blank lines and lines starting
+// with # are skipped. Outputs left out are named after their input with an .fbb
+// extension, inside output_dir if one is given.
+bool ReadBatchManifest(const std::string& manifest_filename,
+	const std::string& output_dir,
+	std::vector<BatchConvertEntry>& entries_out);
+
+// Adds every .json file of input_dir, converting to the same name with an .fbb
+// extension inside output_dir, or inside input_dir if output_dir is empty
+bool ReadBatchDirectory(const std::string& input_dir,
+	const std::string& output_dir,
+	std::vector<BatchConvertEntry>& entries_out);
+
+// Converts every entry on a work stealing pool, printing the time of each
+// conversion and the totals. Returns true if every conversion succeeded.
+bool BatchConvertToFlatData(const std::vector<BatchConvertEntry>& entries,
+	const BatchConvertOptions& options);
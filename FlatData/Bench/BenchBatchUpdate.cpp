@@ -0,0 +1,191 @@
+//
+//  BenchBatchUpdate.cpp
+//  CreatureFlatData
+//
+//  Times FlatDataBatchUpdater sampling and skinning a crowd of characters sharing one
+//  Creature FlatData file, each playing a clip at its own time, with 1 to N threads.
+//  Every update advances the instances by -tick frames. Reports instances per second
+//  and the speedup over one thread, and with -cache the pose cache hit rate. Thread counts
+//  past the hardware threads are flagged, their speedup says nothing about scaling.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -pthread -mavx2 -mfma -I. Bench/BenchBatchUpdate.cpp FlatDataBatchUpdate.cpp FlatDataPoseCache.cpp FlatDataSkinning.cpp FlatDataPose.cpp FlatDataLoader.cpp WorkStealingPool.cpp -o BenchBatchUpdate
+//
+
+#include <iostream>
+#include <cstdlib>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <thread>
+#include <memory>
+#include <FlatDataLoader.h>
+#include <FlatDataBatchUpdate.h>
+#include <FlatDataPoseCache.h>
+
+// Moves every instance tick_frames along its clip, wrapping at the clip end
+static void
+AdvanceInstances(std::vector<FlatDataInstance>& instances_io, const std::vector<int>& clip_ranges, float tick_frames)
+{
+	for (auto& cur_instance : instances_io)
+	{
+		float start_time = (float)clip_ranges[cur_instance.clip_index * 2];
+		float clip_length = (float)clip_ranges[cur_instance.clip_index * 2 + 1] - start_time + 1.0f;
+		cur_instance.time += tick_frames;
+		if (cur_instance.time >= start_time + clip_length)
+		{
+			cur_instance.time -= clip_length;
+		}
+	}
+}
+
+int main(int argc, const char * argv[]) {
+	if (argc < 2)
+	{
+		std::cerr << "Runtime arguments: <FBB File> [-instances <count>] [-threads <max threads>] "
+			<< "[-iterations <count>] [-task <instances per task>] [-noskin] [-tick <frames>] "
+			<< "[-cache <MB>] [-steps <cache steps per frame>]" << std::endl;
+		return 0;
+	}
+
+	std::string filename;
+	int instance_count = 1000;
+	int max_threads = (int)std::thread::hardware_concurrency();
+	int iterations = 10;
+	int instances_per_task = 64;
+	bool skin_points = true;
+	float tick_frames = 0.5f;
+	int cache_mb = 0;
+	int cache_steps = 1;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		if ((cur_arg == "-instances") && (i + 1 < argc))
+		{
+			instance_count = atoi(argv[++i]);
+		}
+		else if ((cur_arg == "-threads") && (i + 1 < argc))
+		{
+			max_threads = atoi(argv[++i]);
+		}
+		else if ((cur_arg == "-iterations") && (i + 1 < argc))
+		{
+			iterations = atoi(argv[++i]);
+		}
+		else if ((cur_arg == "-task") && (i + 1 < argc))
+		{
+			instances_per_task = atoi(argv[++i]);
+		}
+		else if ((cur_arg == "-tick") && (i + 1 < argc))
+		{
+			tick_frames = (float)atof(argv[++i]);
+		}
+		else if ((cur_arg == "-cache") && (i + 1 < argc))
+		{
+			cache_mb = atoi(argv[++i]);
+		}
+		else if ((cur_arg == "-steps") && (i + 1 < argc))
+		{
+			cache_steps = atoi(argv[++i]);
+		}
+		else if (cur_arg == "-noskin")
+		{
+			skin_points = false;
+		}
+		else
+		{
+			filename = cur_arg;
+		}
+	}
+
+	FlatDataLoader file_loader;
+	if (!file_loader.Open(filename, true))
+	{
+		return 1;
+	}
+
+	auto root_data = file_loader.GetRootData();
+	max_threads = std::max(max_threads, 1);
+
+	// Spread the instances over every clip at staggered fractional times
+	std::vector<FlatDataInstance> instances(instance_count);
+	std::vector<int> clip_ranges;
+	{
+		FlatDataPoseSampler sampler(root_data);
+		if (sampler.GetClipCount() == 0)
+		{
+			std::cerr << "Error: No clips in: " << filename << std::endl;
+			return 1;
+		}
+
+		clip_ranges.assign(sampler.GetClipCount() * 2, 0);
+		for (int c = 0; c < sampler.GetClipCount(); c++)
+		{
+			sampler.GetClipTimeRange(c, clip_ranges[c * 2], clip_ranges[c * 2 + 1]);
+		}
+
+		for (int i = 0; i < instance_count; i++)
+		{
+			int clip_index = i % sampler.GetClipCount();
+			float clip_length = (float)(clip_ranges[clip_index * 2 + 1] - clip_ranges[clip_index * 2]);
+			instances[i].clip_index = clip_index;
+			instances[i].time = (float)clip_ranges[clip_index * 2] + clip_length * (float)((i * 37) % 100) / 100.0f + 0.3f;
+		}
+	}
+
+	FlatDataBatchOutput batch_output;
+	batch_output.Init(root_data, instances.size(), skin_points);
+	std::cout << filename << ": " << instance_count << " instances, " << batch_output.bone_stride / 4 << " bones, "
+		<< batch_output.point_stride / 2 << " skinned points each, " << std::thread::hardware_concurrency()
+		<< " hardware threads" << std::endl;
+
+	int hardware_threads = (int)std::thread::hardware_concurrency();
+	double single_thread_rate = 0.0;
+	for (int thread_count = 1; thread_count <= max_threads; thread_count *= 2)
+	{
+		FlatDataBatchUpdater updater(root_data, thread_count, instances_per_task);
+		std::unique_ptr<FlatDataPoseCache> pose_cache;
+		if (cache_mb > 0)
+		{
+			pose_cache.reset(new FlatDataPoseCache(root_data, (size_t)cache_mb * 1024 * 1024, cache_steps, skin_points));
+			updater.SetPoseCache(pose_cache.get());
+		}
+
+		std::vector<FlatDataInstance> tick_instances = instances;
+		updater.Update(tick_instances.data(), tick_instances.size(), batch_output);
+
+		auto start_clock = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++)
+		{
+			AdvanceInstances(tick_instances, clip_ranges, tick_frames);
+			updater.Update(tick_instances.data(), tick_instances.size(), batch_output);
+		}
+		auto end_clock = std::chrono::high_resolution_clock::now();
+
+		double total_s = std::chrono::duration<double>(end_clock - start_clock).count();
+		double instance_rate = (total_s > 0.0) ? (double)instance_count * iterations / total_s : 0.0;
+		if (thread_count == 1)
+		{
+			single_thread_rate = instance_rate;
+		}
+
+		// Threads sharing a hardware thread only measure the pool's overhead, not its scaling
+		bool oversubscribed = (hardware_threads > 0) && (thread_count > hardware_threads);
+		std::cout << "  " << thread_count << " threads: " << total_s * 1e3 / iterations << " ms per update, "
+			<< instance_rate << " instances/s, speedup "
+			<< ((single_thread_rate > 0.0) ? instance_rate / single_thread_rate : 0.0)
+			<< (oversubscribed ? " (oversubscribed, not a scaling result)" : "") << std::endl;
+		if (pose_cache)
+		{
+			std::cout << "  ";
+			pose_cache->PrintStats();
+		}
+
+		if ((thread_count < max_threads) && (thread_count * 2 > max_threads))
+		{
+			thread_count = max_threads / 2;
+		}
+	}
+
+	return 0;
+}
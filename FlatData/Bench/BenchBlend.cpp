@@ -0,0 +1,194 @@
+//
+//  BenchBlend.cpp
+//  CreatureFlatData
+//
+//  Times FlatDataPoseSampler::SampleBlend mixing 2 to -clips weighted clips of Creature
+//  FlatData files against sampling a full pose per clip and mixing the poses afterwards.
+//  Reports microseconds per blended pose for both and the largest difference between them.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -I. Bench/BenchBlend.cpp FlatDataPose.cpp FlatDataLoader.cpp -o BenchBlend
+//
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <FlatDataLoader.h>
+#include <FlatDataPose.h>
+
+// Adds weight_in times values_in to values_io
+static void
+MixValues(std::vector<float>& values_io, const std::vector<float>& values_in, float weight_in)
+{
+	for (size_t i = 0; i < values_io.size(); i++)
+	{
+		values_io[i] += weight_in * values_in[i];
+	}
+}
+
+// The unfused blend: samples every clip into its own pose, then mixes the poses into blend_out
+static void
+NaiveBlend(const FlatDataPoseSampler& sampler, const FlatDataClipBlend * clips_in, int clip_count,
+	std::vector<FlatDataPose>& clip_poses, FlatDataPose& blend_out)
+{
+	float total_weight = 0.0f;
+	for (int i = 0; i < clip_count; i++)
+	{
+		total_weight += clips_in[i].weight;
+	}
+
+	std::fill(blend_out.bone_positions.begin(), blend_out.bone_positions.end(), 0.0f);
+	std::fill(blend_out.local_displacements.begin(), blend_out.local_displacements.end(), 0.0f);
+	std::fill(blend_out.post_displacements.begin(), blend_out.post_displacements.end(), 0.0f);
+	std::fill(blend_out.region_opacities.begin(), blend_out.region_opacities.end(), 0.0f);
+	for (int i = 0; i < clip_count; i++)
+	{
+		FlatDataPose& cur_pose = clip_poses[i];
+		std::fill(cur_pose.bone_positions.begin(), cur_pose.bone_positions.end(), 0.0f);
+		std::fill(cur_pose.local_displacements.begin(), cur_pose.local_displacements.end(), 0.0f);
+		std::fill(cur_pose.post_displacements.begin(), cur_pose.post_displacements.end(), 0.0f);
+		sampler.Sample(clips_in[i].clip_index, clips_in[i].time, cur_pose);
+
+		float cur_weight = clips_in[i].weight / total_weight;
+		MixValues(blend_out.bone_positions, cur_pose.bone_positions, cur_weight);
+		MixValues(blend_out.local_displacements, cur_pose.local_displacements, cur_weight);
+		MixValues(blend_out.post_displacements, cur_pose.post_displacements, cur_weight);
+		MixValues(blend_out.region_opacities, cur_pose.region_opacities, cur_weight);
+	}
+}
+
+static float
+MaxDifference(const FlatDataPose& pose_a, const FlatDataPose& pose_b)
+{
+	float max_diff = 0.0f;
+	const std::vector<float> * values_a[] = { &pose_a.bone_positions, &pose_a.local_displacements,
+		&pose_a.post_displacements, &pose_a.region_opacities };
+	const std::vector<float> * values_b[] = { &pose_b.bone_positions, &pose_b.local_displacements,
+		&pose_b.post_displacements, &pose_b.region_opacities };
+	for (int v = 0; v < 4; v++)
+	{
+		for (size_t i = 0; i < values_a[v]->size(); i++)
+		{
+			max_diff = std::max(max_diff, std::fabs((*values_a[v])[i] - (*values_b[v])[i]));
+		}
+	}
+
+	return max_diff;
+}
+
+int main(int argc, const char * argv[]) {
+	if (argc < 2)
+	{
+		std::cerr << "Runtime arguments: <FBB File> [<FBB File> ...] [-iterations <count>] [-clips <max blended clips>]" << std::endl;
+		return 0;
+	}
+
+	int iterations = 2000;
+	int max_clips = 4;
+	std::vector<std::string> filenames;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		if ((cur_arg == "-iterations") && (i + 1 < argc))
+		{
+			iterations = std::max(atoi(argv[++i]), 1);
+		}
+		else if ((cur_arg == "-clips") && (i + 1 < argc))
+		{
+			max_clips = std::max(atoi(argv[++i]), 2);
+		}
+		else
+		{
+			filenames.push_back(cur_arg);
+		}
+	}
+
+	for (auto& cur_filename : filenames)
+	{
+		FlatDataLoader file_loader;
+		if (!file_loader.Open(cur_filename, true))
+		{
+			return 1;
+		}
+
+		auto root_data = file_loader.GetRootData();
+		FlatDataPoseSampler sampler(root_data);
+		int clip_count = sampler.GetClipCount();
+		if (clip_count == 0)
+		{
+			std::cerr << cur_filename << ": no clips" << std::endl;
+			continue;
+		}
+
+		std::vector<int> clip_ranges(clip_count * 2, 0);
+		for (int c = 0; c < clip_count; c++)
+		{
+			sampler.GetClipTimeRange(c, clip_ranges[c * 2], clip_ranges[c * 2 + 1]);
+		}
+
+		std::vector<FlatDataPose> clip_poses(max_clips);
+		for (auto& cur_pose : clip_poses)
+		{
+			cur_pose.Init(root_data);
+		}
+
+		FlatDataPose naive_pose, fused_pose;
+		naive_pose.Init(root_data);
+		fused_pose.Init(root_data);
+
+		std::cout << cur_filename << ": " << fused_pose.bone_positions.size() / 4 << " bones, "
+			<< fused_pose.local_displacements.size() / 2 << " points, " << clip_count << " clips" << std::endl;
+
+		for (int blend_count = 2; blend_count <= max_clips; blend_count++)
+		{
+			// Blend the clips round robin at fractional times spread over each clip
+			std::vector<FlatDataClipBlend> blends((size_t)iterations * blend_count);
+			for (int i = 0; i < iterations; i++)
+			{
+				for (int b = 0; b < blend_count; b++)
+				{
+					FlatDataClipBlend& cur_blend = blends[(size_t)i * blend_count + b];
+					cur_blend.clip_index = (i + b) % clip_count;
+					float clip_length = (float)(clip_ranges[cur_blend.clip_index * 2 + 1] - clip_ranges[cur_blend.clip_index * 2]);
+					cur_blend.time = (float)clip_ranges[cur_blend.clip_index * 2] + clip_length * (float)((i * 7 + b * 13) % 100) / 100.0f;
+					cur_blend.weight = 1.0f + (float)b;
+				}
+			}
+
+			float max_diff = 0.0f;
+			for (int i = 0; i < std::min(iterations, 64); i++)
+			{
+				NaiveBlend(sampler, &blends[(size_t)i * blend_count], blend_count, clip_poses, naive_pose);
+				sampler.SampleBlend(&blends[(size_t)i * blend_count], blend_count, fused_pose);
+				max_diff = std::max(max_diff, MaxDifference(naive_pose, fused_pose));
+			}
+
+			double checksum = 0.0;
+			auto naive_start = std::chrono::high_resolution_clock::now();
+			for (int i = 0; i < iterations; i++)
+			{
+				NaiveBlend(sampler, &blends[(size_t)i * blend_count], blend_count, clip_poses, naive_pose);
+				checksum += naive_pose.bone_positions[2];
+			}
+			auto naive_end = std::chrono::high_resolution_clock::now();
+
+			for (int i = 0; i < iterations; i++)
+			{
+				sampler.SampleBlend(&blends[(size_t)i * blend_count], blend_count, fused_pose);
+				checksum += fused_pose.bone_positions[2];
+			}
+			auto fused_end = std::chrono::high_resolution_clock::now();
+
+			double naive_us = std::chrono::duration<double>(naive_end - naive_start).count() * 1e6 / (double)iterations;
+			double fused_us = std::chrono::duration<double>(fused_end - naive_end).count() * 1e6 / (double)iterations;
+			std::cout << "  " << blend_count << " clips: naive " << naive_us << " us, fused " << fused_us
+				<< " us (" << (fused_us > 0.0 ? naive_us / fused_us : 0.0) << "x), max difference "
+				<< max_diff << " (checksum " << checksum << ")" << std::endl;
+		}
+	}
+
+	return 0;
+}
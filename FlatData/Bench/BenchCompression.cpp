@@ -0,0 +1,100 @@
+//
+//  BenchCompression.cpp
+//  CreatureFlatData
+//
+//  Times the block LZ codec of FlatDataCompress on whole files, such as converted
+//  Creature FlatData files or single clip chunks. Checks each file decompresses back to
+//  itself and reports the compression ratio, compression MB/s and decompression MB/s.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -I. Bench/BenchCompression.cpp FlatDataCompress.cpp -o BenchCompression
+//
+
+#include <iostream>
+#include <fstream>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <FlatDataCompress.h>
+
+static bool
+ReadWholeFile(const std::string& filename_in, std::vector<uint8_t>& data_out)
+{
+	std::ifstream read_file(filename_in.c_str(), std::ios::binary);
+	if (!read_file)
+	{
+		return false;
+	}
+
+	data_out.assign(std::istreambuf_iterator<char>(read_file), std::istreambuf_iterator<char>());
+	return !data_out.empty();
+}
+
+int main(int argc, const char * argv[]) {
+	if (argc < 2)
+	{
+		std::cerr << "Runtime arguments: <File> [<File> ...] [-iterations <count>]" << std::endl;
+		return 0;
+	}
+
+	int iterations = 10;
+	std::vector<std::string> filenames;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		if ((cur_arg == "-iterations") && (i + 1 < argc))
+		{
+			iterations = std::max(atoi(argv[++i]), 1);
+		}
+		else
+		{
+			filenames.push_back(cur_arg);
+		}
+	}
+
+	for (auto& cur_filename : filenames)
+	{
+		std::vector<uint8_t> file_data;
+		if (!ReadWholeFile(cur_filename, file_data))
+		{
+			std::cerr << "Error: Could not read: " << cur_filename << std::endl;
+			return 1;
+		}
+
+		// Best of the iterations, the rest lose time to the page cache and other processes
+		std::vector<uint8_t> compressed_data, decompressed_data(file_data.size(), 0);
+		double compress_s = 0.0, decompress_s = 0.0;
+		bool round_trip_ok = true;
+		for (int i = 0; i < iterations; i++)
+		{
+			auto start_time = std::chrono::high_resolution_clock::now();
+			compressed_data = CompressFlatDataBlocks(file_data.data(), file_data.size());
+			auto compress_time = std::chrono::high_resolution_clock::now();
+			round_trip_ok &= DecompressFlatDataBlocks(compressed_data.data(), compressed_data.size(),
+				decompressed_data.data(), decompressed_data.size());
+			auto decompress_time = std::chrono::high_resolution_clock::now();
+
+			double cur_compress_s = std::chrono::duration<double>(compress_time - start_time).count();
+			double cur_decompress_s = std::chrono::duration<double>(decompress_time - compress_time).count();
+			compress_s = (i == 0) ? cur_compress_s : std::min(compress_s, cur_compress_s);
+			decompress_s = (i == 0) ? cur_decompress_s : std::min(decompress_s, cur_decompress_s);
+		}
+
+		round_trip_ok &= (memcmp(file_data.data(), decompressed_data.data(), file_data.size()) == 0);
+		double file_mb = (double)file_data.size() / (1024.0 * 1024.0);
+		std::cout << cur_filename << ": " << file_data.size() << " -> " << compressed_data.size() << " bytes ("
+			<< (double)compressed_data.size() / (double)file_data.size() << "x), compress "
+			<< (compress_s > 0.0 ? file_mb / compress_s : 0.0) << " MB/s, decompress "
+			<< (decompress_s > 0.0 ? file_mb / decompress_s : 0.0) << " MB/s"
+			<< (round_trip_ok ? "" : ", ROUND TRIP FAILED") << std::endl;
+
+		if (!round_trip_ok)
+		{
+			return 1;
+		}
+	}
+
+	return 0;
+}
@@ -0,0 +1,245 @@
+//
+//  BenchConvert.cpp
+//  CreatureFlatData
+//
+//  Times ConvertToFlatData on synthetic Creature JSON characters written by
+//  CreatureJsonGenerator.h, over a table of sizes or one size given on the command line.
+//  Each configuration is converted in a child process so its peak RSS is its own.
+//  Reports the parse, build and write times of the fastest iteration, the child's peak
+//  RSS and the input and output sizes. Linux only.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -pthread -I. Bench/BenchConvert.cpp ConvertFlatData.cpp ConvertFlatDataStream.cpp FlatDataWriter.cpp FlatDataCompress.cpp KeyframeReducer.cpp WorkStealingPool.cpp ConvertProfile.cpp -o BenchConvert
+//
+
+#include <iostream>
+#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <sys/resource.h>
+#include <ConvertFlatData.h>
+#include <Bench/CreatureJsonGenerator.h>
+
+// Sizes converted when none is given: a small character, a typical one, one with many
+// bones, one with a dense mesh, and one with many long clips
+static const int default_configs[][5] = {
+	// bones, vertices, regions, clips, frames
+	{ 10, 500, 5, 2, 30 },
+	{ 40, 4000, 20, 8, 60 },
+	{ 200, 4000, 20, 8, 60 },
+	{ 40, 20000, 40, 4, 60 },
+	{ 40, 2000, 20, 16, 120 },
+};
+
+// What a child process reports back through its pipe
+struct BenchConvertResult
+{
+	bool success;
+	ConvertFlatDataTimes times;
+};
+
+static long long
+GetFileSize(const std::string& filename_in)
+{
+	struct stat file_stat;
+	return (stat(filename_in.c_str(), &file_stat) == 0) ? (long long)file_stat.st_size : -1;
+}
+
+// Converts json_filename iterations times in a child process, keeping the fastest
+// stage times, and returns the child's peak RSS in KB in peak_rss_out
+static bool
+RunConversion(const std::string& json_filename, const std::string& flat_filename,
+	const ConvertFlatDataOptions& options, int iterations,
+	BenchConvertResult& result_out, long& peak_rss_out)
+{
+	int result_pipe[2];
+	if (pipe(result_pipe) != 0)
+	{
+		return false;
+	}
+
+	pid_t child_pid = fork();
+	if (child_pid < 0)
+	{
+		close(result_pipe[0]);
+		close(result_pipe[1]);
+		return false;
+	}
+
+	if (child_pid == 0)
+	{
+		close(result_pipe[0]);
+		BenchConvertResult child_result;
+		child_result.success = true;
+		for (int i = 0; i < iterations; i++)
+		{
+			ConvertFlatDataTimes cur_times;
+			child_result.success &= ConvertToFlatData(json_filename, flat_filename, options, cur_times);
+			if ((i == 0) || (cur_times.parse_s + cur_times.build_s + cur_times.write_s
+				< child_result.times.parse_s + child_result.times.build_s + child_result.times.write_s))
+			{
+				child_result.times = cur_times;
+			}
+		}
+
+		ssize_t write_size = write(result_pipe[1], &child_result, sizeof(child_result));
+		close(result_pipe[1]);
+		_exit(write_size == (ssize_t)sizeof(child_result) ? 0 : 1);
+	}
+
+	close(result_pipe[1]);
+	ssize_t read_size = read(result_pipe[0], &result_out, sizeof(result_out));
+	close(result_pipe[0]);
+
+	int child_status = 0;
+	struct rusage child_usage;
+	if (wait4(child_pid, &child_status, 0, &child_usage) != child_pid)
+	{
+		return false;
+	}
+
+	peak_rss_out = child_usage.ru_maxrss;
+	return (read_size == (ssize_t)sizeof(result_out)) && WIFEXITED(child_status)
+		&& (WEXITSTATUS(child_status) == 0) && result_out.success;
+}
+
+int main(int argc, const char * argv[]) {
+	std::vector<CreatureJsonParams> configs;
+	CreatureJsonParams arg_params;
+	bool has_arg_params = false;
+	ConvertFlatDataOptions options;
+	options.verbose = false;
+	int iterations = 3;
+	bool keep_files = false;
+	std::string work_dir("/tmp");
+
+	for (int i = 1; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		bool has_value = (i + 1 < argc);
+		if (cur_arg == "-stream")
+		{
+			options.stream_parse = true;
+		}
+		else if (cur_arg == "-insitu")
+		{
+			options.parse_insitu = true;
+		}
+		else if (cur_arg == "-keep")
+		{
+			keep_files = true;
+		}
+		else if ((cur_arg == "-quantize") && has_value)
+		{
+			options.quantize_bits = atoi(argv[++i]);
+		}
+		else if ((cur_arg == "-iterations") && has_value)
+		{
+			iterations = std::max(atoi(argv[++i]), 1);
+		}
+		else if ((cur_arg == "-dir") && has_value)
+		{
+			work_dir = argv[++i];
+		}
+		else if ((cur_arg == "-bones") && has_value)
+		{
+			arg_params.bone_count = atoi(argv[++i]);
+			has_arg_params = true;
+		}
+		else if ((cur_arg == "-vertices") && has_value)
+		{
+			arg_params.vertex_count = atoi(argv[++i]);
+			has_arg_params = true;
+		}
+		else if ((cur_arg == "-regions") && has_value)
+		{
+			arg_params.region_count = atoi(argv[++i]);
+			has_arg_params = true;
+		}
+		else if ((cur_arg == "-clips") && has_value)
+		{
+			arg_params.clip_count = atoi(argv[++i]);
+			has_arg_params = true;
+		}
+		else if ((cur_arg == "-frames") && has_value)
+		{
+			arg_params.frame_count = atoi(argv[++i]);
+			has_arg_params = true;
+		}
+		else
+		{
+			std::cerr << "Runtime arguments: [-bones <count>] [-vertices <count>] [-regions <count>] [-clips <count>]"
+				<< " [-frames <count>] [-iterations <count>] [-stream] [-insitu] [-quantize <bits>] [-dir <directory>] [-keep]"
+				<< std::endl;
+			return 0;
+		}
+	}
+
+	if (has_arg_params)
+	{
+		configs.push_back(arg_params);
+	}
+	else
+	{
+		for (auto& cur_config : default_configs)
+		{
+			CreatureJsonParams cur_params;
+			cur_params.bone_count = cur_config[0];
+			cur_params.vertex_count = cur_config[1];
+			cur_params.region_count = cur_config[2];
+			cur_params.clip_count = cur_config[3];
+			cur_params.frame_count = cur_config[4];
+			configs.push_back(cur_params);
+		}
+	}
+
+	std::cout << "bones vertices regions clips frames | json MB | parse ms build ms write ms total ms | peak RSS MB | output MB" << std::endl;
+	std::cout << std::fixed;
+	bool all_ok = true;
+	for (size_t c = 0; c < configs.size(); c++)
+	{
+		auto& cur_params = configs[c];
+		std::string base_filename = work_dir + "/bench_convert_" + std::to_string(getpid()) + "_" + std::to_string(c);
+		std::string json_filename = base_filename + ".json";
+		std::string flat_filename = base_filename + ".fbb";
+		if (!WriteCreatureJson(cur_params, json_filename))
+		{
+			std::cerr << "Error: Could not write: " << json_filename << std::endl;
+			return 1;
+		}
+
+		BenchConvertResult result;
+		long peak_rss = 0;
+		bool convert_ok = RunConversion(json_filename, flat_filename, options, iterations, result, peak_rss);
+		all_ok &= convert_ok;
+
+		double total_s = result.times.parse_s + result.times.build_s + result.times.write_s;
+		std::cout << cur_params.bone_count << " " << cur_params.vertex_count << " "
+			<< cur_params.region_count << " " << cur_params.clip_count << " " << cur_params.frame_count << " | "
+			<< std::setprecision(2) << (double)GetFileSize(json_filename) / (1024.0 * 1024.0) << " | ";
+		if (convert_ok)
+		{
+			std::cout << std::setprecision(1) << result.times.parse_s * 1e3 << " " << result.times.build_s * 1e3 << " "
+				<< result.times.write_s * 1e3 << " " << total_s * 1e3 << " | "
+				<< std::setprecision(1) << (double)peak_rss / 1024.0 << " | "
+				<< std::setprecision(2) << (double)GetFileSize(flat_filename) / (1024.0 * 1024.0) << std::endl;
+		}
+		else
+		{
+			std::cout << "CONVERSION FAILED" << std::endl;
+		}
+
+		if (!keep_files)
+		{
+			remove(json_filename.c_str());
+			remove(flat_filename.c_str());
+		}
+	}
+
+	return all_ok ? 0 : 1;
+}
@@ -0,0 +1,126 @@
+//
+//  BenchDisplacements.cpp
+//  CreatureFlatData
+//
+//  Times decoding every animationMesh displacements vector of Creature FlatData files,
+//  to compare the dense, sparse and quantized forms written by the converter.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -I. Bench/BenchDisplacements.cpp FlatDataLoader.cpp -o BenchDisplacements
+//
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <FlatDataDisplacements.h>
+#include <FlatDataLoader.h>
+
+// Decodes every displacements vector of the file once, returning a checksum of the values
+static double
+DecodeAllDisplacements(const CreatureFlatData::rootData * root_data,
+	std::vector<float>& scratch,
+	size_t& decode_count)
+{
+	double checksum = 0.0;
+	auto regions = root_data->dataMesh()->regions();
+	auto clips = root_data->dataAnimation()->clips();
+
+	for (flatbuffers::uoffset_t c = 0; c < clips->size(); c++)
+	{
+		auto mesh_list = clips->Get(c)->meshes();
+		if (!mesh_list || !mesh_list->timeSamples())
+		{
+			continue;
+		}
+
+		auto time_samples = mesh_list->timeSamples();
+		for (flatbuffers::uoffset_t t = 0; t < time_samples->size(); t++)
+		{
+			auto meshes = time_samples->Get(t)->meshes();
+			for (flatbuffers::uoffset_t m = 0; m < meshes->size(); m++)
+			{
+				auto cur_mesh = meshes->Get(m);
+				int region_index = cur_mesh->region_index();
+				if ((region_index < 0) || ((flatbuffers::uoffset_t)region_index >= regions->size()))
+				{
+					continue;
+				}
+
+				auto cur_region = regions->Get(region_index);
+				size_t count = (size_t)(cur_region->end_pt_index() - cur_region->start_pt_index() + 1) * 2;
+				if (scratch.size() < count)
+				{
+					scratch.resize(count);
+				}
+
+				if (DecodeLocalDisplacements(cur_mesh, mesh_list, scratch.data(), count))
+				{
+					checksum += scratch[0];
+					decode_count++;
+				}
+
+				if (DecodePostDisplacements(cur_mesh, mesh_list, scratch.data(), count))
+				{
+					checksum += scratch[0];
+					decode_count++;
+				}
+			}
+		}
+	}
+
+	return checksum;
+}
+
+int main(int argc, const char * argv[]) {
+	if (argc < 2)
+	{
+		std::cerr << "Runtime arguments: <FBB File> [<FBB File> ...] [-iterations <count>]" << std::endl;
+		return 0;
+	}
+
+	int iterations = 20;
+	std::vector<std::string> filenames;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		if ((cur_arg == "-iterations") && (i + 1 < argc))
+		{
+			iterations = atoi(argv[++i]);
+		}
+		else
+		{
+			filenames.push_back(cur_arg);
+		}
+	}
+
+	for (auto& cur_filename : filenames)
+	{
+		FlatDataLoader file_loader;
+		if (!file_loader.Open(cur_filename, true))
+		{
+			return 1;
+		}
+
+		auto root_data = file_loader.GetRootData();
+		std::vector<float> scratch;
+		size_t decode_count = 0;
+		double checksum = DecodeAllDisplacements(root_data, scratch, decode_count);
+
+		auto start_time = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++)
+		{
+			size_t iteration_count = 0;
+			checksum += DecodeAllDisplacements(root_data, scratch, iteration_count);
+		}
+		auto end_time = std::chrono::high_resolution_clock::now();
+
+		double total_ns = (double)std::chrono::duration_cast<std::chrono::nanoseconds>(end_time - start_time).count();
+		double per_vector_ns = (decode_count > 0) ? total_ns / ((double)decode_count * iterations) : 0.0;
+
+		std::cout << cur_filename << ": " << file_loader.GetSize() << " bytes, "
+			<< decode_count << " displacement vectors, "
+			<< per_vector_ns << " ns per vector decode (checksum " << checksum << ")" << std::endl;
+	}
+
+	return 0;
+}
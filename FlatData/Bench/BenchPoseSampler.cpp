@@ -0,0 +1,141 @@
+//
+//  BenchPoseSampler.cpp
+//  CreatureFlatData
+//
+//  Times FlatDataPoseSampler sampling every clip of Creature FlatData files at
+//  fractional times, reporting samples per second. With -random the same times are
+//  sampled in shuffled order, the random access cost of delta encoded files.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -I. Bench/BenchPoseSampler.cpp FlatDataPose.cpp FlatDataLoader.cpp -o BenchPoseSampler
+//
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <random>
+#include <algorithm>
+#include <FlatDataLoader.h>
+#include <FlatDataPose.h>
+
+// Builds the times to sample each clip at, steps_per_frame evenly spaced times per frame,
+// shuffled if random_order is set
+static std::vector<std::vector<float> >
+GetSampleTimes(const FlatDataPoseSampler& sampler, int steps_per_frame, bool random_order)
+{
+	std::vector<std::vector<float> > clip_times(sampler.GetClipCount());
+	std::mt19937 shuffle_rng(1);
+	for (int c = 0; c < sampler.GetClipCount(); c++)
+	{
+		int start_time = 0, end_time = 0;
+		if (!sampler.GetClipTimeRange(c, start_time, end_time))
+		{
+			continue;
+		}
+
+		int step_count = (end_time - start_time) * steps_per_frame + 1;
+		for (int s = 0; s < step_count; s++)
+		{
+			clip_times[c].push_back((float)start_time + (float)s / (float)steps_per_frame);
+		}
+
+		if (random_order)
+		{
+			std::shuffle(clip_times[c].begin(), clip_times[c].end(), shuffle_rng);
+		}
+	}
+
+	return clip_times;
+}
+
+// Samples every clip at its times, returning a checksum of the poses
+static double
+SampleAllClips(const FlatDataPoseSampler& sampler, FlatDataPose& pose,
+	const std::vector<std::vector<float> >& clip_times, size_t& sample_count)
+{
+	double checksum = 0.0;
+	for (int c = 0; c < (int)clip_times.size(); c++)
+	{
+		for (float cur_time : clip_times[c])
+		{
+			sampler.Sample(c, cur_time, pose);
+			for (size_t i = 0; i < pose.bone_positions.size(); i += 4)
+			{
+				checksum += pose.bone_positions[i + 2];
+			}
+			sample_count++;
+		}
+	}
+
+	return checksum;
+}
+
+int main(int argc, const char * argv[]) {
+	if (argc < 2)
+	{
+		std::cerr << "Runtime arguments: <FBB File> [<FBB File> ...] [-iterations <count>] [-steps <samples per frame>] [-random]" << std::endl;
+		return 0;
+	}
+
+	int iterations = 5;
+	int steps_per_frame = 4;
+	bool random_order = false;
+	std::vector<std::string> filenames;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		if ((cur_arg == "-iterations") && (i + 1 < argc))
+		{
+			iterations = atoi(argv[++i]);
+		}
+		else if ((cur_arg == "-steps") && (i + 1 < argc))
+		{
+			steps_per_frame = atoi(argv[++i]);
+		}
+		else if (cur_arg == "-random")
+		{
+			random_order = true;
+		}
+		else
+		{
+			filenames.push_back(cur_arg);
+		}
+	}
+
+	for (auto& cur_filename : filenames)
+	{
+		FlatDataLoader file_loader;
+		if (!file_loader.Open(cur_filename, true))
+		{
+			return 1;
+		}
+
+		auto root_data = file_loader.GetRootData();
+		FlatDataPoseSampler sampler(root_data);
+		FlatDataPose pose;
+		pose.Init(root_data);
+
+		auto clip_times = GetSampleTimes(sampler, steps_per_frame, random_order);
+		size_t warm_count = 0;
+		double checksum = SampleAllClips(sampler, pose, clip_times, warm_count);
+
+		size_t sample_count = 0;
+		auto start_time = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++)
+		{
+			checksum += SampleAllClips(sampler, pose, clip_times, sample_count);
+		}
+		auto end_time = std::chrono::high_resolution_clock::now();
+
+		double total_s = std::chrono::duration<double>(end_time - start_time).count();
+		double samples_per_s = (total_s > 0.0) ? (double)sample_count / total_s : 0.0;
+
+		std::cout << cur_filename << ": " << pose.bone_positions.size() / 4 << " bones, "
+			<< pose.region_opacities.size() << " regions, " << sample_count << " samples, "
+			<< samples_per_s << " samples/s, " << (sample_count > 0 ? total_s * 1e6 / (double)sample_count : 0.0)
+			<< " us per sample (checksum " << checksum << ")" << std::endl;
+	}
+
+	return 0;
+}
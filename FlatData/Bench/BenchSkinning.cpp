@@ -0,0 +1,175 @@
+//
+//  BenchSkinning.cpp
+//  CreatureFlatData
+//
+//  Times FlatDataSkinMesh deforming the mesh of Creature FlatData files with each
+//  compiled skinning kernel, blending linearly and as dual quaternions, reporting
+//  points per second and the largest difference from the scalar kernel.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -mavx2 -mfma -I. Bench/BenchSkinning.cpp FlatDataSkinning.cpp FlatDataPose.cpp FlatDataLoader.cpp -o BenchSkinning
+//
+
+#include <iostream>
+#include <cstdlib>
+#include <cmath>
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <FlatDataLoader.h>
+#include <FlatDataPose.h>
+#include <FlatDataSkinning.h>
+
+enum BenchSkinMethod
+{
+	BENCH_SKIN_LINEAR,
+	BENCH_SKIN_DUAL_QUAT,
+	BENCH_SKIN_AUTHORED,
+	BENCH_SKIN_METHOD_COUNT
+};
+
+static const char * bench_method_names[BENCH_SKIN_METHOD_COUNT] = { "linear", "dual quat", "authored" };
+
+static void
+SkinWithMethod(const FlatDataSkinMesh& skin_mesh, FlatDataPose& pose_io, BenchSkinMethod method_in,
+	float * points_out, FlatDataSkinKernel kernel_in)
+{
+	if (method_in == BENCH_SKIN_LINEAR)
+	{
+		skin_mesh.SkinLinearBlend(pose_io, points_out, kernel_in);
+	}
+	else if (method_in == BENCH_SKIN_DUAL_QUAT)
+	{
+		skin_mesh.SkinDualQuat(pose_io, points_out, kernel_in);
+	}
+	else
+	{
+		skin_mesh.Skin(pose_io, points_out, kernel_in);
+	}
+}
+
+static float
+GetMaxDifference(const std::vector<float>& points_a, const std::vector<float>& points_b)
+{
+	float max_difference = 0.0f;
+	for (size_t i = 0; i < points_a.size(); i++)
+	{
+		max_difference = std::max(max_difference, std::fabs(points_a[i] - points_b[i]));
+	}
+
+	return max_difference;
+}
+
+int main(int argc, const char * argv[]) {
+	if (argc < 2)
+	{
+		std::cerr << "Runtime arguments: <FBB File> [<FBB File> ...] [-iterations <count>]" << std::endl;
+		return 0;
+	}
+
+	int iterations = 200;
+	std::vector<std::string> filenames;
+	for (int i = 1; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		if ((cur_arg == "-iterations") && (i + 1 < argc))
+		{
+			iterations = atoi(argv[++i]);
+		}
+		else
+		{
+			filenames.push_back(cur_arg);
+		}
+	}
+
+	std::vector<FlatDataSkinKernel> kernels;
+	kernels.push_back(FLATDATA_SKIN_SCALAR);
+	if (GetBestSkinKernel() >= FLATDATA_SKIN_SSE2)
+	{
+		kernels.push_back(FLATDATA_SKIN_SSE2);
+	}
+
+	if (GetBestSkinKernel() >= FLATDATA_SKIN_AVX2)
+	{
+		kernels.push_back(FLATDATA_SKIN_AVX2);
+	}
+
+	for (auto& cur_filename : filenames)
+	{
+		FlatDataLoader file_loader;
+		if (!file_loader.Open(cur_filename, true))
+		{
+			return 1;
+		}
+
+		auto root_data = file_loader.GetRootData();
+		FlatDataSkinMesh skin_mesh;
+		if (!skin_mesh.Init(root_data))
+		{
+			std::cerr << "Error: No skinnable mesh in: " << cur_filename << std::endl;
+			return 1;
+		}
+
+		// Skin a pose from the middle of the first clip
+		FlatDataPoseSampler sampler(root_data);
+		FlatDataPose pose;
+		pose.Init(root_data);
+		int start_time = 0, end_time = 0;
+		sampler.GetClipTimeRange(0, start_time, end_time);
+		sampler.Sample(0, (float)(start_time + end_time) * 0.5f + 0.25f, pose);
+
+		int point_count = skin_mesh.GetPointCount();
+		int dq_region_count = 0;
+		for (auto cur_use_dq : pose.region_use_dq)
+		{
+			dq_region_count += cur_use_dq ? 1 : 0;
+		}
+
+		std::cout << cur_filename << ": " << point_count << " points, " << pose.bone_positions.size() / 4
+			<< " bones, " << skin_mesh.GetTruncatedPointCount() << " points past "
+			<< FlatDataSkinMesh::max_influences << " influences, " << dq_region_count << " of "
+			<< pose.region_use_dq.size() << " regions authored as dual quats" << std::endl;
+
+		// Bone transforms are part of every skin, timed alone here to separate them from the kernels
+		auto transforms_start = std::chrono::high_resolution_clock::now();
+		for (int i = 0; i < iterations; i++)
+		{
+			skin_mesh.ComputeBoneTransforms(pose);
+		}
+		auto transforms_end = std::chrono::high_resolution_clock::now();
+		std::cout << "  bone transforms: " << std::chrono::duration<double>(transforms_end - transforms_start).count() * 1e6 / iterations
+			<< " us" << std::endl;
+
+		std::vector<float> scalar_points[BENCH_SKIN_METHOD_COUNT];
+		std::vector<float> kernel_points(point_count * 2, 0.0f);
+		for (int m = 0; m < BENCH_SKIN_METHOD_COUNT; m++)
+		{
+			BenchSkinMethod cur_method = (BenchSkinMethod)m;
+			scalar_points[m].assign(point_count * 2, 0.0f);
+			SkinWithMethod(skin_mesh, pose, cur_method, scalar_points[m].data(), FLATDATA_SKIN_SCALAR);
+
+			for (auto cur_kernel : kernels)
+			{
+				SkinWithMethod(skin_mesh, pose, cur_method, kernel_points.data(), cur_kernel);
+
+				auto start_clock = std::chrono::high_resolution_clock::now();
+				for (int i = 0; i < iterations; i++)
+				{
+					SkinWithMethod(skin_mesh, pose, cur_method, kernel_points.data(), cur_kernel);
+				}
+				auto end_clock = std::chrono::high_resolution_clock::now();
+
+				double total_s = std::chrono::duration<double>(end_clock - start_clock).count();
+				std::cout << "  " << bench_method_names[m] << " " << GetSkinKernelName(cur_kernel) << ": "
+					<< total_s * 1e6 / iterations << " us per skin, "
+					<< (double)point_count * iterations / total_s / 1e6 << " M points/s, "
+					<< "max difference from scalar " << GetMaxDifference(kernel_points, scalar_points[m]) << std::endl;
+			}
+		}
+
+		std::cout << "  dual quat points differ from linear by up to "
+			<< GetMaxDifference(scalar_points[BENCH_SKIN_DUAL_QUAT], scalar_points[BENCH_SKIN_LINEAR]) << std::endl;
+	}
+
+	return 0;
+}
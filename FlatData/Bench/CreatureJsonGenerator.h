@@ -0,0 +1,393 @@
+//
+//  CreatureJsonGenerator.h
+//  CreatureFlatData
+//
+//  Writes synthetic Creature JSON characters of a chosen size for benchmarking the
+//  converter without private assets: a bone chain, a strip triangulated mesh cut into
+//  regions skinned to nearby bones, and clips of smoothly swinging bones, drifting
+//  displacements, toggling uv swaps and fading opacities. The same parameters and seed
+//  always write the same file.
+//
+
+#pragma once
+
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <rapidjson/filewritestream.h>
+#include <rapidjson/writer.h>
+
+struct CreatureJsonParams
+{
+	CreatureJsonParams()
+		: bone_count(20),
+		vertex_count(2000),
+		region_count(10),
+		clip_count(4),
+		frame_count(60),
+		uv_offset_speed(0.0f),
+		seed(1)
+	{
+	}
+
+	int bone_count;
+
+	// Mesh points, split evenly over the regions
+	int vertex_count;
+	int region_count;
+	int clip_count;
+
+	// Time samples per clip
+	int frame_count;
+
+	// Distance the uv swap local offsets move along x each frame, 0 to keep them still
+	float uv_offset_speed;
+	unsigned seed;
+};
+
+typedef rapidjson::Writer<rapidjson::FileWriteStream> CreatureJsonWriter;
+
+inline void
+WriteJsonPoint(CreatureJsonWriter& writer, double x, double y)
+{
+	writer.StartArray();
+	writer.Double(x);
+	writer.Double(y);
+	writer.EndArray();
+}
+
+inline void
+WriteJsonUVSwap(CreatureJsonWriter& writer, double offset_x, double offset_y, bool enabled, int tag)
+{
+	writer.StartObject();
+	writer.Key("local_offset");
+	WriteJsonPoint(writer, offset_x, offset_y);
+	writer.Key("global_offset");
+	WriteJsonPoint(writer, 0.0, 0.0);
+	writer.Key("scale");
+	WriteJsonPoint(writer, 1.0, 1.0);
+	if (tag >= 0)
+	{
+		writer.Key("tag");
+		writer.Int(tag);
+	}
+	else
+	{
+		writer.Key("enabled");
+		writer.Bool(enabled);
+	}
+
+	writer.EndObject();
+}
+
+// Writes a character of params_in to filename_in, false if the file could not be written
+inline bool
+WriteCreatureJson(const CreatureJsonParams& params_in, const std::string& filename_in)
+{
+	FILE * fp = fopen(filename_in.c_str(), "wb");
+	if (!fp)
+	{
+		return false;
+	}
+
+	int bone_count = std::max(params_in.bone_count, 1);
+	int region_count = std::max(params_in.region_count, 1);
+	int region_points = std::max(params_in.vertex_count / region_count, 3);
+	int frame_count = std::max(params_in.frame_count, 1);
+	std::mt19937 rng(params_in.seed);
+	std::uniform_real_distribution<double> unit_dist(0.0, 1.0);
+
+	std::vector<std::string> bone_names(bone_count), region_names(region_count);
+	for (int i = 0; i < bone_count; i++)
+	{
+		bone_names[i] = "bone_" + std::to_string(i);
+	}
+
+	for (int r = 0; r < region_count; r++)
+	{
+		region_names[r] = "region_" + std::to_string(r);
+	}
+
+	char write_buffer[65536];
+	rapidjson::FileWriteStream os(fp, write_buffer, sizeof(write_buffer));
+	CreatureJsonWriter writer(os);
+	writer.StartObject();
+
+	// ----------- Mesh ----------------------
+	// Each region is a strip of points along the bone chain, one triangle per point after the first two
+	writer.Key("mesh");
+	writer.StartObject();
+	writer.Key("points");
+	writer.StartArray();
+	for (int i = 0; i < region_count * region_points; i++)
+	{
+		writer.Double((double)(i % region_points) * bone_count / region_points + unit_dist(rng) * 0.1);
+		writer.Double((double)(i / region_points) + ((i & 1) ? 0.5 : 0.0));
+	}
+
+	writer.EndArray();
+	writer.Key("uvs");
+	writer.StartArray();
+	for (int i = 0; i < region_count * region_points * 2; i++)
+	{
+		writer.Double(unit_dist(rng));
+	}
+
+	writer.EndArray();
+	writer.Key("indices");
+	writer.StartArray();
+	for (int r = 0; r < region_count; r++)
+	{
+		for (int k = 0; k < region_points - 2; k++)
+		{
+			writer.Int(r * region_points + k);
+			writer.Int(r * region_points + k + 1);
+			writer.Int(r * region_points + k + 2);
+		}
+	}
+
+	writer.EndArray();
+	writer.Key("regions");
+	writer.StartObject();
+	for (int r = 0; r < region_count; r++)
+	{
+		int region_indices = (region_points - 2) * 3;
+		writer.Key(region_names[r].c_str());
+		writer.StartObject();
+		writer.Key("start_pt_index");
+		writer.Int(r * region_points);
+		writer.Key("end_pt_index");
+		writer.Int(r * region_points + region_points - 1);
+		writer.Key("start_index");
+		writer.Int(r * region_indices);
+		writer.Key("end_index");
+		writer.Int(r * region_indices + region_indices - 1);
+		writer.Key("id");
+		writer.Int(r);
+
+		// Up to 4 neighbouring bones, weighted by distance along the strip and summing to 1
+		int influence_count = std::min(bone_count, 4);
+		int first_bone = (r * bone_count / region_count) % (bone_count - influence_count + 1);
+		writer.Key("weights");
+		writer.StartObject();
+		for (int b = 0; b < influence_count; b++)
+		{
+			writer.Key(bone_names[first_bone + b].c_str());
+			writer.StartArray();
+			for (int k = 0; k < region_points; k++)
+			{
+				double along = (double)k / (double)region_points * influence_count;
+				double total = 0.0, cur_weight = 0.0;
+				for (int c = 0; c < influence_count; c++)
+				{
+					double weight = 1.0 / (1.0 + std::fabs(along - c - 0.5));
+					total += weight;
+					cur_weight = (c == b) ? weight : cur_weight;
+				}
+
+				writer.Double(cur_weight / total);
+			}
+
+			writer.EndArray();
+		}
+
+		writer.EndObject();
+		writer.EndObject();
+	}
+
+	writer.EndObject();
+	writer.EndObject();
+
+	// ----------- Skeleton ----------------------
+	// A chain of unit bones along x, each the child of the one before
+	writer.Key("skeleton");
+	writer.StartObject();
+	for (int i = 0; i < bone_count; i++)
+	{
+		writer.Key(bone_names[i].c_str());
+		writer.StartObject();
+		writer.Key("id");
+		writer.Int(i);
+		writer.Key("restParentMat");
+		writer.StartArray();
+		double rest_mat[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, (i > 0) ? 1.0 : 0.0, 0, 0, 1 };
+		for (double cur_val : rest_mat)
+		{
+			writer.Double(cur_val);
+		}
+
+		writer.EndArray();
+		writer.Key("localRestStartPt");
+		WriteJsonPoint(writer, 0.0, 0.0);
+		writer.Key("localRestEndPt");
+		WriteJsonPoint(writer, 1.0, 0.0);
+		writer.Key("children");
+		writer.StartArray();
+		if (i + 1 < bone_count)
+		{
+			writer.Int(i + 1);
+		}
+
+		writer.EndArray();
+		writer.EndObject();
+	}
+
+	writer.EndObject();
+
+	// ----------- Animation ----------------------
+	writer.Key("animation");
+	writer.StartObject();
+	for (int c = 0; c < params_in.clip_count; c++)
+	{
+		double clip_speed = 0.05 + 0.1 * unit_dist(rng);
+		writer.Key(("clip_" + std::to_string(c)).c_str());
+		writer.StartObject();
+
+		// Every bone swings about its start point, each a little out of phase with its parent
+		writer.Key("bones");
+		writer.StartObject();
+		for (int f = 0; f < frame_count; f++)
+		{
+			writer.Key(std::to_string(f).c_str());
+			writer.StartObject();
+			double start_x = 0.0, start_y = 0.0;
+			for (int i = 0; i < bone_count; i++)
+			{
+				double angle = 0.3 * std::sin(clip_speed * f + 0.2 * i);
+				double end_x = start_x + std::cos(angle), end_y = start_y + std::sin(angle);
+				writer.Key(bone_names[i].c_str());
+				writer.StartObject();
+				writer.Key("start_pt");
+				WriteJsonPoint(writer, start_x, start_y);
+				writer.Key("end_pt");
+				WriteJsonPoint(writer, end_x, end_y);
+				writer.EndObject();
+				start_x = end_x;
+				start_y = end_y;
+			}
+
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+
+		// Every other region drifts its local displacements, the rest stay at zero
+		writer.Key("meshes");
+		writer.StartObject();
+		for (int f = 0; f < frame_count; f++)
+		{
+			writer.Key(std::to_string(f).c_str());
+			writer.StartObject();
+			for (int r = 0; r < region_count; r++)
+			{
+				bool is_displaced = (r % 2 == 0);
+				writer.Key(region_names[r].c_str());
+				writer.StartObject();
+				writer.Key("use_dq");
+				writer.Bool(false);
+				writer.Key("use_local_displacements");
+				writer.Bool(is_displaced);
+				writer.Key("use_post_displacements");
+				writer.Bool(false);
+				writer.Key("local_displacements");
+				writer.StartArray();
+				for (int k = 0; k < region_points * 2; k++)
+				{
+					writer.Double(is_displaced ? 0.05 * std::sin(clip_speed * f + 0.1 * k) : 0.0);
+				}
+
+				writer.EndArray();
+				writer.Key("post_displacements");
+				writer.StartArray();
+				for (int k = 0; k < region_points * 2; k++)
+				{
+					writer.Double(0.0);
+				}
+
+				writer.EndArray();
+				writer.EndObject();
+			}
+
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+
+		writer.Key("uv_swaps");
+		writer.StartObject();
+		for (int f = 0; f < frame_count; f++)
+		{
+			writer.Key(std::to_string(f).c_str());
+			writer.StartObject();
+			for (int r = 0; r < region_count; r++)
+			{
+				writer.Key(region_names[r].c_str());
+				WriteJsonUVSwap(writer, params_in.uv_offset_speed * f, 0.0, (f / 10 + r) % 2 == 0, -1);
+			}
+
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+
+		writer.Key("mesh_opacities");
+		writer.StartObject();
+		for (int f = 0; f < frame_count; f++)
+		{
+			writer.Key(std::to_string(f).c_str());
+			writer.StartObject();
+			for (int r = 0; r < region_count; r++)
+			{
+				writer.Key(region_names[r].c_str());
+				writer.StartObject();
+				writer.Key("opacity");
+				writer.Double((f < frame_count / 2) ? 100.0 : 100.0 - (double)f * 50.0 / frame_count);
+				writer.EndObject();
+			}
+
+			writer.EndObject();
+		}
+
+		writer.EndObject();
+		writer.EndObject();
+	}
+
+	writer.EndObject();
+
+	// ----------- UV Swap Items and Anchor Points ----------------------
+	writer.Key("uv_swap_items");
+	writer.StartObject();
+	writer.Key(region_names[0].c_str());
+	writer.StartArray();
+	WriteJsonUVSwap(writer, 0.0, 0.0, true, 0);
+	WriteJsonUVSwap(writer, 0.5, 0.0, true, 1);
+	writer.EndArray();
+	writer.EndObject();
+
+	writer.Key("anchor_points_items");
+	writer.StartObject();
+	writer.Key("AnchorPoints");
+	writer.StartArray();
+	if (params_in.clip_count > 0)
+	{
+		writer.StartObject();
+		writer.Key("point");
+		WriteJsonPoint(writer, 0.0, 1.0);
+		writer.Key("anim_clip_name");
+		writer.String("clip_0");
+		writer.EndObject();
+	}
+
+	writer.EndArray();
+	writer.EndObject();
+
+	writer.EndObject();
+	os.Flush();
+	bool write_ok = (ferror(fp) == 0);
+	fclose(fp);
+
+	return write_ok;
+}
@@ -0,0 +1,73 @@
+//
+//  GenerateCreatureJson.cpp
+//  CreatureFlatData
+//
+//  Writes a synthetic Creature JSON character of the given size, for converting and
+//  benchmarking without private assets.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -I. Bench/GenerateCreatureJson.cpp -o GenerateCreatureJson
+//
+
+#include <iostream>
+#include <cstdlib>
+#include <string>
+#include <Bench/CreatureJsonGenerator.h>
+
+int main(int argc, const char * argv[]) {
+	if (argc < 2)
+	{
+		std::cerr << "Runtime arguments: <Output JSON File> [-bones <count>] [-vertices <count>] [-regions <count>]"
+			<< " [-clips <count>] [-frames <count>] [-seed <seed>]" << std::endl;
+		return 0;
+	}
+
+	CreatureJsonParams params;
+	for (int i = 2; i < argc; i++)
+	{
+		std::string cur_arg(argv[i]);
+		if (i + 1 >= argc)
+		{
+			std::cerr << "Error: Missing value for: " << cur_arg << std::endl;
+			return 1;
+		}
+
+		int cur_value = atoi(argv[++i]);
+		if (cur_arg == "-bones")
+		{
+			params.bone_count = cur_value;
+		}
+		else if (cur_arg == "-vertices")
+		{
+			params.vertex_count = cur_value;
+		}
+		else if (cur_arg == "-regions")
+		{
+			params.region_count = cur_value;
+		}
+		else if (cur_arg == "-clips")
+		{
+			params.clip_count = cur_value;
+		}
+		else if (cur_arg == "-frames")
+		{
+			params.frame_count = cur_value;
+		}
+		else if (cur_arg == "-seed")
+		{
+			params.seed = (unsigned)cur_value;
+		}
+		else
+		{
+			std::cerr << "Error: Unknown option: " << cur_arg << std::endl;
+			return 1;
+		}
+	}
+
+	if (!WriteCreatureJson(params, argv[1]))
+	{
+		std::cerr << "Error: Could not write: " << argv[1] << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,304 @@
+//
+//  TestSamplerRoundTrip.cpp
+//  CreatureFlatData
+//
+//  Checks that keyframe reduction keeps what FlatDataPoseSampler plays back within its
+//  tolerance. Writes a synthetic character whose uv swap offsets move every frame,
+//  converts it with and without -reduce-uvswaps on both engines, and samples every clip
+//  of each file at fractional times, comparing the uv swaps of the reduced files to the
+//  full one. Then checks the other ways of playing the full file back against sampling
+//  it: the clips of -split and -split -compress containers must sample exactly the same
+//  poses, and every frame of its -bake file must match skinning the sampled pose within
+//  half a quantization step. Exits with 1 if any check fails.
+//  Build from the FlatData directory with:
+//    g++ -O2 -std=c++11 -pthread -I. Bench/TestSamplerRoundTrip.cpp ConvertFlatData.cpp ConvertFlatDataStream.cpp FlatDataWriter.cpp FlatDataCompress.cpp KeyframeReducer.cpp WorkStealingPool.cpp ConvertProfile.cpp FlatDataPose.cpp FlatDataLoader.cpp FlatDataClipLoader.cpp FlatDataSkinning.cpp FlatDataBakedPlayer.cpp BakeFlatData.cpp -o TestSamplerRoundTrip
+//
+
+#include <iostream>
+#include <cstdio>
+#include <cmath>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <unistd.h>
+#include <ConvertFlatData.h>
+#include <FlatDataLoader.h>
+#include <FlatDataClipLoader.h>
+#include <FlatDataPose.h>
+#include <FlatDataSkinning.h>
+#include <FlatDataBakedPlayer.h>
+#include <BakeFlatData.h>
+#include <Bench/CreatureJsonGenerator.h>
+
+// Returns the largest difference between the uv swaps of pose_in and expected_in, or a
+// huge value if a region's enabled flag differs
+static float
+CompareUVSwaps(const FlatDataPose& pose_in, const FlatDataPose& expected_in)
+{
+	float max_error = 0.0f;
+	for (size_t r = 0; r < expected_in.region_uv_swaps.size(); r++)
+	{
+		auto& cur_swap = pose_in.region_uv_swaps[r];
+		auto& expected_swap = expected_in.region_uv_swaps[r];
+		if (cur_swap.enabled != expected_swap.enabled)
+		{
+			return 1e30f;
+		}
+
+		for (int k = 0; k < 2; k++)
+		{
+			max_error = std::max(max_error, std::fabs(cur_swap.local_offset[k] - expected_swap.local_offset[k]));
+			max_error = std::max(max_error, std::fabs(cur_swap.global_offset[k] - expected_swap.global_offset[k]));
+			max_error = std::max(max_error, std::fabs(cur_swap.scale[k] - expected_swap.scale[k]));
+		}
+	}
+
+	return max_error;
+}
+
+// Samples every clip of both files steps_per_frame times a frame, returning the largest uv swap error
+static bool
+CompareFiles(const std::string& filename_in, const std::string& expected_filename_in,
+	int steps_per_frame, float& max_error_out)
+{
+	FlatDataLoader file_loader, expected_loader;
+	if (!file_loader.Open(filename_in, true) || !expected_loader.Open(expected_filename_in, true))
+	{
+		return false;
+	}
+
+	FlatDataPoseSampler sampler(file_loader.GetRootData()), expected_sampler(expected_loader.GetRootData());
+	FlatDataPose pose, expected_pose;
+	pose.Init(file_loader.GetRootData());
+	expected_pose.Init(expected_loader.GetRootData());
+
+	max_error_out = 0.0f;
+	for (int c = 0; c < expected_sampler.GetClipCount(); c++)
+	{
+		int start_time = 0, end_time = 0;
+		if (!expected_sampler.GetClipTimeRange(c, start_time, end_time))
+		{
+			continue;
+		}
+
+		for (int s = 0; s <= (end_time - start_time) * steps_per_frame; s++)
+		{
+			float cur_time = (float)start_time + (float)s / (float)steps_per_frame;
+			sampler.Sample(c, cur_time, pose);
+			expected_sampler.Sample(c, cur_time, expected_pose);
+			max_error_out = std::max(max_error_out, CompareUVSwaps(pose, expected_pose));
+		}
+	}
+
+	return true;
+}
+
+// Returns the largest difference between two float vectors, or a huge value if their sizes differ
+static float
+CompareValues(const std::vector<float>& values_in, const std::vector<float>& expected_in)
+{
+	if (values_in.size() != expected_in.size())
+	{
+		return 1e30f;
+	}
+
+	float max_error = 0.0f;
+	for (size_t i = 0; i < expected_in.size(); i++)
+	{
+		max_error = std::max(max_error, std::fabs(values_in[i] - expected_in[i]));
+	}
+
+	return max_error;
+}
+
+// Samples every clip of the split container filename_in through FlatDataClipLoader, and the
+// same clip of the full file, steps_per_frame times a frame, returning the largest difference
+// of the bones, displacements, opacities and uv swaps
+static bool
+CompareSplitFile(const std::string& filename_in, const std::string& expected_filename_in,
+	int steps_per_frame, float& max_error_out)
+{
+	FlatDataClipLoader clip_loader;
+	FlatDataLoader expected_loader;
+	if (!clip_loader.Open(filename_in, true) || !expected_loader.Open(expected_filename_in, true))
+	{
+		return false;
+	}
+
+	FlatDataPoseSampler sampler(clip_loader.GetRootData()), expected_sampler(expected_loader.GetRootData());
+	FlatDataPose pose, expected_pose;
+	pose.Init(clip_loader.GetRootData());
+	expected_pose.Init(expected_loader.GetRootData());
+	if (clip_loader.GetClipCount() != expected_sampler.GetClipCount())
+	{
+		return false;
+	}
+
+	max_error_out = 0.0f;
+	for (int c = 0; c < expected_sampler.GetClipCount(); c++)
+	{
+		auto expected_name = expected_loader.GetRootData()->dataAnimation()->clips()->Get(c)->name();
+		auto cur_clip = expected_name ? clip_loader.GetClip(expected_name->c_str()) : nullptr;
+		int start_time = 0, end_time = 0;
+		if (!cur_clip || !expected_sampler.GetClipTimeRange(c, start_time, end_time))
+		{
+			return false;
+		}
+
+		for (int s = 0; s <= (end_time - start_time) * steps_per_frame; s++)
+		{
+			float cur_time = (float)start_time + (float)s / (float)steps_per_frame;
+			sampler.Sample(cur_clip, cur_time, pose);
+			expected_sampler.Sample(c, cur_time, expected_pose);
+			max_error_out = std::max(max_error_out, CompareValues(pose.bone_positions, expected_pose.bone_positions));
+			max_error_out = std::max(max_error_out, CompareValues(pose.local_displacements, expected_pose.local_displacements));
+			max_error_out = std::max(max_error_out, CompareValues(pose.post_displacements, expected_pose.post_displacements));
+			max_error_out = std::max(max_error_out, CompareValues(pose.region_opacities, expected_pose.region_opacities));
+			max_error_out = std::max(max_error_out, CompareUVSwaps(pose, expected_pose));
+		}
+	}
+
+	return true;
+}
+
+// Plays every frame of the baked file filename_in and skins the same frame of the full file,
+// returning the largest point difference in units of the clip's quantization step
+static bool
+CompareBakedFile(const std::string& filename_in, const std::string& expected_filename_in,
+	float& max_steps_out)
+{
+	FlatDataLoader baked_loader, expected_loader;
+	if (!baked_loader.Open(filename_in, true) || !expected_loader.Open(expected_filename_in, true))
+	{
+		return false;
+	}
+
+	FlatDataBakedPlayer player(baked_loader.GetRootData());
+	FlatDataPoseSampler expected_sampler(expected_loader.GetRootData());
+	FlatDataSkinMesh skin_mesh;
+	FlatDataPose expected_pose;
+	expected_pose.Init(expected_loader.GetRootData());
+	if (!player.IsValid() || !skin_mesh.Init(expected_loader.GetRootData())
+		|| (player.GetClipCount() != expected_sampler.GetClipCount())
+		|| (player.GetPointCount() != skin_mesh.GetPointCount()))
+	{
+		return false;
+	}
+
+	std::vector<float> points(player.GetPointCount() * 2), expected_points(player.GetPointCount() * 2);
+	max_steps_out = 0.0f;
+	for (int c = 0; c < expected_sampler.GetClipCount(); c++)
+	{
+		auto baked_clip = baked_loader.GetRootData()->dataBakedAnimation()->clips()->Get(c);
+		int start_time = 0, end_time = 0;
+		if (!expected_sampler.GetClipTimeRange(c, start_time, end_time)
+			|| !baked_clip->bounds_extent() || (baked_clip->bounds_extent()->size() < 2))
+		{
+			return false;
+		}
+
+		float step[2] = {
+			std::max(baked_clip->bounds_extent()->Get(0) / 65535.0f, 1e-6f),
+			std::max(baked_clip->bounds_extent()->Get(1) / 65535.0f, 1e-6f)
+		};
+
+		for (int f = start_time; f <= end_time; f++)
+		{
+			expected_sampler.Sample(c, (float)f, expected_pose);
+			skin_mesh.Skin(expected_pose, expected_points.data());
+			if (!player.Sample(c, (float)f, points.data()))
+			{
+				return false;
+			}
+
+			for (size_t i = 0; i < points.size(); i++)
+			{
+				max_steps_out = std::max(max_steps_out, std::fabs(points[i] - expected_points[i]) / step[i & 1]);
+			}
+		}
+	}
+
+	return true;
+}
+
+int main() {
+	float tolerance = 0.001f;
+	CreatureJsonParams params;
+	params.bone_count = 8;
+	params.vertex_count = 200;
+	params.region_count = 4;
+	params.clip_count = 2;
+	params.frame_count = 120;
+	params.uv_offset_speed = 0.0002f;
+
+	std::string base_filename = "/tmp/test_sampler_round_trip_" + std::to_string(getpid());
+	std::string json_filename = base_filename + ".json";
+	std::string expected_filename = base_filename + "_full.fbb";
+	std::string reduced_filename = base_filename + "_reduced.fbb";
+	std::string split_filename = base_filename + "_split.fbb";
+	std::string baked_filename = base_filename + "_baked.fbb";
+	if (!WriteCreatureJson(params, json_filename))
+	{
+		std::cerr << "Error: Could not write: " << json_filename << std::endl;
+		return 1;
+	}
+
+	ConvertFlatDataOptions options;
+	options.verbose = false;
+	bool all_ok = ConvertToFlatData(json_filename, expected_filename, options);
+
+	for (int stream_parse = 0; all_ok && (stream_parse < 2); stream_parse++)
+	{
+		ConvertFlatDataOptions reduce_options;
+		reduce_options.verbose = false;
+		reduce_options.stream_parse = (stream_parse != 0);
+		reduce_options.reduce_uv_swaps_tolerance = tolerance;
+
+		float max_error = 0.0f;
+		bool cur_ok = ConvertToFlatData(json_filename, reduced_filename, reduce_options)
+			&& CompareFiles(reduced_filename, expected_filename, 4, max_error)
+			&& (max_error <= tolerance * 1.001f);
+
+		std::cout << (stream_parse ? "stream" : "dom") << " engine, uv swaps reduced within " << tolerance
+			<< ": max error " << max_error << (cur_ok ? " ok" : " FAILED") << std::endl;
+		all_ok &= cur_ok;
+	}
+
+	for (int compress = 0; all_ok && (compress < 2); compress++)
+	{
+		ConvertFlatDataOptions split_options;
+		split_options.verbose = false;
+		split_options.split_clips = true;
+		split_options.compress_clips = (compress != 0);
+
+		float max_error = 0.0f;
+		bool cur_ok = ConvertToFlatData(json_filename, split_filename, split_options)
+			&& CompareSplitFile(split_filename, expected_filename, 4, max_error)
+			&& (max_error == 0.0f);
+
+		std::cout << (compress ? "-split -compress" : "-split") << " clips sampled against the full file: max error "
+			<< max_error << (cur_ok ? " ok" : " FAILED") << std::endl;
+		all_ok &= cur_ok;
+	}
+
+	if (all_ok)
+	{
+		// The float rounding of the dequantize can push a point just past half a step
+		float max_steps = 0.0f;
+		bool cur_ok = BakeFlatDataFile(expected_filename, baked_filename, 0, false)
+			&& CompareBakedFile(baked_filename, expected_filename, max_steps)
+			&& (max_steps <= 0.51f);
+
+		std::cout << "baked frames played against skinning the full file: max error " << max_steps
+			<< " quantization steps" << (cur_ok ? " ok" : " FAILED") << std::endl;
+		all_ok &= cur_ok;
+	}
+
+	remove(json_filename.c_str());
+	remove(expected_filename.c_str());
+	remove(reduced_filename.c_str());
+	remove(split_filename.c_str());
+	remove(baked_filename.c_str());
+
+	return all_ok ? 0 : 1;
+}
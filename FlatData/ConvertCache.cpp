@@ -0,0 +1,217 @@
+#include <iostream>
+#include <cstdio>
+#include <cstring>
+#include <vector>
+#include <thread>
+#include <functional>
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+#include <ConvertCache.h>
+
+// Change whenever the converter writes different bytes for the same input and options,
+// so files cached by an older converter are never reused
+static const char * convert_cache_version = "CreatureFlatData CRFD converter 2";
+
+static const uint64_t hash_seed = 0xcbf29ce484222325ULL;
+static const uint64_t hash_prime = 0x100000001b3ULL;
+
+// FNV-1a over 8 byte words instead of single bytes, with a shift to mix the high bits down
+static inline uint64_t
+HashWord(uint64_t hash_in, uint64_t word_in)
+{
+	hash_in ^= word_in;
+	hash_in *= hash_prime;
+	return hash_in ^ (hash_in >> 29);
+}
+
+static uint64_t
+HashBytes(uint64_t hash_in, const char * data_in, size_t size_in)
+{
+	size_t word_count = size_in / 8;
+	for (size_t i = 0; i < word_count; i++)
+	{
+		uint64_t cur_word;
+		memcpy(&cur_word, data_in + i * 8, 8);
+		hash_in = HashWord(hash_in, cur_word);
+	}
+
+	uint64_t tail_word = 0;
+	memcpy(&tail_word, data_in + word_count * 8, size_in - word_count * 8);
+	return HashWord(hash_in, tail_word ^ ((uint64_t)size_in << 56));
+}
+
+ConvertCache::ConvertCache(const std::string& cache_dir_in)
+	: cache_dir(cache_dir_in),
+	hit_count(0),
+	miss_count(0),
+	store_count(0)
+{
+#ifdef _WIN32
+	_mkdir(cache_dir.c_str());
+#else
+	mkdir(cache_dir.c_str(), 0755);
+#endif
+}
+
+bool
+ConvertCache::HashFile(const std::string& filename_in, uint64_t& hash_out)
+{
+	FILE* fp = fopen(filename_in.c_str(), "rb");
+	if (!fp)
+	{
+		return false;
+	}
+
+	// Whole words per read so the hash does not depend on where reads split the file
+	std::vector<char> read_buffer(1 << 20);
+	uint64_t file_hash = hash_seed;
+	uint64_t file_size = 0;
+	size_t read_size = 0;
+	while ((read_size = fread(read_buffer.data(), 1, read_buffer.size(), fp)) == read_buffer.size())
+	{
+		for (size_t i = 0; i < read_size; i += 8)
+		{
+			uint64_t cur_word;
+			memcpy(&cur_word, read_buffer.data() + i, 8);
+			file_hash = HashWord(file_hash, cur_word);
+		}
+
+		file_size += read_size;
+	}
+
+	bool read_ok = !ferror(fp);
+	fclose(fp);
+
+	file_hash = HashBytes(file_hash, read_buffer.data(), read_size);
+	hash_out = HashWord(file_hash, file_size + read_size);
+
+	return read_ok;
+}
+
+uint64_t
+ConvertCache::HashOptions(const ConvertFlatDataOptions& options, uint64_t hash_in)
+{
+	// Only the options that change the written bytes. parse_insitu, thread_count and
+	// verbose do not. The engines agree but are keyed apart in case they ever differ.
+	const float tolerances[] = {
+		options.reduce_bones_tolerance,
+		options.reduce_meshes_tolerance,
+		options.reduce_uv_swaps_tolerance,
+		options.reduce_mesh_opacities_tolerance
+	};
+
+	hash_in = HashBytes(hash_in, convert_cache_version, strlen(convert_cache_version));
+	hash_in = HashBytes(hash_in, (const char *)tolerances, sizeof(tolerances));
+	hash_in = HashWord(hash_in, (uint64_t)options.format_version);
+	hash_in = HashWord(hash_in, (uint64_t)options.quantize_bits);
+	hash_in = HashWord(hash_in, (uint64_t)options.delta_interval);
+	hash_in = HashWord(hash_in,
+		(options.stream_parse ? 1 : 0)
+		| (options.dense_bone_tracks ? 2 : 0)
+		| (options.sparse_displacements ? 4 : 0)
+		| (options.parallel_clips ? 8 : 0)
+		| (options.split_clips ? 16 : 0)
+		| (options.compress_clips ? 32 : 0));
+
+	return hash_in;
+}
+
+bool
+ConvertCache::CopyCacheFile(const std::string& src_filename, const std::string& dst_filename)
+{
+	FILE* src_fp = fopen(src_filename.c_str(), "rb");
+	if (!src_fp)
+	{
+		return false;
+	}
+
+	remove(dst_filename.c_str());
+	FILE* dst_fp = fopen(dst_filename.c_str(), "wb");
+	if (!dst_fp)
+	{
+		fclose(src_fp);
+		return false;
+	}
+
+	std::vector<char> copy_buffer(1 << 20);
+	size_t read_size = 0;
+	bool copy_ok = true;
+	while (copy_ok && ((read_size = fread(copy_buffer.data(), 1, copy_buffer.size(), src_fp)) > 0))
+	{
+		copy_ok = (fwrite(copy_buffer.data(), 1, read_size, dst_fp) == read_size);
+	}
+
+	copy_ok = copy_ok && !ferror(src_fp);
+	fclose(src_fp);
+	copy_ok = (fclose(dst_fp) == 0) && copy_ok;
+
+	return copy_ok;
+}
+
+bool
+ConvertCache::Convert(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options,
+	bool& cache_hit_out)
+{
+	cache_hit_out = false;
+
+	uint64_t input_hash = 0;
+	if (!HashFile(json_filename_in, input_hash))
+	{
+		std::cerr << "Error: Could not open Input Creature JSON: " << json_filename_in << std::endl;
+		miss_count++;
+		return false;
+	}
+
+	char key_name[17];
+	snprintf(key_name, sizeof(key_name), "%016llx", (unsigned long long)HashOptions(options, input_hash));
+	std::string cached_filename = cache_dir + "/" + key_name + ".fbb";
+
+	if (CopyCacheFile(cached_filename, flat_filename_out))
+	{
+		cache_hit_out = true;
+		hit_count++;
+		if (options.verbose)
+		{
+			std::cout << "Copied cached Flat Binary File " << cached_filename << " to: " << flat_filename_out << std::endl;
+		}
+
+		return true;
+	}
+
+	miss_count++;
+	if (!ConvertToFlatData(json_filename_in, flat_filename_out, options))
+	{
+		return false;
+	}
+
+	// Stored through a temporary file renamed into place, so a reader never copies
+	// a partly written file and concurrent stores of the same key do not interleave
+	std::string temp_filename = cached_filename + "."
+		+ std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id())) + ".tmp";
+	if (CopyCacheFile(flat_filename_out, temp_filename))
+	{
+		remove(cached_filename.c_str());
+		if (rename(temp_filename.c_str(), cached_filename.c_str()) == 0)
+		{
+			store_count++;
+		}
+	}
+
+	remove(temp_filename.c_str());
+
+	return true;
+}
+
+void
+ConvertCache::PrintStats() const
+{
+	int lookup_count = hit_count + miss_count;
+	std::cout << "Conversion cache " << cache_dir << ": " << hit_count << " hits, " << miss_count
+		<< " misses (" << (lookup_count > 0 ? 100 * hit_count / lookup_count : 0) << "% hit rate), "
+		<< store_count << " files stored" << std::endl;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+#include <atomic>
+#include <cstdint>
+#include <ConvertFlatData.h>
+
+// An on disk cache of converted Creature FlatData files. Each file is stored
+// under a key hashing the input Creature JSON bytes, the converter version and
+// the options that change the output, so an unchanged input is copied from the
+// cache instead of being converted again. Safe to share between threads.
+class ConvertCache
+{
+public:
+	// Creates cache_dir_in if it does not exist
+	ConvertCache(const std::string& cache_dir_in);
+
+	// Converts json_filename_in unless its key is cached, in which case the cached
+	// file is copied to flat_filename_out. cache_hit_out tells which happened.
+	bool Convert(const std::string& json_filename_in,
+		const std::string& flat_filename_out,
+		const ConvertFlatDataOptions& options,
+		bool& cache_hit_out);
+
+	void PrintStats() const;
+
+private:
+	// Hashes the file bytes, returning false if it cannot be read
+	static bool HashFile(const std::string& filename_in, uint64_t& hash_out);
+
+	static uint64_t HashOptions(const ConvertFlatDataOptions& options, uint64_t hash_in);
+
+	static bool CopyCacheFile(const std::string& src_filename, const std::string& dst_filename);
+
+	std::string cache_dir;
+	std::atomic<int> hit_count, miss_count, store_count;
+};
@@ -5,188 +5,183 @@
 #include <cstdio>
 #include <string>
 #include <vector>
+#include <memory>
+#include <algorithm>
 #include <rapidjson/filereadstream.h>
 #include <CreatureFlatData_generated.h>
 #include <flatbuffers.h>
 #include <ConvertFlatData.h>
+#include <FlatDataWriter.h>
+#include <KeyframeReducer.h>
+#include <WorkStealingPool.h>
+#include <ConvertProfile.h>
 
 // This reads in a Creature JSON File
-void
+bool
 ReadCreatureJson(const std::string& filename_in, rapidjson::Document& doc)
 {
 	FILE* fp = fopen(filename_in.c_str(), "rb"); // non-Windows use "r"
+	if (!fp)
+	{
+		std::cerr << "Error: Could not open Input Creature JSON: " << filename_in << std::endl;
+		return false;
+	}
+
 	char readBuffer[65536];
 	rapidjson::FileReadStream is(fp, readBuffer, sizeof(readBuffer));
 	doc.ParseStream(is);
 	fclose(fp);
+
+	return !doc.HasParseError();
 }
 
-static std::vector<float>
-GetFloatArray(rapidjson::Value& array_in)
+// Reads the whole Creature JSON File with a single read into buffer_out,
+// zero terminated so it can be parsed in place
+bool
+ReadCreatureJsonBuffer(const std::string& filename_in, std::vector<char>& buffer_out)
 {
-	std::vector<float> ret_array(array_in.Size());
-	for (int i = 0; i < array_in.Size(); i++)
+	FILE* fp = fopen(filename_in.c_str(), "rb");
+	if (!fp)
 	{
-		ret_array[i] = (float)array_in[i].GetDouble();
+		std::cerr << "Error: Could not open Input Creature JSON: " << filename_in << std::endl;
+		return false;
 	}
 
-	return ret_array;
-}
+	long file_size = -1;
+	if (fseek(fp, 0, SEEK_END) == 0)
+	{
+		file_size = ftell(fp);
+	}
 
-static std::vector<int>
-GetIntArray(rapidjson::Value& array_in)
-{
-	std::vector<int> ret_array(array_in.Size());
-	for (int i = 0; i < array_in.Size(); i++)
+	if ((file_size < 0) || ((size_t)file_size >= buffer_out.max_size()) || (fseek(fp, 0, SEEK_SET) != 0))
 	{
-		ret_array[i] = (int)array_in[i].GetInt();
+		std::cerr << "Error: Could not get the size of Input Creature JSON: " << filename_in << std::endl;
+		fclose(fp);
+		return false;
 	}
 
-	return ret_array;
+	buffer_out.resize((size_t)file_size + 1);
+	size_t read_size = fread(buffer_out.data(), 1, (size_t)file_size, fp);
+	fclose(fp);
+
+	if (read_size != (size_t)file_size)
+	{
+		std::cerr << "Error: Could not read Input Creature JSON: " << filename_in << std::endl;
+		return false;
+	}
+
+	buffer_out[read_size] = '\0';
+
+	return true;
 }
 
-// Converts an input Creature JSON into a Creature FlatData Binary file
-bool ConvertToFlatData(const std::string& json_filename_in,
-	const std::string& flat_filename_out)
+// This reads in a Creature JSON File with a single read into insitu_buffer and
+// parses it in place. The strings in doc reference insitu_buffer directly
+// so the buffer must outlive doc.
+bool
+ReadCreatureJsonInsitu(const std::string& filename_in, rapidjson::Document& doc,
+	std::vector<char>& insitu_buffer)
 {
-	rapidjson::Document read_doc;
-	ReadCreatureJson(json_filename_in, read_doc);
-
-	if ((!read_doc.HasMember("mesh")) || (!read_doc.HasMember("skeleton"))
-		|| (!read_doc.HasMember("animation")))
+	if (!ReadCreatureJsonBuffer(filename_in, insitu_buffer))
 	{
-		std::cerr << "Error: Invalid Input Creature JSON!" << std::endl;
 		return false;
 	}
 
-	flatbuffers::FlatBufferBuilder fbb;
-
-	auto& mesh_obj = read_doc["mesh"];
-	auto& skeleton_obj = read_doc["skeleton"];
-	auto& animation_obj = read_doc["animation"];
+	doc.ParseInsitu(insitu_buffer.data());
 
-	// ----------- Process Mesh ----------------------
+	return !doc.HasParseError();
+}
 
-	auto& mesh_points = mesh_obj["points"];
-	auto& mesh_uvs = mesh_obj["uvs"];
-	auto& mesh_indices = mesh_obj["indices"];
-	auto& mesh_regions = mesh_obj["regions"];
+// Decides which time samples of a clip section are kept by keyframe reduction
+static std::vector<bool>
+GetKeptFrames(rapidjson::Value& section_obj,
+	const ConvertFlatDataOptions& options,
+	KeyframeSection section,
+	KeyframeReduceStats& reduce_stats)
+{
+	float tolerance = GetKeyframeReduceTolerance(options, section);
+	if (tolerance < 0.0f)
+	{
+		return std::vector<bool>(section_obj.MemberCount(), true);
+	}
 
-	auto read_mesh_points = GetFloatArray(mesh_points);
-	auto read_uv_points = GetFloatArray(mesh_uvs);
-	auto read_indices = GetIntArray(mesh_indices);
+	KeyframeReducer reducer(tolerance, section);
+	for (rapidjson::Value::MemberIterator c_itr = section_obj.MemberBegin();
+	c_itr != section_obj.MemberEnd();
+		++c_itr)
+	{
+		reducer.AddFrame(atoi(c_itr->name.GetString()), c_itr->value);
+	}
 
-	std::vector<flatbuffers::Offset<CreatureFlatData::meshRegion> > mesh_region_list;
+	reducer.Finish();
 
+	std::vector<bool> kept_frames(reducer.decisions.begin(), reducer.decisions.end());
+	for (size_t i = 0; i < kept_frames.size(); i++)
 	{
-		// Mesh Regions
-		for (rapidjson::Value::MemberIterator itr = mesh_regions.MemberBegin();
-		itr != mesh_regions.MemberEnd();
-			++itr)
+		if (kept_frames[i])
+		{
+			reduce_stats.kept[section]++;
+		}
+		else
 		{
-			auto& curMesh = itr->value;
+			reduce_stats.dropped[section]++;
+		}
+	}
 
-			// Bone Weights
-			auto& read_bone_weights = curMesh["weights"];
-			std::vector<flatbuffers::Offset<CreatureFlatData::meshRegionBone> > bone_weights_list;
+	return kept_frames;
+}
 
-			for (rapidjson::Value::MemberIterator w_itr = read_bone_weights.MemberBegin();
-			w_itr != read_bone_weights.MemberEnd();
-				++w_itr)
+// Writes one animation clip of the input with writer
+static flatbuffers::Offset<CreatureFlatData::animationClip>
+WriteClip(FlatDataWriter& writer,
+	const char * anim_name,
+	rapidjson::Value& anim_obj_val,
+	const ConvertFlatDataOptions& options,
+	KeyframeReduceStats& reduce_stats)
+{
+	auto& anim_bone_val = anim_obj_val["bones"];
+	auto& anim_mesh_val = anim_obj_val["meshes"];
+	auto& anim_uv_swap_val = anim_obj_val["uv_swaps"];
+	auto& anim_mesh_opacity_val = anim_obj_val["mesh_opacities"];
+
+	ConvertProfileScope reduce_scope(options.profile, "keyframe_reduce", anim_name);
+	auto kept_bone_frames = GetKeptFrames(anim_bone_val, options, KEYFRAME_BONES, reduce_stats);
+	auto kept_mesh_frames = GetKeptFrames(anim_mesh_val, options, KEYFRAME_MESHES, reduce_stats);
+	auto kept_uv_swap_frames = GetKeptFrames(anim_uv_swap_val, options, KEYFRAME_UV_SWAPS, reduce_stats);
+	auto kept_mesh_opacity_frames = GetKeptFrames(anim_mesh_opacity_val, options, KEYFRAME_MESH_OPACITIES, reduce_stats);
+	reduce_scope.End();
+
+	// Animation Bones
+	ConvertProfileScope bones_scope(options.profile, "bones", anim_name);
+	flatbuffers::Offset<CreatureFlatData::animationBonesList> flat_animation_bone_list_loc;
+	flatbuffers::Offset<CreatureFlatData::animationBonesTrack> flat_animation_bones_track_loc;
+
+	if (writer.UseBonesTrack())
+	{
+		for (rapidjson::Value::MemberIterator c_itr = anim_bone_val.MemberBegin();
+		c_itr != anim_bone_val.MemberEnd();
+			++c_itr)
+		{
+			if (!kept_bone_frames[c_itr - anim_bone_val.MemberBegin()])
 			{
-				CreatureFlatData::meshRegionBoneBuilder flat_mesh_region_bone(fbb);
-				auto write_name = fbb.CreateString(w_itr->name.GetString());
-
-				auto& bone_weights = read_bone_weights[w_itr->name.GetString()];
-				auto write_weights = fbb.CreateVector(GetFloatArray(bone_weights));
-
-				flat_mesh_region_bone.add_name(write_name);
-				flat_mesh_region_bone.add_weights(write_weights);
-
-				bone_weights_list.push_back(flat_mesh_region_bone.Finish());
+				continue;
 			}
 
-			CreatureFlatData::meshRegionBuilder flat_mesh_region(fbb);
-			auto write_mesh_region_name = fbb.CreateString(itr->name.GetString());
-			auto write_mesh_region_weights_list = fbb.CreateVector(bone_weights_list);
-
-			flat_mesh_region.add_name(write_mesh_region_name);
-			flat_mesh_region.add_start_pt_index(curMesh["start_pt_index"].GetInt());
-			flat_mesh_region.add_end_pt_index(curMesh["end_pt_index"].GetInt());
-			flat_mesh_region.add_start_index(curMesh["start_index"].GetInt());
-			flat_mesh_region.add_end_index(curMesh["end_index"].GetInt());
-			flat_mesh_region.add_id(curMesh["id"].GetInt());
-			flat_mesh_region.add_weights(write_mesh_region_weights_list);
+			writer.BeginBonesTrackTimeSample(atoi(c_itr->name.GetString()));
 
-			mesh_region_list.push_back(flat_mesh_region.Finish());
+			auto& sub_objs = c_itr->value;
+			for (rapidjson::Value::MemberIterator s_itr = sub_objs.MemberBegin();
+			s_itr != sub_objs.MemberEnd();
+				++s_itr)
+			{
+				writer.AddBonesTrackBone(s_itr->name.GetString(), s_itr->value);
+			}
 		}
-	}
-
-	auto write_read_mesh_points = fbb.CreateVector(read_mesh_points);
-	auto write_read_indices = fbb.CreateVector(read_indices);
-	auto write_read_uv_points = fbb.CreateVector(read_uv_points);
-	auto write_mesh_region_list = fbb.CreateVector(mesh_region_list);
-
-	CreatureFlatData::meshBuilder flat_mesh(fbb);
-
-	flat_mesh.add_points(write_read_mesh_points);
-	flat_mesh.add_indices(write_read_indices);
-	flat_mesh.add_uvs(write_read_uv_points);
-	flat_mesh.add_regions(write_mesh_region_list);
-	auto flat_mesh_loc = flat_mesh.Finish();
-
 
-	// ----------- Process Skeleton -------------------
-
-	std::vector<flatbuffers::Offset<CreatureFlatData::skeletonBone> > skeleton_bone_list;
-
-	for (rapidjson::Value::MemberIterator itr = skeleton_obj.MemberBegin();
-	itr != skeleton_obj.MemberEnd();
-		++itr)
-	{
-		CreatureFlatData::skeletonBoneBuilder flat_skeleton_bone(fbb);
-		auto& cur_val = itr->value;
-
-		auto write_bone_name = fbb.CreateString(itr->name.GetString());
-		auto write_restParentMat = fbb.CreateVector(GetFloatArray(cur_val["restParentMat"]));
-		auto write_localRestStartPt = fbb.CreateVector(GetFloatArray(cur_val["localRestStartPt"]));
-		auto write_localRestEndPt = fbb.CreateVector(GetFloatArray(cur_val["localRestEndPt"]));
-		auto write_children = fbb.CreateVector(GetIntArray(cur_val["children"]));
-
-		flat_skeleton_bone.add_name(write_bone_name);
-		flat_skeleton_bone.add_id(cur_val["id"].GetInt());
-		flat_skeleton_bone.add_restParentMat(write_restParentMat);
-		flat_skeleton_bone.add_localRestStartPt(write_localRestStartPt);
-		flat_skeleton_bone.add_localRestEndPt(write_localRestEndPt);
-		flat_skeleton_bone.add_children(write_children);
-
-		skeleton_bone_list.push_back(flat_skeleton_bone.Finish());
+		flat_animation_bones_track_loc = writer.WriteBonesTrack();
 	}
-
-	auto write_skeleton_bone_list = fbb.CreateVector(skeleton_bone_list);
-	CreatureFlatData::skeletonBuilder flat_skeleton(fbb);
-
-	flat_skeleton.add_bones(write_skeleton_bone_list);
-	auto flat_skeleton_loc = flat_skeleton.Finish();
-
-
-	// ----------- Process Animations -----------------
-
-	std::vector<flatbuffers::Offset<CreatureFlatData::animationClip> >
-		animation_clip_list;
-
-	for (rapidjson::Value::MemberIterator itr = animation_obj.MemberBegin();
-	itr != animation_obj.MemberEnd();
-		++itr)
+	else
 	{
-		auto anim_name = itr->name.GetString();
-		auto& anim_obj_val = itr->value;
-		auto& anim_bone_val = anim_obj_val["bones"];
-		auto& anim_mesh_val = anim_obj_val["meshes"];
-		auto& anim_uv_swap_val = anim_obj_val["uv_swaps"];
-		auto& anim_mesh_opacity_val = anim_obj_val["mesh_opacities"];
-
-		// Animation Bones
 		std::vector<flatbuffers::Offset<CreatureFlatData::animationBonesTimeSample> >
 			animation_bone_time_sample_list;
 
@@ -194,6 +189,11 @@ bool ConvertToFlatData(const std::string& json_filename_in,
 		c_itr != anim_bone_val.MemberEnd();
 			++c_itr)
 		{
+			if (!kept_bone_frames[c_itr - anim_bone_val.MemberBegin()])
+			{
+				continue;
+			}
+
 			int cur_time = atoi(c_itr->name.GetString());
 
 			std::vector<flatbuffers::Offset<CreatureFlatData::animationBone> > animation_bone_list;
@@ -203,37 +203,48 @@ bool ConvertToFlatData(const std::string& json_filename_in,
 			s_itr != sub_objs.MemberEnd();
 				++s_itr)
 			{
-				auto bone_name = s_itr->name.GetString();
-				auto& cur_obj = s_itr->value;
+				animation_bone_list.push_back(writer.WriteAnimationBone(s_itr->name.GetString(), s_itr->value));
+			}
+
+			animation_bone_time_sample_list.push_back(
+				writer.WriteAnimationBonesTimeSample(cur_time, animation_bone_list));
+		}
 
-				CreatureFlatData::animationBoneBuilder flat_animation_bone(fbb);
+		flat_animation_bone_list_loc = writer.WriteAnimationBonesList(animation_bone_time_sample_list);
+	}
 
-				auto write_bone_name = fbb.CreateString(bone_name);
-				auto write_bone_start_pt = fbb.CreateVector(GetFloatArray(cur_obj["start_pt"]));
-				auto write_bone_end_pt = fbb.CreateVector(GetFloatArray(cur_obj["end_pt"]));
+	bones_scope.End();
 
-				flat_animation_bone.add_name(write_bone_name);
-				flat_animation_bone.add_start_pt(write_bone_start_pt);
-				flat_animation_bone.add_end_pt(write_bone_end_pt);
+	// Animation Meshes
+	ConvertProfileScope meshes_scope(options.profile, "meshes", anim_name);
+	flatbuffers::Offset<CreatureFlatData::animationMeshList> flat_animation_mesh_list_loc;
 
-				animation_bone_list.push_back(flat_animation_bone.Finish());
+	if (writer.UseMeshTrack())
+	{
+		for (rapidjson::Value::MemberIterator c_itr = anim_mesh_val.MemberBegin();
+		c_itr != anim_mesh_val.MemberEnd();
+			++c_itr)
+		{
+			if (!kept_mesh_frames[c_itr - anim_mesh_val.MemberBegin()])
+			{
+				continue;
 			}
 
-			auto write_animation_bone_list = fbb.CreateVector(animation_bone_list);
+			writer.BeginMeshTrackTimeSample(atoi(c_itr->name.GetString()));
 
-			CreatureFlatData::animationBonesTimeSampleBuilder flat_animation_bone_time_sample(fbb);
-			flat_animation_bone_time_sample.add_time(cur_time);
-			flat_animation_bone_time_sample.add_bones(write_animation_bone_list);
-
-			animation_bone_time_sample_list.push_back(flat_animation_bone_time_sample.Finish());
+			auto& sub_objs = c_itr->value;
+			for (rapidjson::Value::MemberIterator s_itr = sub_objs.MemberBegin();
+			s_itr != sub_objs.MemberEnd();
+				++s_itr)
+			{
+				writer.AddMeshTrackSample(s_itr->name.GetString(), s_itr->value);
+			}
 		}
 
-		auto write_animation_bone_sample_list = fbb.CreateVector(animation_bone_time_sample_list);
-		CreatureFlatData::animationBonesListBuilder flat_animation_bone_list(fbb);
-		flat_animation_bone_list.add_timeSamples(write_animation_bone_sample_list);
-		auto flat_animation_bone_list_loc = flat_animation_bone_list.Finish();
-
-		// Animation Meshes
+		flat_animation_mesh_list_loc = writer.WriteMeshTrack();
+	}
+	else
+	{
 		std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshTimeSample> >
 			animation_mesh_time_sample_list;
 
@@ -241,6 +252,11 @@ bool ConvertToFlatData(const std::string& json_filename_in,
 		c_itr != anim_mesh_val.MemberEnd();
 			++c_itr)
 		{
+			if (!kept_mesh_frames[c_itr - anim_mesh_val.MemberBegin()])
+			{
+				continue;
+			}
+
 			int cur_time = atoi(c_itr->name.GetString());
 
 			std::vector<flatbuffers::Offset<CreatureFlatData::animationMesh> > animation_mesh_list;
@@ -250,252 +266,351 @@ bool ConvertToFlatData(const std::string& json_filename_in,
 			s_itr != sub_objs.MemberEnd();
 				++s_itr)
 			{
-				auto mesh_name = s_itr->name.GetString();
-				auto& cur_obj = s_itr->value;
-
-				auto write_mesh_name = fbb.CreateString(mesh_name);
-				flatbuffers::Offset<flatbuffers::Vector<float>> write_local_displacements, write_post_displacements;
-
-				if (cur_obj.HasMember("local_displacements"))
-				{
-					write_local_displacements = fbb.CreateVector(GetFloatArray(cur_obj["local_displacements"]));
-				}
-
-				if (cur_obj.HasMember("post_displacements"))
-				{
-					write_post_displacements = fbb.CreateVector(GetFloatArray(cur_obj["post_displacements"]));
-				}
-
-				CreatureFlatData::animationMeshBuilder flat_animation_mesh(fbb);
-				flat_animation_mesh.add_name(write_mesh_name);
-				flat_animation_mesh.add_use_dq(cur_obj["use_dq"].GetBool());
-				flat_animation_mesh.add_use_local_displacements(cur_obj["use_local_displacements"].GetBool());
-				flat_animation_mesh.add_use_post_displacements(cur_obj["use_post_displacements"].GetBool());
-
-				if (cur_obj.HasMember("local_displacements"))
-				{
-					flat_animation_mesh.add_local_displacements(write_local_displacements);
-				}
-
-				if (cur_obj.HasMember("post_displacements"))
-				{
-					flat_animation_mesh.add_post_displacements(write_post_displacements);
-				}
-
-				animation_mesh_list.push_back(flat_animation_mesh.Finish());
+				animation_mesh_list.push_back(writer.WriteAnimationMesh(s_itr->name.GetString(), s_itr->value));
 			}
 
-			auto write_animation_mesh_list = fbb.CreateVector(animation_mesh_list);
+			animation_mesh_time_sample_list.push_back(
+				writer.WriteAnimationMeshTimeSample(cur_time, animation_mesh_list));
+		}
+
+		flat_animation_mesh_list_loc = writer.WriteAnimationMeshList(animation_mesh_time_sample_list);
+	}
 
-			CreatureFlatData::animationMeshTimeSampleBuilder flat_animation_mesh_time_sample(fbb);
-			flat_animation_mesh_time_sample.add_time(cur_time);
-			flat_animation_mesh_time_sample.add_meshes(write_animation_mesh_list);
+	meshes_scope.End();
 
-			animation_mesh_time_sample_list.push_back(flat_animation_mesh_time_sample.Finish());
+	/// Animation UV Swaps
+	ConvertProfileScope uv_swaps_scope(options.profile, "uv_swaps", anim_name);
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwapTimeSample> >
+		animation_uv_swap_time_sample_list;
+
+	for (rapidjson::Value::MemberIterator c_itr = anim_uv_swap_val.MemberBegin();
+	c_itr != anim_uv_swap_val.MemberEnd();
+		++c_itr)
+	{
+		if (!kept_uv_swap_frames[c_itr - anim_uv_swap_val.MemberBegin()])
+		{
+			continue;
 		}
 
-		auto write_animation_mesh_time_sample_list = fbb.CreateVector(animation_mesh_time_sample_list);
-		CreatureFlatData::animationMeshListBuilder flat_animation_mesh_list(fbb);
-		flat_animation_mesh_list.add_timeSamples(write_animation_mesh_time_sample_list);
-		auto flat_animation_mesh_list_loc = flat_animation_mesh_list.Finish();
+		int cur_time = atoi(c_itr->name.GetString());
 
-		/// Animation UV Swaps
-		std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwapTimeSample> >
-			animation_uv_swap_time_sample_list;
+		std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwap> > animation_uv_swap_list;
 
-		for (rapidjson::Value::MemberIterator c_itr = anim_uv_swap_val.MemberBegin();
-		c_itr != anim_uv_swap_val.MemberEnd();
-			++c_itr)
+		auto& sub_objs = c_itr->value;
+		for (rapidjson::Value::MemberIterator s_itr = sub_objs.MemberBegin();
+		s_itr != sub_objs.MemberEnd();
+			++s_itr)
 		{
-			int cur_time = atoi(c_itr->name.GetString());
+			animation_uv_swap_list.push_back(writer.WriteAnimationUVSwap(s_itr->name.GetString(), s_itr->value));
+		}
 
-			std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwap> > animation_uv_swap_list;
+		animation_uv_swap_time_sample_list.push_back(
+			writer.WriteAnimationUVSwapTimeSample(cur_time, animation_uv_swap_list));
+	}
 
-			auto& sub_objs = c_itr->value;
-			for (rapidjson::Value::MemberIterator s_itr = sub_objs.MemberBegin();
-			s_itr != sub_objs.MemberEnd();
-				++s_itr)
-			{
-				auto uv_swap_name = s_itr->name.GetString();
-				auto& cur_obj = s_itr->value;
-
-				auto write_uv_swap_name = fbb.CreateString(uv_swap_name);
-				auto write_local_offset = fbb.CreateVector(GetFloatArray(cur_obj["local_offset"]));
-				auto write_global_offset = fbb.CreateVector(GetFloatArray(cur_obj["global_offset"]));
-				auto write_scale = fbb.CreateVector(GetFloatArray(cur_obj["scale"]));
-
-				CreatureFlatData::animationUVSwapBuilder flat_animation_uv_swap(fbb);
-				flat_animation_uv_swap.add_name(write_uv_swap_name);
-				flat_animation_uv_swap.add_local_offset(write_local_offset);
-				flat_animation_uv_swap.add_global_offset(write_global_offset);
-				flat_animation_uv_swap.add_scale(write_scale);
-				flat_animation_uv_swap.add_enabled(cur_obj["enabled"].GetBool());
-
-				animation_uv_swap_list.push_back(flat_animation_uv_swap.Finish());
-			}
+	auto flat_animation_uv_swap_list_loc = writer.WriteAnimationUVSwapList(animation_uv_swap_time_sample_list);
+	uv_swaps_scope.End();
 
-			auto write_animation_uv_swap_list = fbb.CreateVector(animation_uv_swap_list);
-			CreatureFlatData::animationUVSwapTimeSampleBuilder flat_animation_uv_swap_time_sample(fbb);
-			flat_animation_uv_swap_time_sample.add_time(cur_time);
-			flat_animation_uv_swap_time_sample.add_uvSwaps(write_animation_uv_swap_list);
+	// Animation Mesh Opacities
+	ConvertProfileScope mesh_opacities_scope(options.profile, "mesh_opacities", anim_name);
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacityTimeSample> >
+		animation_mesh_opacity_time_sample_list;
 
-			animation_uv_swap_time_sample_list.push_back(flat_animation_uv_swap_time_sample.Finish());
+	for (rapidjson::Value::MemberIterator c_itr = anim_mesh_opacity_val.MemberBegin();
+	c_itr != anim_mesh_opacity_val.MemberEnd();
+		++c_itr)
+	{
+		if (!kept_mesh_opacity_frames[c_itr - anim_mesh_opacity_val.MemberBegin()])
+		{
+			continue;
 		}
 
-		auto write_animation_uv_swap_time_sample_list = fbb.CreateVector(animation_uv_swap_time_sample_list);
-		CreatureFlatData::animationUVSwapListBuilder flat_animation_uv_swap_list(fbb);
-		flat_animation_uv_swap_list.add_timeSamples(write_animation_uv_swap_time_sample_list);
-		auto flat_animation_uv_swap_list_loc = flat_animation_uv_swap_list.Finish();
+		int cur_time = atoi(c_itr->name.GetString());
 
-		// Animation Mesh Opacities
-		std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacityTimeSample> >
-			animation_mesh_opacity_time_sample_list;
+		std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacity> > animation_mesh_opacity_list;
 
-		for (rapidjson::Value::MemberIterator c_itr = anim_mesh_opacity_val.MemberBegin();
-		c_itr != anim_mesh_opacity_val.MemberEnd();
-			++c_itr)
+		auto& sub_objs = c_itr->value;
+		for (rapidjson::Value::MemberIterator s_itr = sub_objs.MemberBegin();
+		s_itr != sub_objs.MemberEnd();
+			++s_itr)
 		{
-			int cur_time = atoi(c_itr->name.GetString());
-
-			std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacity> > animation_mesh_opacity_list;
+			animation_mesh_opacity_list.push_back(writer.WriteAnimationMeshOpacity(s_itr->name.GetString(), s_itr->value));
+		}
 
-			auto& sub_objs = c_itr->value;
-			for (rapidjson::Value::MemberIterator s_itr = sub_objs.MemberBegin();
-			s_itr != sub_objs.MemberEnd();
-				++s_itr)
-			{
-				auto mesh_opacity_name = s_itr->name.GetString();
-				auto& cur_obj = s_itr->value;
+		animation_mesh_opacity_time_sample_list.push_back(
+			writer.WriteAnimationMeshOpacityTimeSample(cur_time, animation_mesh_opacity_list));
+	}
 
-				auto write_mesh_opacity_name = fbb.CreateString(mesh_opacity_name);
+	auto flat_animation_mesh_opacity_list_loc = writer.WriteAnimationMeshOpacityList(animation_mesh_opacity_time_sample_list);
+	mesh_opacities_scope.End();
 
-				CreatureFlatData::animationMeshOpacityBuilder flat_animation_mesh_opacity(fbb);
-				flat_animation_mesh_opacity.add_name(write_mesh_opacity_name);
-				flat_animation_mesh_opacity.add_opacity((float)cur_obj["opacity"].GetDouble());
+	// Create Animation Clip
+	return writer.WriteAnimationClip(anim_name,
+		flat_animation_bone_list_loc,
+		flat_animation_mesh_list_loc,
+		flat_animation_uv_swap_list_loc,
+		flat_animation_mesh_opacity_list_loc,
+		flat_animation_bones_track_loc);
+}
 
-				animation_mesh_opacity_list.push_back(flat_animation_mesh_opacity.Finish());
-			}
+// Converts an input Creature JSON into a Creature FlatData Binary file
+bool ConvertToFlatData(const std::string& json_filename_in,
+	const std::string& flat_filename_out)
+{
+	return ConvertToFlatData(json_filename_in, flat_filename_out, ConvertFlatDataOptions());
+}
 
-			auto write_animation_mesh_opacity_list = fbb.CreateVector(animation_mesh_opacity_list);
-			CreatureFlatData::animationMeshOpacityTimeSampleBuilder flat_animation_opacity_time_sample(fbb);
-			flat_animation_opacity_time_sample.add_time(cur_time);
-			flat_animation_opacity_time_sample.add_meshOpacities(write_animation_mesh_opacity_list);
+// Sums the times of the conversion whose stages start at first_stage of profile_in
+static ConvertFlatDataTimes
+GetConvertFlatDataTimes(const ConvertProfile& profile_in, size_t first_stage)
+{
+	// Only the stages of the whole file, clip stages overlap them and each other
+	ConvertFlatDataTimes ret_times;
+	double total_s = 0.0;
+	auto stages = profile_in.GetStages();
+	for (size_t i = first_stage; i < stages.size(); i++)
+	{
+		auto& cur_stage = stages[i];
+		if (!cur_stage.clip_name.empty())
+		{
+			continue;
+		}
 
-			animation_mesh_opacity_time_sample_list.push_back(flat_animation_opacity_time_sample.Finish());
+		if (cur_stage.name == "total")
+		{
+			total_s = cur_stage.wall_s;
+		}
+		else if (cur_stage.name == "parse")
+		{
+			ret_times.parse_s = cur_stage.wall_s;
+		}
+		else if (cur_stage.name == "serialize")
+		{
+			ret_times.write_s = cur_stage.wall_s;
 		}
+	}
 
-		auto write_animation_mesh_opacity_time_sample_list = fbb.CreateVector(animation_mesh_opacity_time_sample_list);
-		CreatureFlatData::animationMeshOpacityListBuilder flat_animation_mesh_opacity_list(fbb);
-		flat_animation_mesh_opacity_list.add_timeSamples(write_animation_mesh_opacity_time_sample_list);
-		auto flat_animation_mesh_opacity_list_loc = flat_animation_mesh_opacity_list.Finish();
-
-		// Create Animation Clip
-		auto write_anim_name = fbb.CreateString(anim_name);
-		CreatureFlatData::animationClipBuilder flat_animation_clip(fbb);
-		flat_animation_clip.add_name(write_anim_name);
-		flat_animation_clip.add_bones(flat_animation_bone_list_loc);
-		flat_animation_clip.add_meshes(flat_animation_mesh_list_loc);
-		flat_animation_clip.add_uvSwaps(flat_animation_uv_swap_list_loc);
-		flat_animation_clip.add_meshOpacities(flat_animation_mesh_opacity_list_loc);
-
-		animation_clip_list.push_back(flat_animation_clip.Finish());
+	ret_times.build_s = std::max(total_s - ret_times.parse_s - ret_times.write_s, 0.0);
+	return ret_times;
+}
+
+bool ConvertToFlatData(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options,
+	ConvertFlatDataTimes& times_out)
+{
+	// The times are read back from the profile's stages, a local one if the caller has none
+	ConvertProfile local_profile;
+	ConvertFlatDataOptions timed_options = options;
+	if (!timed_options.profile)
+	{
+		timed_options.profile = &local_profile;
 	}
 
-	// Create Animation
-	auto write_animation_clip_list = fbb.CreateVector(animation_clip_list);
-	CreatureFlatData::animationBuilder flat_animation(fbb);
-	flat_animation.add_clips(write_animation_clip_list);
-	auto flat_animation_loc = flat_animation.Finish();
+	size_t first_stage = timed_options.profile->GetStages().size();
+	bool convert_ok = ConvertToFlatData(json_filename_in, flat_filename_out, timed_options);
+	times_out = GetConvertFlatDataTimes(*timed_options.profile, first_stage);
+	return convert_ok;
+}
 
-	// uv swap items
-	auto& uv_swap_items_obj = read_doc["uv_swap_items"];
+bool ConvertToFlatData(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options)
+{
+	if (options.stream_parse)
+	{
+		return ConvertToFlatDataStream(json_filename_in, flat_filename_out, options);
+	}
 
-	std::vector<flatbuffers::Offset<CreatureFlatData::uvSwapItemMesh>> item_meshes;
-	for (rapidjson::Value::MemberIterator cur_itr = uv_swap_items_obj.MemberBegin();
-	cur_itr != uv_swap_items_obj.MemberEnd();
-		++cur_itr)
+	ConvertProfileScope total_scope(options.profile, "total");
+	ConvertProfileScope parse_scope(options.profile, "parse");
+	rapidjson::Document read_doc;
+	std::vector<char> insitu_buffer;
+	bool read_ok = options.parse_insitu ?
+		ReadCreatureJsonInsitu(json_filename_in, read_doc, insitu_buffer) :
+		ReadCreatureJson(json_filename_in, read_doc);
+
+	parse_scope.SetJsonPoolBytes(read_doc.GetAllocator().Capacity() + read_doc.GetStackCapacity());
+	parse_scope.End();
+
+	if (!read_ok || !read_doc.IsObject()
+		|| (!read_doc.HasMember("mesh")) || (!read_doc.HasMember("skeleton"))
+		|| (!read_doc.HasMember("animation")))
 	{
-		auto mesh_name = cur_itr->name.GetString();
-		auto& mesh_data = cur_itr->value;
+		std::cerr << "Error: Invalid Input Creature JSON!" << std::endl;
+		return false;
+	}
 
-		std::vector<flatbuffers::Offset<CreatureFlatData::uvSwapItemData>> item_list;
+	flatbuffers::FlatBufferBuilder fbb;
+	FlatDataWriter writer(fbb, options);
 
-		for (int i = 0; i < mesh_data.Size(); i++)
-		{
-			CreatureFlatData::uvSwapItemDataBuilder flat_uv_swap_item_data(fbb);
+	auto& mesh_obj = read_doc["mesh"];
+	auto& skeleton_obj = read_doc["skeleton"];
+	auto& animation_obj = read_doc["animation"];
 
-			auto& m_obj = mesh_data[i];
-			auto write_local_offset = fbb.CreateVector(GetFloatArray(m_obj["local_offset"]));
-			auto write_global_offset = fbb.CreateVector(GetFloatArray(m_obj["global_offset"]));
-			auto write_scale = fbb.CreateVector(GetFloatArray(m_obj["scale"]));
+	// ----------- Process Mesh ----------------------
+	ConvertProfileScope mesh_scope(options.profile, "mesh");
 
-			flat_uv_swap_item_data.add_local_offset(write_local_offset);
-			flat_uv_swap_item_data.add_global_offset(write_global_offset);
-			flat_uv_swap_item_data.add_scale(write_scale);
-			flat_uv_swap_item_data.add_tag(m_obj["tag"].GetInt());
+	auto& mesh_points = mesh_obj["points"];
+	auto& mesh_uvs = mesh_obj["uvs"];
+	auto& mesh_indices = mesh_obj["indices"];
+	auto& mesh_regions = mesh_obj["regions"];
 
-			item_list.push_back(flat_uv_swap_item_data.Finish());
-		}
+	std::vector<flatbuffers::Offset<CreatureFlatData::meshRegion> > mesh_region_list;
 
-		auto write_mesh_name = fbb.CreateString(mesh_name);
-		auto write_item_list = fbb.CreateVector(item_list);
+	for (rapidjson::Value::MemberIterator itr = mesh_regions.MemberBegin();
+	itr != mesh_regions.MemberEnd();
+		++itr)
+	{
+		mesh_region_list.push_back(writer.WriteMeshRegion(itr->name.GetString(), itr->value));
+	}
+
+	auto flat_mesh_loc = writer.WriteMesh(mesh_points, mesh_uvs, mesh_indices, mesh_region_list);
+	mesh_scope.End();
 
+	// ----------- Process Skeleton -------------------
+	ConvertProfileScope skeleton_scope(options.profile, "skeleton");
 
-		CreatureFlatData::uvSwapItemMeshBuilder flat_uv_swap_item_mesh(fbb);
-		flat_uv_swap_item_mesh.add_name(write_mesh_name);
-		flat_uv_swap_item_mesh.add_items(write_item_list);
+	std::vector<flatbuffers::Offset<CreatureFlatData::skeletonBone> > skeleton_bone_list;
 
-		item_meshes.push_back(flat_uv_swap_item_mesh.Finish());
+	for (rapidjson::Value::MemberIterator itr = skeleton_obj.MemberBegin();
+	itr != skeleton_obj.MemberEnd();
+		++itr)
+	{
+		skeleton_bone_list.push_back(writer.WriteSkeletonBone(itr->name.GetString(), itr->value));
 	}
 
-	CreatureFlatData::uvSwapItemHolderBuilder flat_uv_swap_item_holder(fbb);
-	auto write_item_meshes = fbb.CreateVector(item_meshes);
-	flat_uv_swap_item_holder.add_meshes(write_item_meshes);
-	auto flat_uv_swap_loc = flat_uv_swap_item_holder.Finish();
+	auto flat_skeleton_loc = writer.WriteSkeleton(skeleton_bone_list);
+	skeleton_scope.End();
 
+	// ----------- Process Animations -----------------
 
-	// anchor points
-	auto& anchor_points_obj = read_doc["anchor_points_items"]["AnchorPoints"];
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationClip> >
+		animation_clip_list;
+	KeyframeReduceStats reduce_stats;
 
-	std::vector<flatbuffers::Offset<CreatureFlatData::anchorPointData>> anchor_list;
-	for (int i = 0; i < anchor_points_obj.Size(); i++)
+	std::vector<std::string> split_clip_names;
+	std::vector<std::unique_ptr<flatbuffers::FlatBufferBuilder> > split_clip_fbbs;
+
+	if (options.parallel_clips || options.split_clips)
 	{
-		CreatureFlatData::anchorPointDataBuilder flat_anchor_point_data_builder(fbb);
+		// Each clip is built into its own builder by the pool, then spliced into
+		// fbb in input order so the output does not depend on the thread count
+		struct ClipBuild
+		{
+			std::unique_ptr<flatbuffers::FlatBufferBuilder> fbb;
+			std::unique_ptr<FlatDataWriter> writer;
+			flatbuffers::Offset<CreatureFlatData::animationClip> clip_loc;
+			KeyframeReduceStats reduce_stats;
+		};
 
-		auto& anchor_obj = anchor_points_obj[i];
-		auto write_point = fbb.CreateVector(GetFloatArray(anchor_obj["point"]));
-		auto write_anim_clip_name = fbb.CreateString(anchor_obj["anim_clip_name"].GetString());
+		std::vector<ClipBuild> clip_builds(animation_obj.MemberCount());
+		{
+			WorkStealingPool clip_pool(options.parallel_clips ? options.thread_count : 1);
+			size_t clip_index = 0;
+			for (rapidjson::Value::MemberIterator itr = animation_obj.MemberBegin();
+			itr != animation_obj.MemberEnd();
+				++itr, ++clip_index)
+			{
+				ClipBuild * cur_build = &clip_builds[clip_index];
+				clip_pool.Submit([cur_build, itr, &writer, &options]() {
+					cur_build->fbb.reset(new flatbuffers::FlatBufferBuilder);
+					cur_build->writer.reset(new FlatDataWriter(*cur_build->fbb, options, writer));
+					cur_build->clip_loc = WriteClip(*cur_build->writer, itr->name.GetString(), itr->value,
+						options, cur_build->reduce_stats);
+				});
+			}
 
-		flat_anchor_point_data_builder.add_point(write_point);
-		flat_anchor_point_data_builder.add_anim_clip_name(write_anim_clip_name);
+			clip_pool.Wait();
+		}
 
-		anchor_list.push_back(flat_anchor_point_data_builder.Finish());
+		ConvertProfileScope splice_scope(options.profile, "splice_clips");
+		rapidjson::Value::MemberIterator name_itr = animation_obj.MemberBegin();
+		for (auto& cur_build : clip_builds)
+		{
+			const char * cur_name = (name_itr++)->name.GetString();
+			writer.MergeStats(*cur_build.writer);
+			reduce_stats.Add(cur_build.reduce_stats);
+			if (options.split_clips)
+			{
+				// Each clip becomes a rootData of its own, holding an animation of just that clip
+				split_clip_names.push_back(cur_name);
+				split_clip_fbbs.emplace_back(new flatbuffers::FlatBufferBuilder);
+				FlatDataWriter chunk_writer(*split_clip_fbbs.back(), options, writer);
+				std::vector<flatbuffers::Offset<CreatureFlatData::animationClip> > chunk_clips(1,
+					chunk_writer.SpliceAnimationClip(cur_name, *cur_build.fbb, cur_build.clip_loc));
+				chunk_writer.WriteRoot(0, 0, chunk_writer.WriteAnimation(chunk_clips), 0, 0);
+
+				// The clip's writer refers to its builder, so both go together
+				cur_build.writer.reset();
+				cur_build.fbb.reset();
+			}
+			else
+			{
+				animation_clip_list.push_back(writer.SpliceAnimationClip(cur_name,
+					*cur_build.fbb, cur_build.clip_loc));
+			}
+		}
+	}
+	else
+	{
+		for (rapidjson::Value::MemberIterator itr = animation_obj.MemberBegin();
+		itr != animation_obj.MemberEnd();
+			++itr)
+		{
+			animation_clip_list.push_back(WriteClip(writer, itr->name.GetString(), itr->value,
+				options, reduce_stats));
+		}
 	}
 
-	CreatureFlatData::anchorPointsHolderBuilder flat_anchor_point_holder_builder(fbb);
-	auto write_anchor_list = fbb.CreateVector(anchor_list);
-	flat_anchor_point_holder_builder.add_anchorPoints(write_anchor_list);
-	auto flat_anchor_loc = flat_anchor_point_holder_builder.Finish();
+	// Create Animation, which split files keep in the clip chunks instead
+	flatbuffers::Offset<CreatureFlatData::animation> flat_animation_loc = 0;
+	if (!options.split_clips)
+	{
+		ConvertProfileScope animation_scope(options.profile, "animation");
+		flat_animation_loc = writer.WriteAnimation(animation_clip_list);
+	}
 
-	// ------- Root Data -------------- //
-	CreatureFlatData::rootDataBuilder flat_root(fbb);
-	flat_root.add_dataSkeleton(flat_skeleton_loc);
-	flat_root.add_dataMesh(flat_mesh_loc);
-	flat_root.add_dataAnimation(flat_animation_loc);
-	flat_root.add_dataUvSwapItem(flat_uv_swap_loc);
-	flat_root.add_dataAnchorPoints(flat_anchor_loc);
+	// uv swap items
+	ConvertProfileScope uv_swap_items_scope(options.profile, "uv_swap_items");
+	auto& uv_swap_items_obj = read_doc["uv_swap_items"];
+
+	std::vector<flatbuffers::Offset<CreatureFlatData::uvSwapItemMesh>> item_meshes;
+	for (rapidjson::Value::MemberIterator cur_itr = uv_swap_items_obj.MemberBegin();
+	cur_itr != uv_swap_items_obj.MemberEnd();
+		++cur_itr)
+	{
+		item_meshes.push_back(writer.WriteUVSwapItemMesh(cur_itr->name.GetString(), cur_itr->value));
+	}
 
-	auto flat_root_loc = flat_root.Finish();
+	auto flat_uv_swap_loc = writer.WriteUVSwapItemHolder(item_meshes);
+	uv_swap_items_scope.End();
 
-	CreatureFlatData::FinishrootDataBuffer(fbb, flat_root_loc);
+	// anchor points
+	ConvertProfileScope anchor_points_scope(options.profile, "anchor_points");
+	auto flat_anchor_loc = writer.WriteAnchorPointsHolder(read_doc["anchor_points_items"]["AnchorPoints"]);
+	anchor_points_scope.End();
 
-	// ---- Serialize to Disk ------------- //
-	remove(flat_filename_out.c_str());
-	std::ofstream ofile(flat_filename_out.c_str(), std::ios::binary);
-	ofile.write((char *)fbb.GetBufferPointer(), fbb.GetSize());
-	ofile.close();
+	// ------- Root Data -------------- //
+	ConvertProfileScope root_scope(options.profile, "root");
+	writer.WriteRoot(flat_mesh_loc, flat_skeleton_loc, flat_animation_loc, flat_uv_swap_loc, flat_anchor_loc);
+	root_scope.End();
+	if (options.verbose)
+	{
+		writer.PrintQuantizeReport();
+		writer.PrintSparseReport();
+		if (UseKeyframeReduce(options))
+		{
+			reduce_stats.Print();
+		}
+	}
 
-	std::cout << "Serialized Flat Binary File to: " << flat_filename_out << " with file size of: " << fbb.GetSize() << " bytes." << std::endl;
+	// ---- Serialize to Disk ------------- //
+	ConvertProfileScope serialize_scope(options.profile, "serialize");
+	bool write_ok = options.split_clips ?
+		WriteFlatDataContainer(fbb, split_clip_names, split_clip_fbbs, flat_filename_out,
+			options.compress_clips, options.verbose) :
+		WriteFlatDataFile(fbb, flat_filename_out, options.verbose);
 
-	return true;
-}
\ No newline at end of file
+	return write_ok;
+}
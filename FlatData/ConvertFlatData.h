@@ -1,5 +1,140 @@
 #pragma once
 
+class ConvertProfile;
+
+// Options controlling how ConvertToFlatData reads and writes its data
+struct ConvertFlatDataOptions
+{
+	ConvertFlatDataOptions()
+		: parse_insitu(false),
+		stream_parse(false),
+		format_version(2),
+		dense_bone_tracks(false),
+		quantize_bits(0),
+		delta_interval(0),
+		reduce_bones_tolerance(-1.0f),
+		reduce_meshes_tolerance(-1.0f),
+		reduce_uv_swaps_tolerance(-1.0f),
+		reduce_mesh_opacities_tolerance(-1.0f),
+		sparse_displacements(true),
+		parallel_clips(false),
+		thread_count(0),
+		split_clips(false),
+		compress_clips(false),
+		verbose(true),
+		profile(nullptr)
+	{
+	}
+
+	// Reads the whole input with a single read and parses it in place,
+	// referencing strings from the read buffer instead of copying them
+	bool parse_insitu;
+
+	// Converts with the streaming SAX engine instead of building a full DOM
+	bool stream_parse;
+
+	// Layout of the written file. Version 2 references bones and regions from
+	// the animation samples by their index in the skeleton and mesh tables,
+	// Version 1 writes the legacy name keyed samples
+	int format_version;
+
+	// Writes each clip's bone keyframes as one dense animationBonesTrack
+	// instead of the per sample animationBonesList. Needs format version 2.
+	bool dense_bone_tracks;
+
+	// If non zero, writes bone positions and mesh displacements as 16 bit
+	// fixed point values of this many bits against per clip ranges.
+	// Bone positions are quantized in the dense bones track, so this
+	// also turns on dense_bone_tracks. Needs format version 2.
+	int quantize_bits;
+
+	// If non zero, delta encodes consecutive keyframe rows of the float dense bones
+	// tracks, keeping every delta_interval-th row whole so a sample is rebuilt from at
+	// most this many rows. The rows are no smaller, only more compressible. Quantized
+	// tracks and mesh lists are written without deltas, which compress worse than their
+	// values. Turns on dense_bone_tracks. Needs format version 2.
+	int delta_interval;
+
+	// Drops the time samples of a clip section that linear interpolation of
+	// the kept neighbouring samples reproduces within the tolerance, for
+	// every number in them. A negative tolerance keeps every sample.
+	float reduce_bones_tolerance;
+	float reduce_meshes_tolerance;
+	float reduce_uv_swaps_tolerance;
+	float reduce_mesh_opacities_tolerance;
+
+	// Writes each float displacements vector as its non zero runs when
+	// that is smaller than the dense vector. Needs format version 2.
+	bool sparse_displacements;
+
+	// Converts the animation clips on a pool of thread_count threads, one
+	// builder per clip, spliced into the file in input order. The output is
+	// the same for any thread count. Not used by the streaming engine.
+	bool parallel_clips;
+
+	// Threads used by parallel conversion, 0 for one per hardware core
+	int thread_count;
+
+	// Writes a clip container instead of a single rootData buffer: a directory,
+	// a base chunk without the animation and one chunk per clip, so clips can be
+	// loaded one at a time by FlatDataClipLoader. Builds each clip in its own
+	// builder as parallel_clips does. Not used by the streaming engine.
+	bool split_clips;
+
+	// Stores each clip chunk of a split container compressed with the block LZ
+	// codec of FlatDataCompress. Turns on split_clips.
+	bool compress_clips;
+
+	// Prints the written file size and conversion reports
+	bool verbose;
+
+	// If set, records the wall time and allocations of each conversion stage into
+	// profile. Does not change the output, so it is not part of the cache hash.
+	ConvertProfile * profile;
+};
+
+// Wall times of the stages of a conversion, in seconds, summed from its ConvertProfile stages
+struct ConvertFlatDataTimes
+{
+	ConvertFlatDataTimes()
+		: parse_s(0.0),
+		build_s(0.0),
+		write_s(0.0)
+	{
+	}
+
+	// Reading and parsing the input. The streaming engine builds as it parses,
+	// so it counts all of its parsing as build time.
+	double parse_s;
+
+	// Writing the tables into the builders
+	double build_s;
+
+	// Writing the finished file to disk
+	double write_s;
+};
+
 // Converts an input Creature JSON into a Creature FlatData Binary file
 bool ConvertToFlatData(const std::string& json_filename_in,
-	const std::string& flat_filename_out);
\ No newline at end of file
+	const std::string& flat_filename_out);
+
+bool ConvertToFlatData(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options);
+
+bool ConvertToFlatData(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options,
+	ConvertFlatDataTimes& times_out);
+
+// Converts an input Creature JSON into a Creature FlatData Binary file by
+// streaming SAX events, emitting tables as the keyframes are read.
+// Only one keyframe object is held in memory at a time.
+bool ConvertToFlatDataStream(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options);
+
+bool ConvertToFlatDataStream(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options,
+	ConvertFlatDataTimes& times_out);
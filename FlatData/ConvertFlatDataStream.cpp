@@ -0,0 +1,934 @@
+#include <iostream>
+#include <fstream>
+#include <rapidjson/rapidjson.h>
+#include <rapidjson/document.h>
+#include <rapidjson/reader.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <rapidjson/filereadstream.h>
+#include <CreatureFlatData_generated.h>
+#include <flatbuffers.h>
+#include <ConvertFlatData.h>
+#include <FlatDataWriter.h>
+#include <KeyframeReducer.h>
+#include <ConvertProfile.h>
+
+// Builds a single rapidjson::Value from the SAX events of one captured part of the input
+class JsonValueCapture
+{
+public:
+	JsonValueCapture()
+		: allocator(nullptr), done(false)
+	{
+	}
+
+	~JsonValueCapture()
+	{
+		Reset();
+	}
+
+	void Begin(rapidjson::Document::AllocatorType& allocator_in)
+	{
+		Reset();
+		allocator = &allocator_in;
+		done = false;
+	}
+
+	bool IsDone() const { return done; }
+
+	rapidjson::Value& GetValue() { return result; }
+
+	bool Null() { rapidjson::Value val; return AddValue(val); }
+	bool Bool(bool b) { rapidjson::Value val(b); return AddValue(val); }
+	bool Int(int i) { rapidjson::Value val(i); return AddValue(val); }
+	bool Uint(unsigned u) { rapidjson::Value val(u); return AddValue(val); }
+	bool Int64(int64_t i) { rapidjson::Value val(i); return AddValue(val); }
+	bool Uint64(uint64_t u) { rapidjson::Value val(u); return AddValue(val); }
+	bool Double(double d) { rapidjson::Value val(d); return AddValue(val); }
+
+	bool String(const char * str, rapidjson::SizeType length, bool)
+	{
+		rapidjson::Value val(str, length, *allocator);
+		return AddValue(val);
+	}
+
+	bool Key(const char * str, rapidjson::SizeType length, bool)
+	{
+		keys.back().assign(str, length);
+		return true;
+	}
+
+	bool StartObject()
+	{
+		containers.push_back(new rapidjson::Value(rapidjson::kObjectType));
+		keys.push_back(std::string());
+		return true;
+	}
+
+	bool EndObject(rapidjson::SizeType)
+	{
+		return EndContainer();
+	}
+
+	bool StartArray()
+	{
+		containers.push_back(new rapidjson::Value(rapidjson::kArrayType));
+		keys.push_back(std::string());
+		return true;
+	}
+
+	bool EndArray(rapidjson::SizeType)
+	{
+		return EndContainer();
+	}
+
+private:
+	bool EndContainer()
+	{
+		rapidjson::Value * cur_container = containers.back();
+		containers.pop_back();
+		keys.pop_back();
+
+		bool ok = AddValue(*cur_container);
+		delete cur_container;
+
+		return ok;
+	}
+
+	bool AddValue(rapidjson::Value& val)
+	{
+		if (containers.empty())
+		{
+			result = val;
+			done = true;
+			return true;
+		}
+
+		rapidjson::Value& parent = *containers.back();
+		if (parent.IsArray())
+		{
+			parent.PushBack(val, *allocator);
+		}
+		else
+		{
+			const std::string& cur_key = keys.back();
+			rapidjson::Value key_val(cur_key.c_str(), (rapidjson::SizeType)cur_key.length(), *allocator);
+			parent.AddMember(key_val, val, *allocator);
+		}
+
+		return true;
+	}
+
+	void Reset()
+	{
+		for (size_t i = 0; i < containers.size(); i++)
+		{
+			delete containers[i];
+		}
+
+		containers.clear();
+		keys.clear();
+		result.SetNull();
+	}
+
+	rapidjson::Document::AllocatorType * allocator;
+	std::vector<rapidjson::Value *> containers;
+	std::vector<std::string> keys;
+	rapidjson::Value result;
+	bool done;
+};
+
+// Receives the SAX events of a Creature JSON File and emits the FlatData tables as soon
+// as each part of the input is complete. Only the leaf objects (a mesh region, a skeleton bone,
+// one bone/mesh/uv swap/opacity keyframe) are captured into small rapidjson values;
+// everything above them is tracked as the offsets needed for the parent vectors.
+// When keyframe reduction is on, whole time samples are captured instead and held
+// until the reducer decides whether they are kept.
+class CreatureJsonStreamHandler
+	: public rapidjson::BaseReaderHandler<rapidjson::UTF8<>, CreatureJsonStreamHandler>
+{
+public:
+	CreatureJsonStreamHandler(FlatDataWriter& writer_in, const ConvertFlatDataOptions& options_in)
+		: writer(writer_in),
+		options(options_in),
+		root_started(false), root_done(false),
+		capture_active(false), skip_depth(0),
+		cur_section(SECTION_NONE),
+		bones_dense(false),
+		meshes_track(false),
+		has_mesh(false), has_skeleton(false), has_animation(false),
+		has_uv_swap_items(false), has_anchor_points(false)
+	{
+	}
+
+	bool IsComplete() const
+	{
+		return root_done && has_mesh && has_skeleton && has_animation;
+	}
+
+	bool Null() { return OnValue(false, [&](JsonValueCapture& c) { return c.Null(); }); }
+	bool Bool(bool b) { return OnValue(false, [&](JsonValueCapture& c) { return c.Bool(b); }); }
+	bool Int(int i) { return OnValue(false, [&](JsonValueCapture& c) { return c.Int(i); }); }
+	bool Uint(unsigned u) { return OnValue(false, [&](JsonValueCapture& c) { return c.Uint(u); }); }
+	bool Int64(int64_t i) { return OnValue(false, [&](JsonValueCapture& c) { return c.Int64(i); }); }
+	bool Uint64(uint64_t u) { return OnValue(false, [&](JsonValueCapture& c) { return c.Uint64(u); }); }
+	bool Double(double d) { return OnValue(false, [&](JsonValueCapture& c) { return c.Double(d); }); }
+
+	bool String(const char * str, rapidjson::SizeType length, bool copy)
+	{
+		return OnValue(false, [&](JsonValueCapture& c) { return c.String(str, length, copy); });
+	}
+
+	bool Key(const char * str, rapidjson::SizeType length, bool copy)
+	{
+		if (capture_active)
+		{
+			return capture.Key(str, length, copy);
+		}
+
+		if (skip_depth == 0)
+		{
+			cur_key.assign(str, length);
+		}
+
+		return true;
+	}
+
+	bool StartObject()
+	{
+		if (!capture_active && (skip_depth == 0))
+		{
+			if (!root_started)
+			{
+				root_started = true;
+				return true;
+			}
+
+			if (GetPathAction() == PATH_DESCEND)
+			{
+				path.push_back(cur_key);
+				BeginContainer();
+				return true;
+			}
+		}
+
+		return OnValue(true, [&](JsonValueCapture& c) { return c.StartObject(); });
+	}
+
+	bool EndObject(rapidjson::SizeType member_count)
+	{
+		if (capture_active)
+		{
+			return OnCaptureEvent(capture.EndObject(member_count));
+		}
+
+		if (skip_depth > 0)
+		{
+			skip_depth--;
+			return true;
+		}
+
+		if (path.empty())
+		{
+			root_done = true;
+			return true;
+		}
+
+		EndContainer();
+		path.pop_back();
+
+		return true;
+	}
+
+	bool StartArray()
+	{
+		return OnValue(true, [&](JsonValueCapture& c) { return c.StartArray(); });
+	}
+
+	bool EndArray(rapidjson::SizeType element_count)
+	{
+		if (capture_active)
+		{
+			return OnCaptureEvent(capture.EndArray(element_count));
+		}
+
+		if (skip_depth > 0)
+		{
+			skip_depth--;
+		}
+
+		return true;
+	}
+
+	// Writes the root table once the whole input has been read
+	void WriteRoot()
+	{
+		if (!has_uv_swap_items)
+		{
+			uv_swap_loc = writer.WriteUVSwapItemHolder(item_meshes);
+		}
+
+		if (!has_anchor_points)
+		{
+			rapidjson::Value empty_anchor_points(rapidjson::kArrayType);
+			anchor_loc = writer.WriteAnchorPointsHolder(empty_anchor_points);
+		}
+
+		writer.WriteRoot(mesh_loc, skeleton_loc, animation_loc, uv_swap_loc, anchor_loc);
+		if (options.verbose)
+		{
+			writer.PrintQuantizeReport();
+			writer.PrintSparseReport();
+			if (UseKeyframeReduce(options))
+			{
+				reduce_stats.Print();
+			}
+		}
+	}
+
+private:
+	enum PathAction
+	{
+		PATH_DESCEND,
+		PATH_CAPTURE,
+		PATH_SKIP
+	};
+
+	enum AnimationSection
+	{
+		SECTION_NONE,
+		SECTION_BONES,
+		SECTION_MESHES,
+		SECTION_UV_SWAPS,
+		SECTION_MESH_OPACITIES
+	};
+
+	// Decides what to do with the value at path + cur_key
+	PathAction GetPathAction() const
+	{
+		size_t depth = path.size();
+		if (depth == 0)
+		{
+			if ((cur_key == "mesh") || (cur_key == "skeleton") || (cur_key == "animation")
+				|| (cur_key == "uv_swap_items") || (cur_key == "anchor_points_items"))
+			{
+				return PATH_DESCEND;
+			}
+
+			return PATH_SKIP;
+		}
+
+		const std::string& top_key = path[0];
+		if (top_key == "mesh")
+		{
+			if (depth == 1)
+			{
+				if ((cur_key == "points") || (cur_key == "uvs") || (cur_key == "indices"))
+				{
+					return PATH_CAPTURE;
+				}
+				else if (cur_key == "regions")
+				{
+					return PATH_DESCEND;
+				}
+			}
+			else if (depth == 2)
+			{
+				return PATH_CAPTURE;
+			}
+		}
+		else if (top_key == "skeleton")
+		{
+			if (depth == 1)
+			{
+				return PATH_CAPTURE;
+			}
+		}
+		else if (top_key == "animation")
+		{
+			if (depth == 1)
+			{
+				return PATH_DESCEND;
+			}
+			else if (depth == 3)
+			{
+				return section_reducer ? PATH_CAPTURE : PATH_DESCEND;
+			}
+			else if (depth == 2)
+			{
+				return (GetSection(cur_key) != SECTION_NONE) ? PATH_DESCEND : PATH_SKIP;
+			}
+			else if (depth == 4)
+			{
+				return PATH_CAPTURE;
+			}
+		}
+		else if (top_key == "uv_swap_items")
+		{
+			if (depth == 1)
+			{
+				return PATH_CAPTURE;
+			}
+		}
+		else if (top_key == "anchor_points_items")
+		{
+			if ((depth == 1) && (cur_key == "AnchorPoints"))
+			{
+				return PATH_CAPTURE;
+			}
+		}
+
+		return PATH_SKIP;
+	}
+
+	static AnimationSection GetSection(const std::string& key)
+	{
+		if (key == "bones")
+		{
+			return SECTION_BONES;
+		}
+		else if (key == "meshes")
+		{
+			return SECTION_MESHES;
+		}
+		else if (key == "uv_swaps")
+		{
+			return SECTION_UV_SWAPS;
+		}
+		else if (key == "mesh_opacities")
+		{
+			return SECTION_MESH_OPACITIES;
+		}
+
+		return SECTION_NONE;
+	}
+
+	template <typename CaptureEvent>
+	bool OnValue(bool starts_container, CaptureEvent capture_event)
+	{
+		if (capture_active)
+		{
+			return OnCaptureEvent(capture_event(capture));
+		}
+
+		if (skip_depth > 0)
+		{
+			if (starts_container)
+			{
+				skip_depth++;
+			}
+
+			return true;
+		}
+
+		if (root_started && (GetPathAction() == PATH_CAPTURE))
+		{
+			bool keep_mesh_data = (path.size() == 1) && (path[0] == "mesh");
+			if ((path.size() == 3) && (path[0] == "animation"))
+			{
+				// A whole time sample for the keyframe reducer
+				PendingFrame new_frame;
+				new_frame.time = atoi(cur_key.c_str());
+				new_frame.doc.reset(new rapidjson::Document);
+				pending_frames.push_back(std::move(new_frame));
+				capture.Begin(pending_frames.back().doc->GetAllocator());
+			}
+			else
+			{
+				capture.Begin(keep_mesh_data ? mesh_data_doc.GetAllocator() : item_doc.GetAllocator());
+			}
+			capture_active = true;
+			return OnCaptureEvent(capture_event(capture));
+		}
+
+		if (starts_container)
+		{
+			skip_depth = 1;
+		}
+
+		return true;
+	}
+
+	bool OnCaptureEvent(bool ok)
+	{
+		if (ok && capture.IsDone())
+		{
+			capture_active = false;
+			OnCaptured(capture.GetValue());
+		}
+
+		return ok;
+	}
+
+	// A leaf object at path + cur_key has been read completely
+	void OnCaptured(rapidjson::Value& value)
+	{
+		const std::string& top_key = path[0];
+		const char * item_name = cur_key.c_str();
+
+		if (top_key == "mesh")
+		{
+			if (path.size() == 1)
+			{
+				if (cur_key == "points")
+				{
+					mesh_points = value;
+				}
+				else if (cur_key == "uvs")
+				{
+					mesh_uvs = value;
+				}
+				else if (cur_key == "indices")
+				{
+					mesh_indices = value;
+				}
+
+				return;
+			}
+
+			mesh_region_list.push_back(writer.WriteMeshRegion(item_name, value));
+		}
+		else if (top_key == "skeleton")
+		{
+			skeleton_bone_list.push_back(writer.WriteSkeletonBone(item_name, value));
+		}
+		else if (top_key == "animation")
+		{
+			if (path.size() == 3)
+			{
+				OnFrameCaptured(value);
+				return;
+			}
+
+			WriteSectionItem(item_name, value);
+		}
+		else if (top_key == "uv_swap_items")
+		{
+			item_meshes.push_back(writer.WriteUVSwapItemMesh(item_name, value));
+		}
+		else if (top_key == "anchor_points_items")
+		{
+			anchor_loc = writer.WriteAnchorPointsHolder(value);
+			has_anchor_points = true;
+		}
+
+		value.SetNull();
+		item_doc.GetAllocator().Clear();
+	}
+
+	// Writes one bone/mesh/uv swap/opacity keyframe of the current time sample
+	void WriteSectionItem(const char * item_name, rapidjson::Value& value)
+	{
+		switch (cur_section)
+		{
+		case SECTION_BONES:
+			if (bones_dense)
+			{
+				writer.AddBonesTrackBone(item_name, value);
+			}
+			else
+			{
+				animation_bone_list.push_back(writer.WriteAnimationBone(item_name, value));
+			}
+			break;
+		case SECTION_MESHES:
+			if (meshes_track)
+			{
+				writer.AddMeshTrackSample(item_name, value);
+			}
+			else
+			{
+				animation_mesh_list.push_back(writer.WriteAnimationMesh(item_name, value));
+			}
+			break;
+		case SECTION_UV_SWAPS:
+			animation_uv_swap_list.push_back(writer.WriteAnimationUVSwap(item_name, value));
+			break;
+		case SECTION_MESH_OPACITIES:
+			animation_mesh_opacity_list.push_back(writer.WriteAnimationMeshOpacity(item_name, value));
+			break;
+		default:
+			break;
+		}
+	}
+
+	// A whole time sample has been captured for the keyframe reducer
+	void OnFrameCaptured(rapidjson::Value& value)
+	{
+		PendingFrame& cur_frame = pending_frames.back();
+		rapidjson::Value& frame_value = *cur_frame.doc;
+		frame_value = value;
+
+		section_reducer->AddFrame(cur_frame.time, frame_value);
+		WriteDecidedFrames();
+	}
+
+	// Writes or drops the pending time samples the reducer has decided on
+	void WriteDecidedFrames()
+	{
+		KeyframeSection reduce_section = GetKeyframeSection(cur_section);
+		while (!section_reducer->decisions.empty())
+		{
+			bool keep_frame = section_reducer->decisions.front();
+			section_reducer->decisions.pop_front();
+
+			PendingFrame& cur_frame = pending_frames.front();
+			if (keep_frame)
+			{
+				BeginTimeSample(cur_frame.time);
+
+				rapidjson::Value& frame_value = *cur_frame.doc;
+				for (rapidjson::Value::MemberIterator s_itr = frame_value.MemberBegin();
+				s_itr != frame_value.MemberEnd();
+					++s_itr)
+				{
+					WriteSectionItem(s_itr->name.GetString(), s_itr->value);
+				}
+
+				EndTimeSample(cur_frame.time);
+				reduce_stats.kept[reduce_section]++;
+			}
+			else
+			{
+				reduce_stats.dropped[reduce_section]++;
+			}
+
+			pending_frames.pop_front();
+		}
+	}
+
+	static KeyframeSection GetKeyframeSection(AnimationSection section)
+	{
+		switch (section)
+		{
+		case SECTION_MESHES:
+			return KEYFRAME_MESHES;
+		case SECTION_UV_SWAPS:
+			return KEYFRAME_UV_SWAPS;
+		case SECTION_MESH_OPACITIES:
+			return KEYFRAME_MESH_OPACITIES;
+		default:
+			break;
+		}
+
+		return KEYFRAME_BONES;
+	}
+
+	// Called after an object at path has been entered
+	void BeginContainer()
+	{
+		if ((path.size() == 3) && (path[0] == "animation"))
+		{
+			cur_section = GetSection(path[2]);
+			bones_dense = (cur_section == SECTION_BONES) && writer.UseBonesTrack();
+			meshes_track = (cur_section == SECTION_MESHES) && writer.UseMeshTrack();
+
+			KeyframeSection reduce_section = GetKeyframeSection(cur_section);
+			float tolerance = GetKeyframeReduceTolerance(options, reduce_section);
+			if (tolerance >= 0.0f)
+			{
+				section_reducer.reset(new KeyframeReducer(tolerance, reduce_section));
+			}
+		}
+		else if ((path.size() == 4) && (path[0] == "animation"))
+		{
+			BeginTimeSample(atoi(path[3].c_str()));
+		}
+	}
+
+	void BeginTimeSample(int cur_time)
+	{
+		if (bones_dense)
+		{
+			writer.BeginBonesTrackTimeSample(cur_time);
+		}
+		else if (meshes_track)
+		{
+			writer.BeginMeshTrackTimeSample(cur_time);
+		}
+	}
+
+	// Called when the object at path has been read completely
+	void EndContainer()
+	{
+		const std::string& top_key = path[0];
+		size_t depth = path.size();
+
+		if (top_key == "mesh")
+		{
+			if (depth == 1)
+			{
+				mesh_loc = writer.WriteMesh(mesh_points, mesh_uvs, mesh_indices, mesh_region_list);
+				has_mesh = true;
+
+				mesh_points.SetNull();
+				mesh_uvs.SetNull();
+				mesh_indices.SetNull();
+				mesh_data_doc.GetAllocator().Clear();
+			}
+		}
+		else if (top_key == "skeleton")
+		{
+			skeleton_loc = writer.WriteSkeleton(skeleton_bone_list);
+			has_skeleton = true;
+		}
+		else if (top_key == "animation")
+		{
+			if (depth == 4)
+			{
+				EndTimeSample(atoi(path[3].c_str()));
+			}
+			else if (depth == 3)
+			{
+				if (section_reducer)
+				{
+					section_reducer->Finish();
+					WriteDecidedFrames();
+					section_reducer.reset();
+				}
+
+				EndSection();
+				cur_section = SECTION_NONE;
+				bones_dense = false;
+				meshes_track = false;
+			}
+			else if (depth == 2)
+			{
+				animation_clip_list.push_back(writer.WriteAnimationClip(path[1].c_str(),
+					bones_list_loc,
+					meshes_list_loc,
+					uv_swaps_list_loc,
+					mesh_opacities_list_loc,
+					bones_track_loc));
+
+				bones_list_loc = flatbuffers::Offset<CreatureFlatData::animationBonesList>();
+				meshes_list_loc = flatbuffers::Offset<CreatureFlatData::animationMeshList>();
+				uv_swaps_list_loc = flatbuffers::Offset<CreatureFlatData::animationUVSwapList>();
+				mesh_opacities_list_loc = flatbuffers::Offset<CreatureFlatData::animationMeshOpacityList>();
+				bones_track_loc = flatbuffers::Offset<CreatureFlatData::animationBonesTrack>();
+			}
+			else if (depth == 1)
+			{
+				animation_loc = writer.WriteAnimation(animation_clip_list);
+				has_animation = true;
+			}
+		}
+		else if (top_key == "uv_swap_items")
+		{
+			uv_swap_loc = writer.WriteUVSwapItemHolder(item_meshes);
+			has_uv_swap_items = true;
+		}
+	}
+
+	void EndTimeSample(int cur_time)
+	{
+		switch (cur_section)
+		{
+		case SECTION_BONES:
+			if (!bones_dense)
+			{
+				bones_samples.push_back(writer.WriteAnimationBonesTimeSample(cur_time, animation_bone_list));
+				animation_bone_list.clear();
+			}
+			break;
+		case SECTION_MESHES:
+			if (!meshes_track)
+			{
+				meshes_samples.push_back(writer.WriteAnimationMeshTimeSample(cur_time, animation_mesh_list));
+				animation_mesh_list.clear();
+			}
+			break;
+		case SECTION_UV_SWAPS:
+			uv_swaps_samples.push_back(writer.WriteAnimationUVSwapTimeSample(cur_time, animation_uv_swap_list));
+			animation_uv_swap_list.clear();
+			break;
+		case SECTION_MESH_OPACITIES:
+			mesh_opacities_samples.push_back(writer.WriteAnimationMeshOpacityTimeSample(cur_time, animation_mesh_opacity_list));
+			animation_mesh_opacity_list.clear();
+			break;
+		default:
+			break;
+		}
+	}
+
+	void EndSection()
+	{
+		switch (cur_section)
+		{
+		case SECTION_BONES:
+			if (bones_dense)
+			{
+				bones_track_loc = writer.WriteBonesTrack();
+			}
+			else
+			{
+				bones_list_loc = writer.WriteAnimationBonesList(bones_samples);
+				bones_samples.clear();
+			}
+			break;
+		case SECTION_MESHES:
+			if (meshes_track)
+			{
+				meshes_list_loc = writer.WriteMeshTrack();
+			}
+			else
+			{
+				meshes_list_loc = writer.WriteAnimationMeshList(meshes_samples);
+				meshes_samples.clear();
+			}
+			break;
+		case SECTION_UV_SWAPS:
+			uv_swaps_list_loc = writer.WriteAnimationUVSwapList(uv_swaps_samples);
+			uv_swaps_samples.clear();
+			break;
+		case SECTION_MESH_OPACITIES:
+			mesh_opacities_list_loc = writer.WriteAnimationMeshOpacityList(mesh_opacities_samples);
+			mesh_opacities_samples.clear();
+			break;
+		default:
+			break;
+		}
+	}
+
+	FlatDataWriter& writer;
+	const ConvertFlatDataOptions& options;
+
+	// Parse state
+	bool root_started, root_done;
+	std::vector<std::string> path;
+	std::string cur_key;
+	JsonValueCapture capture;
+	bool capture_active;
+	int skip_depth;
+	AnimationSection cur_section;
+
+	// Bones of the current clip are written as a dense track
+	bool bones_dense;
+
+	// Meshes of the current clip are buffered by the writer to be quantized
+	bool meshes_track;
+
+	// Keyframe reduction of the current section, with its undecided time samples
+	struct PendingFrame
+	{
+		int time;
+		std::unique_ptr<rapidjson::Document> doc;
+	};
+
+	std::unique_ptr<KeyframeReducer> section_reducer;
+	std::deque<PendingFrame> pending_frames;
+	KeyframeReduceStats reduce_stats;
+
+	// Captured values. mesh_data_doc holds the mesh arrays until the mesh object ends,
+	// item_doc is cleared after every captured leaf object.
+	rapidjson::Document mesh_data_doc, item_doc;
+	rapidjson::Value mesh_points, mesh_uvs, mesh_indices;
+
+	// Offsets for the parent vectors
+	std::vector<flatbuffers::Offset<CreatureFlatData::meshRegion> > mesh_region_list;
+	std::vector<flatbuffers::Offset<CreatureFlatData::skeletonBone> > skeleton_bone_list;
+
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationBone> > animation_bone_list;
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationMesh> > animation_mesh_list;
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwap> > animation_uv_swap_list;
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacity> > animation_mesh_opacity_list;
+
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationBonesTimeSample> > bones_samples;
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshTimeSample> > meshes_samples;
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwapTimeSample> > uv_swaps_samples;
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacityTimeSample> > mesh_opacities_samples;
+
+	flatbuffers::Offset<CreatureFlatData::animationBonesList> bones_list_loc;
+	flatbuffers::Offset<CreatureFlatData::animationMeshList> meshes_list_loc;
+	flatbuffers::Offset<CreatureFlatData::animationUVSwapList> uv_swaps_list_loc;
+	flatbuffers::Offset<CreatureFlatData::animationMeshOpacityList> mesh_opacities_list_loc;
+	flatbuffers::Offset<CreatureFlatData::animationBonesTrack> bones_track_loc;
+
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationClip> > animation_clip_list;
+	std::vector<flatbuffers::Offset<CreatureFlatData::uvSwapItemMesh> > item_meshes;
+
+	flatbuffers::Offset<CreatureFlatData::mesh> mesh_loc;
+	flatbuffers::Offset<CreatureFlatData::skeleton> skeleton_loc;
+	flatbuffers::Offset<CreatureFlatData::animation> animation_loc;
+	flatbuffers::Offset<CreatureFlatData::uvSwapItemHolder> uv_swap_loc;
+	flatbuffers::Offset<CreatureFlatData::anchorPointsHolder> anchor_loc;
+
+	bool has_mesh, has_skeleton, has_animation;
+	bool has_uv_swap_items, has_anchor_points;
+};
+
+bool ConvertToFlatDataStream(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options,
+	ConvertFlatDataTimes& times_out)
+{
+	ConvertFlatDataOptions stream_options = options;
+	stream_options.stream_parse = true;
+	return ConvertToFlatData(json_filename_in, flat_filename_out, stream_options, times_out);
+}
+
+bool ConvertToFlatDataStream(const std::string& json_filename_in,
+	const std::string& flat_filename_out,
+	const ConvertFlatDataOptions& options)
+{
+	if (options.split_clips)
+	{
+		std::cerr << "Error: Split clip containers are not written by the streaming engine" << std::endl;
+		return false;
+	}
+
+	// Stages interleave with the parse, so only parsing and building as a whole is timed
+	ConvertProfileScope total_scope(options.profile, "total");
+	ConvertProfileScope parse_build_scope(options.profile, "stream_parse_build");
+	flatbuffers::FlatBufferBuilder fbb;
+	FlatDataWriter writer(fbb, options);
+	CreatureJsonStreamHandler handler(writer, options);
+
+	rapidjson::Reader reader;
+	rapidjson::ParseResult parse_result;
+
+	if (options.parse_insitu)
+	{
+		std::vector<char> insitu_buffer;
+		if (!ReadCreatureJsonBuffer(json_filename_in, insitu_buffer))
+		{
+			return false;
+		}
+
+		rapidjson::InsituStringStream is(insitu_buffer.data());
+		parse_result = reader.Parse<rapidjson::kParseInsituFlag>(is, handler);
+	}
+	else
+	{
+		FILE* fp = fopen(json_filename_in.c_str(), "rb");
+		if (!fp)
+		{
+			std::cerr << "Error: Could not open Input Creature JSON: " << json_filename_in << std::endl;
+			return false;
+		}
+
+		char readBuffer[65536];
+		rapidjson::FileReadStream is(fp, readBuffer, sizeof(readBuffer));
+		parse_result = reader.Parse(is, handler);
+		fclose(fp);
+	}
+
+	if (parse_result.IsError() || !handler.IsComplete())
+	{
+		std::cerr << "Error: Invalid Input Creature JSON!" << std::endl;
+		return false;
+	}
+
+	parse_build_scope.End();
+	ConvertProfileScope root_scope(options.profile, "root");
+	handler.WriteRoot();
+	root_scope.End();
+
+	// ---- Serialize to Disk ------------- //
+	ConvertProfileScope serialize_scope(options.profile, "serialize");
+	return WriteFlatDataFile(fbb, flat_filename_out, options.verbose);
+}
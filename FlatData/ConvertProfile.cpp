@@ -0,0 +1,198 @@
+#include <cstdio>
+#include <rapidjson/filewritestream.h>
+#include <rapidjson/prettywriter.h>
+#include <ConvertProfile.h>
+
+// Allocations made by operator new on this thread since it started
+static thread_local uint64_t thread_allocation_count = 0;
+static thread_local uint64_t thread_allocated_bytes = 0;
+
+// Set once ConvertProfileNewHook.cpp's operator new is counting into them
+static bool counts_allocations = false;
+
+// ----------- Profile ----------------------
+
+ConvertProfile::ConvertProfile()
+{
+}
+
+void
+ConvertProfile::AddStage(const Stage& stage_in)
+{
+	std::lock_guard<std::mutex> stages_lock(stages_mutex);
+	stages.push_back(stage_in);
+}
+
+std::vector<ConvertProfile::Stage>
+ConvertProfile::GetStages() const
+{
+	std::lock_guard<std::mutex> stages_lock(stages_mutex);
+	return stages;
+}
+
+bool
+ConvertProfile::CountsAllocations()
+{
+	return counts_allocations;
+}
+
+void
+ConvertProfile::SetCountsAllocations()
+{
+	counts_allocations = true;
+}
+
+void
+ConvertProfile::CountAllocation(std::size_t size_in)
+{
+	thread_allocation_count++;
+	thread_allocated_bytes += size_in;
+}
+
+typedef rapidjson::PrettyWriter<rapidjson::FileWriteStream> ProfileJsonWriter;
+
+static void
+WriteStageJson(ProfileJsonWriter& writer, const ConvertProfile::Stage& stage_in)
+{
+	writer.StartObject();
+	writer.Key("name");
+	writer.String(stage_in.name.c_str());
+	if (!stage_in.clip_name.empty())
+	{
+		writer.Key("clip");
+		writer.String(stage_in.clip_name.c_str());
+	}
+
+	writer.Key("wall_ms");
+	writer.Double(stage_in.wall_s * 1e3);
+	writer.Key("allocations");
+	writer.Uint64(stage_in.allocation_count);
+	writer.Key("allocated_bytes");
+	writer.Uint64(stage_in.allocated_bytes);
+	if (stage_in.json_pool_bytes > 0)
+	{
+		writer.Key("json_pool_bytes");
+		writer.Uint64(stage_in.json_pool_bytes);
+	}
+
+	writer.EndObject();
+}
+
+bool
+ConvertProfile::WriteJsonReport(const std::string& report_filename_out,
+	const std::string& json_filename_in,
+	const std::string& flat_filename_in) const
+{
+	FILE * fp = fopen(report_filename_out.c_str(), "wb");
+	if (!fp)
+	{
+		return false;
+	}
+
+	auto report_stages = GetStages();
+	char write_buffer[65536];
+	rapidjson::FileWriteStream os(fp, write_buffer, sizeof(write_buffer));
+	ProfileJsonWriter writer(os);
+
+	writer.StartObject();
+	writer.Key("input");
+	writer.String(json_filename_in.c_str());
+	writer.Key("output");
+	writer.String(flat_filename_in.c_str());
+	writer.Key("counts_allocations");
+	writer.Bool(CountsAllocations());
+
+	for (auto& cur_stage : report_stages)
+	{
+		if ((cur_stage.name != "total") || !cur_stage.clip_name.empty())
+		{
+			continue;
+		}
+
+		// Stages of other threads ran inside the total without its thread seeing their allocations
+		Stage total_stage = cur_stage;
+		for (auto& other_stage : report_stages)
+		{
+			if (other_stage.thread_id != cur_stage.thread_id)
+			{
+				total_stage.allocation_count += other_stage.allocation_count;
+				total_stage.allocated_bytes += other_stage.allocated_bytes;
+			}
+		}
+
+		writer.Key("total");
+		WriteStageJson(writer, total_stage);
+	}
+
+	writer.Key("stages");
+	writer.StartArray();
+	for (auto& cur_stage : report_stages)
+	{
+		if ((cur_stage.name != "total") || !cur_stage.clip_name.empty())
+		{
+			WriteStageJson(writer, cur_stage);
+		}
+	}
+
+	writer.EndArray();
+	writer.EndObject();
+	os.Put('\n');
+	os.Flush();
+
+	bool write_ok = (ferror(fp) == 0);
+	fclose(fp);
+	return write_ok;
+}
+
+// ----------- Scope ----------------------
+
+ConvertProfileScope::ConvertProfileScope(ConvertProfile * profile_in, const char * name_in,
+	const char * clip_name_in)
+	: profile(profile_in),
+	start_allocation_count(0),
+	start_allocated_bytes(0)
+{
+	if (!profile)
+	{
+		return;
+	}
+
+	stage.name = name_in;
+	stage.clip_name = clip_name_in ? clip_name_in : "";
+	stage.wall_s = 0.0;
+	stage.allocation_count = 0;
+	stage.allocated_bytes = 0;
+	stage.json_pool_bytes = 0;
+	stage.thread_id = std::this_thread::get_id();
+
+	// Taken last, so the stage's own setup is not counted
+	start_allocation_count = thread_allocation_count;
+	start_allocated_bytes = thread_allocated_bytes;
+	start_time = std::chrono::steady_clock::now();
+}
+
+ConvertProfileScope::~ConvertProfileScope()
+{
+	End();
+}
+
+void
+ConvertProfileScope::SetJsonPoolBytes(uint64_t bytes_in)
+{
+	stage.json_pool_bytes = bytes_in;
+}
+
+void
+ConvertProfileScope::End()
+{
+	if (!profile)
+	{
+		return;
+	}
+
+	stage.wall_s = std::chrono::duration<double>(std::chrono::steady_clock::now() - start_time).count();
+	stage.allocation_count = thread_allocation_count - start_allocation_count;
+	stage.allocated_bytes = thread_allocated_bytes - start_allocated_bytes;
+	profile->AddStage(stage);
+	profile = nullptr;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <cstddef>
+
+// Wall time and heap allocations of each stage of a conversion, filled in by the
+// converter when ConvertFlatDataOptions::profile is set and written out as a JSON report.
+// Allocations are counted on the thread running a stage by the global operator new of
+// ConvertProfileNewHook.cpp, which only programs that link it get, so clips converted in
+// parallel each count their own while their wall times overlap. The report's total adds
+// them to the allocations of the converting thread. Without the hook the report has
+// counts_allocations false and no allocations.
+class ConvertProfile
+{
+public:
+	struct Stage
+	{
+		std::string name;
+
+		// Clip the stage belongs to, empty for stages of the whole file
+		std::string clip_name;
+		double wall_s;
+		uint64_t allocation_count;
+		uint64_t allocated_bytes;
+
+		// Bytes the JSON document holds in rapidjson's malloc backed pools, which
+		// operator new does not see. Only set for the parse stage.
+		uint64_t json_pool_bytes;
+
+		// Thread the stage ran on
+		std::thread::id thread_id;
+	};
+
+	ConvertProfile();
+
+	// Adds a finished stage. Safe to call from several threads.
+	void AddStage(const Stage& stage_in);
+
+	// Returns the stages in the order they finished
+	std::vector<Stage> GetStages() const;
+
+	// Writes the report of the conversion of json_filename_in to flat_filename_in: its
+	// total stage, then every other stage, times in milliseconds
+	bool WriteJsonReport(const std::string& report_filename_out,
+		const std::string& json_filename_in,
+		const std::string& flat_filename_in) const;
+
+	// True if ConvertProfileNewHook.cpp is linked in and counting allocations
+	static bool CountsAllocations();
+
+	// Called by ConvertProfileNewHook.cpp as the program starts
+	static void SetCountsAllocations();
+
+	// Counts an allocation of size_in bytes on the calling thread, called by the hooked operator new
+	static void CountAllocation(std::size_t size_in);
+
+private:
+	mutable std::mutex stages_mutex;
+	std::vector<Stage> stages;
+};
+
+// Times one stage and counts the allocations made on the calling thread until End or
+// destruction, then adds it to profile_in. Does nothing if profile_in is null.
+class ConvertProfileScope
+{
+public:
+	ConvertProfileScope(ConvertProfile * profile_in, const char * name_in,
+		const char * clip_name_in = nullptr);
+
+	~ConvertProfileScope();
+
+	// Bytes to report as the stage's json_pool_bytes
+	void SetJsonPoolBytes(uint64_t bytes_in);
+
+	// Ends the stage early, adding it to the profile
+	void End();
+
+private:
+	ConvertProfile * profile;
+	ConvertProfile::Stage stage;
+	std::chrono::steady_clock::time_point start_time;
+	uint64_t start_allocation_count, start_allocated_bytes;
+};
@@ -0,0 +1,99 @@
+#include <cstdlib>
+#include <new>
+#include <ConvertProfile.h>
+
+// Replaces the global operator new and delete of the program that links this file, so
+// ConvertProfile can count the allocations of each stage. Link it into the converter's
+// command line program only: libraries and programs embedding the converter leave it
+// out, keep their own allocator and get profiles without allocation counts.
+
+static const bool counts_allocations_set = (ConvertProfile::SetCountsAllocations(), true);
+
+static void *
+AllocateCounted(std::size_t size)
+{
+	ConvertProfile::CountAllocation(size);
+
+	for (;;)
+	{
+		void * new_ptr = malloc(size ? size : 1);
+		if (new_ptr)
+		{
+			return new_ptr;
+		}
+
+		std::new_handler cur_handler = std::get_new_handler();
+		if (!cur_handler)
+		{
+			throw std::bad_alloc();
+		}
+
+		cur_handler();
+	}
+}
+
+void * operator new(std::size_t size)
+{
+	return AllocateCounted(size);
+}
+
+void * operator new[](std::size_t size)
+{
+	return AllocateCounted(size);
+}
+
+void * operator new(std::size_t size, const std::nothrow_t&) noexcept
+{
+	try
+	{
+		return AllocateCounted(size);
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+void * operator new[](std::size_t size, const std::nothrow_t&) noexcept
+{
+	try
+	{
+		return AllocateCounted(size);
+	}
+	catch (...)
+	{
+		return nullptr;
+	}
+}
+
+void operator delete(void * ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void * ptr) noexcept
+{
+	free(ptr);
+}
+
+void operator delete(void * ptr, const std::nothrow_t&) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void * ptr, const std::nothrow_t&) noexcept
+{
+	free(ptr);
+}
+
+#if defined(__cpp_sized_deallocation)
+void operator delete(void * ptr, std::size_t) noexcept
+{
+	free(ptr);
+}
+
+void operator delete[](void * ptr, std::size_t) noexcept
+{
+	free(ptr);
+}
+#endif
@@ -13,18 +13,25 @@ public sealed class anchorPointsHolder : Table {
   public anchorPointData GetAnchorPoints(int j) { return GetAnchorPoints(new anchorPointData(), j); }
   public anchorPointData GetAnchorPoints(anchorPointData obj, int j) { int o = __offset(4); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
   public int AnchorPointsLength { get { int o = __offset(4); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetAnchorPointsByClipName(int j) { int o = __offset(6); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int AnchorPointsByClipNameLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
 
   public static Offset<anchorPointsHolder> CreateanchorPointsHolder(FlatBufferBuilder builder,
-      VectorOffset anchorPoints = default(VectorOffset)) {
-    builder.StartObject(1);
+      VectorOffset anchorPoints = default(VectorOffset),
+      VectorOffset anchorPoints_by_clip_name = default(VectorOffset)) {
+    builder.StartObject(2);
+    anchorPointsHolder.AddAnchorPointsByClipName(builder, anchorPoints_by_clip_name);
     anchorPointsHolder.AddAnchorPoints(builder, anchorPoints);
     return anchorPointsHolder.EndanchorPointsHolder(builder);
   }
 
-  public static void StartanchorPointsHolder(FlatBufferBuilder builder) { builder.StartObject(1); }
+  public static void StartanchorPointsHolder(FlatBufferBuilder builder) { builder.StartObject(2); }
   public static void AddAnchorPoints(FlatBufferBuilder builder, VectorOffset anchorPointsOffset) { builder.AddOffset(0, anchorPointsOffset.Value, 0); }
   public static VectorOffset CreateAnchorPointsVector(FlatBufferBuilder builder, Offset<anchorPointData>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
   public static void StartAnchorPointsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddAnchorPointsByClipName(FlatBufferBuilder builder, VectorOffset anchorPointsByClipNameOffset) { builder.AddOffset(1, anchorPointsByClipNameOffset.Value, 0); }
+  public static VectorOffset CreateAnchorPointsByClipNameVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartAnchorPointsByClipNameVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<anchorPointsHolder> EndanchorPointsHolder(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<anchorPointsHolder>(o);
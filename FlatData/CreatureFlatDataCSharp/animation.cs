@@ -13,18 +13,25 @@ public sealed class animation : Table {
   public animationClip GetClips(int j) { return GetClips(new animationClip(), j); }
   public animationClip GetClips(animationClip obj, int j) { int o = __offset(4); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
   public int ClipsLength { get { int o = __offset(4); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetClipsByName(int j) { int o = __offset(6); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int ClipsByNameLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
 
   public static Offset<animation> Createanimation(FlatBufferBuilder builder,
-      VectorOffset clips = default(VectorOffset)) {
-    builder.StartObject(1);
+      VectorOffset clips = default(VectorOffset),
+      VectorOffset clips_by_name = default(VectorOffset)) {
+    builder.StartObject(2);
+    animation.AddClipsByName(builder, clips_by_name);
     animation.AddClips(builder, clips);
     return animation.Endanimation(builder);
   }
 
-  public static void Startanimation(FlatBufferBuilder builder) { builder.StartObject(1); }
+  public static void Startanimation(FlatBufferBuilder builder) { builder.StartObject(2); }
   public static void AddClips(FlatBufferBuilder builder, VectorOffset clipsOffset) { builder.AddOffset(0, clipsOffset.Value, 0); }
   public static VectorOffset CreateClipsVector(FlatBufferBuilder builder, Offset<animationClip>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
   public static void StartClipsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddClipsByName(FlatBufferBuilder builder, VectorOffset clipsByNameOffset) { builder.AddOffset(1, clipsByNameOffset.Value, 0); }
+  public static VectorOffset CreateClipsByNameVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartClipsByNameVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<animation> Endanimation(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<animation>(o);
@@ -15,19 +15,22 @@ public sealed class animationBone : Table {
   public int StartPtLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
   public float GetEndPt(int j) { int o = __offset(8); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
   public int EndPtLength { get { int o = __offset(8); return o != 0 ? __vector_len(o) : 0; } }
+  public int BoneIndex { get { int o = __offset(10); return o != 0 ? bb.GetInt(o + bb_pos) : (int)-1; } }
 
   public static Offset<animationBone> CreateanimationBone(FlatBufferBuilder builder,
       StringOffset name = default(StringOffset),
       VectorOffset start_pt = default(VectorOffset),
-      VectorOffset end_pt = default(VectorOffset)) {
-    builder.StartObject(3);
+      VectorOffset end_pt = default(VectorOffset),
+      int bone_index = -1) {
+    builder.StartObject(4);
+    animationBone.AddBoneIndex(builder, bone_index);
     animationBone.AddEndPt(builder, end_pt);
     animationBone.AddStartPt(builder, start_pt);
     animationBone.AddName(builder, name);
     return animationBone.EndanimationBone(builder);
   }
 
-  public static void StartanimationBone(FlatBufferBuilder builder) { builder.StartObject(3); }
+  public static void StartanimationBone(FlatBufferBuilder builder) { builder.StartObject(4); }
   public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
   public static void AddStartPt(FlatBufferBuilder builder, VectorOffset startPtOffset) { builder.AddOffset(1, startPtOffset.Value, 0); }
   public static VectorOffset CreateStartPtVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
@@ -35,6 +38,7 @@ public sealed class animationBone : Table {
   public static void AddEndPt(FlatBufferBuilder builder, VectorOffset endPtOffset) { builder.AddOffset(2, endPtOffset.Value, 0); }
   public static VectorOffset CreateEndPtVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
   public static void StartEndPtVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddBoneIndex(FlatBufferBuilder builder, int boneIndex) { builder.AddInt(3, boneIndex, -1); }
   public static Offset<animationBone> EndanimationBone(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<animationBone>(o);
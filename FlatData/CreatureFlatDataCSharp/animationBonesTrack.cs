@@ -0,0 +1,81 @@
+// automatically generated, do not modify
+
+namespace CreatureFlatData
+{
+
+using FlatBuffers;
+
+public sealed class animationBonesTrack : Table {
+  public static animationBonesTrack GetRootAsanimationBonesTrack(ByteBuffer _bb) { return GetRootAsanimationBonesTrack(_bb, new animationBonesTrack()); }
+  public static animationBonesTrack GetRootAsanimationBonesTrack(ByteBuffer _bb, animationBonesTrack obj) { return (obj.__init(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public animationBonesTrack __init(int _i, ByteBuffer _bb) { bb_pos = _i; bb = _bb; return this; }
+
+  public int GetTimes(int j) { int o = __offset(4); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int TimesLength { get { int o = __offset(4); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetPositions(int j) { int o = __offset(6); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int PositionsLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
+  public int BoneCount { get { int o = __offset(8); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
+  public ushort GetPositionsQ(int j) { int o = __offset(10); return o != 0 ? bb.GetUshort(__vector(o) + j * 2) : (ushort)0; }
+  public int PositionsQLength { get { int o = __offset(10); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetRangeMin(int j) { int o = __offset(12); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int RangeMinLength { get { int o = __offset(12); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetRangeExtent(int j) { int o = __offset(14); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int RangeExtentLength { get { int o = __offset(14); return o != 0 ? __vector_len(o) : 0; } }
+  public int QuantizeBits { get { int o = __offset(16); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
+  public int DeltaInterval { get { int o = __offset(18); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
+  public byte GetAnimatedBones(int j) { int o = __offset(20); return o != 0 ? bb.Get(__vector(o) + j * 1) : (byte)0; }
+  public int AnimatedBonesLength { get { int o = __offset(20); return o != 0 ? __vector_len(o) : 0; } }
+
+  public static Offset<animationBonesTrack> CreateanimationBonesTrack(FlatBufferBuilder builder,
+      VectorOffset times = default(VectorOffset),
+      VectorOffset positions = default(VectorOffset),
+      int bone_count = 0,
+      VectorOffset positions_q = default(VectorOffset),
+      VectorOffset range_min = default(VectorOffset),
+      VectorOffset range_extent = default(VectorOffset),
+      int quantize_bits = 0,
+      int delta_interval = 0,
+      VectorOffset animated_bones = default(VectorOffset)) {
+    builder.StartObject(9);
+    animationBonesTrack.AddAnimatedBones(builder, animated_bones);
+    animationBonesTrack.AddDeltaInterval(builder, delta_interval);
+    animationBonesTrack.AddQuantizeBits(builder, quantize_bits);
+    animationBonesTrack.AddRangeExtent(builder, range_extent);
+    animationBonesTrack.AddRangeMin(builder, range_min);
+    animationBonesTrack.AddPositionsQ(builder, positions_q);
+    animationBonesTrack.AddBoneCount(builder, bone_count);
+    animationBonesTrack.AddPositions(builder, positions);
+    animationBonesTrack.AddTimes(builder, times);
+    return animationBonesTrack.EndanimationBonesTrack(builder);
+  }
+
+  public static void StartanimationBonesTrack(FlatBufferBuilder builder) { builder.StartObject(9); }
+  public static void AddTimes(FlatBufferBuilder builder, VectorOffset timesOffset) { builder.AddOffset(0, timesOffset.Value, 0); }
+  public static VectorOffset CreateTimesVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartTimesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddPositions(FlatBufferBuilder builder, VectorOffset positionsOffset) { builder.AddOffset(1, positionsOffset.Value, 0); }
+  public static VectorOffset CreatePositionsVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartPositionsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddBoneCount(FlatBufferBuilder builder, int boneCount) { builder.AddInt(2, boneCount, 0); }
+  public static void AddPositionsQ(FlatBufferBuilder builder, VectorOffset positionsQOffset) { builder.AddOffset(3, positionsQOffset.Value, 0); }
+  public static VectorOffset CreatePositionsQVector(FlatBufferBuilder builder, ushort[] data) { builder.StartVector(2, data.Length, 2); for (int i = data.Length - 1; i >= 0; i--) builder.AddUshort(data[i]); return builder.EndVector(); }
+  public static void StartPositionsQVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(2, numElems, 2); }
+  public static void AddRangeMin(FlatBufferBuilder builder, VectorOffset rangeMinOffset) { builder.AddOffset(4, rangeMinOffset.Value, 0); }
+  public static VectorOffset CreateRangeMinVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartRangeMinVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddRangeExtent(FlatBufferBuilder builder, VectorOffset rangeExtentOffset) { builder.AddOffset(5, rangeExtentOffset.Value, 0); }
+  public static VectorOffset CreateRangeExtentVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartRangeExtentVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddQuantizeBits(FlatBufferBuilder builder, int quantizeBits) { builder.AddInt(6, quantizeBits, 0); }
+  public static void AddDeltaInterval(FlatBufferBuilder builder, int deltaInterval) { builder.AddInt(7, deltaInterval, 0); }
+  public static void AddAnimatedBones(FlatBufferBuilder builder, VectorOffset animatedBonesOffset) { builder.AddOffset(8, animatedBonesOffset.Value, 0); }
+  public static VectorOffset CreateAnimatedBonesVector(FlatBufferBuilder builder, byte[] data) { builder.StartVector(1, data.Length, 1); for (int i = data.Length - 1; i >= 0; i--) builder.AddByte(data[i]); return builder.EndVector(); }
+  public static void StartAnimatedBonesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(1, numElems, 1); }
+  public static Offset<animationBonesTrack> EndanimationBonesTrack(FlatBufferBuilder builder) {
+    int o = builder.EndObject();
+    return new Offset<animationBonesTrack>(o);
+  }
+};
+
+
+}
@@ -19,14 +19,18 @@ public sealed class animationClip : Table {
   public animationUVSwapList GetUvSwaps(animationUVSwapList obj) { int o = __offset(10); return o != 0 ? obj.__init(__indirect(o + bb_pos), bb) : null; }
   public animationMeshOpacityList MeshOpacities { get { return GetMeshOpacities(new animationMeshOpacityList()); } }
   public animationMeshOpacityList GetMeshOpacities(animationMeshOpacityList obj) { int o = __offset(12); return o != 0 ? obj.__init(__indirect(o + bb_pos), bb) : null; }
+  public animationBonesTrack BonesTrack { get { return GetBonesTrack(new animationBonesTrack()); } }
+  public animationBonesTrack GetBonesTrack(animationBonesTrack obj) { int o = __offset(14); return o != 0 ? obj.__init(__indirect(o + bb_pos), bb) : null; }
 
   public static Offset<animationClip> CreateanimationClip(FlatBufferBuilder builder,
       StringOffset name = default(StringOffset),
       Offset<animationBonesList> bones = default(Offset<animationBonesList>),
       Offset<animationMeshList> meshes = default(Offset<animationMeshList>),
       Offset<animationUVSwapList> uvSwaps = default(Offset<animationUVSwapList>),
-      Offset<animationMeshOpacityList> meshOpacities = default(Offset<animationMeshOpacityList>)) {
-    builder.StartObject(5);
+      Offset<animationMeshOpacityList> meshOpacities = default(Offset<animationMeshOpacityList>),
+      Offset<animationBonesTrack> bonesTrack = default(Offset<animationBonesTrack>)) {
+    builder.StartObject(6);
+    animationClip.AddBonesTrack(builder, bonesTrack);
     animationClip.AddMeshOpacities(builder, meshOpacities);
     animationClip.AddUvSwaps(builder, uvSwaps);
     animationClip.AddMeshes(builder, meshes);
@@ -35,12 +39,13 @@ public sealed class animationClip : Table {
     return animationClip.EndanimationClip(builder);
   }
 
-  public static void StartanimationClip(FlatBufferBuilder builder) { builder.StartObject(5); }
+  public static void StartanimationClip(FlatBufferBuilder builder) { builder.StartObject(6); }
   public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
   public static void AddBones(FlatBufferBuilder builder, Offset<animationBonesList> bonesOffset) { builder.AddOffset(1, bonesOffset.Value, 0); }
   public static void AddMeshes(FlatBufferBuilder builder, Offset<animationMeshList> meshesOffset) { builder.AddOffset(2, meshesOffset.Value, 0); }
   public static void AddUvSwaps(FlatBufferBuilder builder, Offset<animationUVSwapList> uvSwapsOffset) { builder.AddOffset(3, uvSwapsOffset.Value, 0); }
   public static void AddMeshOpacities(FlatBufferBuilder builder, Offset<animationMeshOpacityList> meshOpacitiesOffset) { builder.AddOffset(4, meshOpacitiesOffset.Value, 0); }
+  public static void AddBonesTrack(FlatBufferBuilder builder, Offset<animationBonesTrack> bonesTrackOffset) { builder.AddOffset(5, bonesTrackOffset.Value, 0); }
   public static Offset<animationClip> EndanimationClip(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<animationClip>(o);
@@ -18,6 +18,19 @@ public sealed class animationMesh : Table {
   public int LocalDisplacementsLength { get { int o = __offset(12); return o != 0 ? __vector_len(o) : 0; } }
   public float GetPostDisplacements(int j) { int o = __offset(14); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
   public int PostDisplacementsLength { get { int o = __offset(14); return o != 0 ? __vector_len(o) : 0; } }
+  public int RegionIndex { get { int o = __offset(16); return o != 0 ? bb.GetInt(o + bb_pos) : (int)-1; } }
+  public ushort GetLocalDisplacementsQ(int j) { int o = __offset(18); return o != 0 ? bb.GetUshort(__vector(o) + j * 2) : (ushort)0; }
+  public int LocalDisplacementsQLength { get { int o = __offset(18); return o != 0 ? __vector_len(o) : 0; } }
+  public ushort GetPostDisplacementsQ(int j) { int o = __offset(20); return o != 0 ? bb.GetUshort(__vector(o) + j * 2) : (ushort)0; }
+  public int PostDisplacementsQLength { get { int o = __offset(20); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetLocalDisplacementsRuns(int j) { int o = __offset(22); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int LocalDisplacementsRunsLength { get { int o = __offset(22); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetLocalDisplacementsSparse(int j) { int o = __offset(24); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int LocalDisplacementsSparseLength { get { int o = __offset(24); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetPostDisplacementsRuns(int j) { int o = __offset(26); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int PostDisplacementsRunsLength { get { int o = __offset(26); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetPostDisplacementsSparse(int j) { int o = __offset(28); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int PostDisplacementsSparseLength { get { int o = __offset(28); return o != 0 ? __vector_len(o) : 0; } }
 
   public static Offset<animationMesh> CreateanimationMesh(FlatBufferBuilder builder,
       StringOffset name = default(StringOffset),
@@ -25,8 +38,22 @@ public sealed class animationMesh : Table {
       bool use_local_displacements = false,
       bool use_post_displacements = false,
       VectorOffset local_displacements = default(VectorOffset),
-      VectorOffset post_displacements = default(VectorOffset)) {
-    builder.StartObject(6);
+      VectorOffset post_displacements = default(VectorOffset),
+      int region_index = -1,
+      VectorOffset local_displacements_q = default(VectorOffset),
+      VectorOffset post_displacements_q = default(VectorOffset),
+      VectorOffset local_displacements_runs = default(VectorOffset),
+      VectorOffset local_displacements_sparse = default(VectorOffset),
+      VectorOffset post_displacements_runs = default(VectorOffset),
+      VectorOffset post_displacements_sparse = default(VectorOffset)) {
+    builder.StartObject(13);
+    animationMesh.AddPostDisplacementsSparse(builder, post_displacements_sparse);
+    animationMesh.AddPostDisplacementsRuns(builder, post_displacements_runs);
+    animationMesh.AddLocalDisplacementsSparse(builder, local_displacements_sparse);
+    animationMesh.AddLocalDisplacementsRuns(builder, local_displacements_runs);
+    animationMesh.AddPostDisplacementsQ(builder, post_displacements_q);
+    animationMesh.AddLocalDisplacementsQ(builder, local_displacements_q);
+    animationMesh.AddRegionIndex(builder, region_index);
     animationMesh.AddPostDisplacements(builder, post_displacements);
     animationMesh.AddLocalDisplacements(builder, local_displacements);
     animationMesh.AddName(builder, name);
@@ -36,7 +63,7 @@ public sealed class animationMesh : Table {
     return animationMesh.EndanimationMesh(builder);
   }
 
-  public static void StartanimationMesh(FlatBufferBuilder builder) { builder.StartObject(6); }
+  public static void StartanimationMesh(FlatBufferBuilder builder) { builder.StartObject(13); }
   public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
   public static void AddUseDq(FlatBufferBuilder builder, bool useDq) { builder.AddBool(1, useDq, false); }
   public static void AddUseLocalDisplacements(FlatBufferBuilder builder, bool useLocalDisplacements) { builder.AddBool(2, useLocalDisplacements, false); }
@@ -47,6 +74,25 @@ public sealed class animationMesh : Table {
   public static void AddPostDisplacements(FlatBufferBuilder builder, VectorOffset postDisplacementsOffset) { builder.AddOffset(5, postDisplacementsOffset.Value, 0); }
   public static VectorOffset CreatePostDisplacementsVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
   public static void StartPostDisplacementsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddRegionIndex(FlatBufferBuilder builder, int regionIndex) { builder.AddInt(6, regionIndex, -1); }
+  public static void AddLocalDisplacementsQ(FlatBufferBuilder builder, VectorOffset localDisplacementsQOffset) { builder.AddOffset(7, localDisplacementsQOffset.Value, 0); }
+  public static VectorOffset CreateLocalDisplacementsQVector(FlatBufferBuilder builder, ushort[] data) { builder.StartVector(2, data.Length, 2); for (int i = data.Length - 1; i >= 0; i--) builder.AddUshort(data[i]); return builder.EndVector(); }
+  public static void StartLocalDisplacementsQVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(2, numElems, 2); }
+  public static void AddPostDisplacementsQ(FlatBufferBuilder builder, VectorOffset postDisplacementsQOffset) { builder.AddOffset(8, postDisplacementsQOffset.Value, 0); }
+  public static VectorOffset CreatePostDisplacementsQVector(FlatBufferBuilder builder, ushort[] data) { builder.StartVector(2, data.Length, 2); for (int i = data.Length - 1; i >= 0; i--) builder.AddUshort(data[i]); return builder.EndVector(); }
+  public static void StartPostDisplacementsQVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(2, numElems, 2); }
+  public static void AddLocalDisplacementsRuns(FlatBufferBuilder builder, VectorOffset localDisplacementsRunsOffset) { builder.AddOffset(9, localDisplacementsRunsOffset.Value, 0); }
+  public static VectorOffset CreateLocalDisplacementsRunsVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartLocalDisplacementsRunsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddLocalDisplacementsSparse(FlatBufferBuilder builder, VectorOffset localDisplacementsSparseOffset) { builder.AddOffset(10, localDisplacementsSparseOffset.Value, 0); }
+  public static VectorOffset CreateLocalDisplacementsSparseVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartLocalDisplacementsSparseVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddPostDisplacementsRuns(FlatBufferBuilder builder, VectorOffset postDisplacementsRunsOffset) { builder.AddOffset(11, postDisplacementsRunsOffset.Value, 0); }
+  public static VectorOffset CreatePostDisplacementsRunsVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartPostDisplacementsRunsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddPostDisplacementsSparse(FlatBufferBuilder builder, VectorOffset postDisplacementsSparseOffset) { builder.AddOffset(12, postDisplacementsSparseOffset.Value, 0); }
+  public static VectorOffset CreatePostDisplacementsSparseVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartPostDisplacementsSparseVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<animationMesh> EndanimationMesh(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<animationMesh>(o);
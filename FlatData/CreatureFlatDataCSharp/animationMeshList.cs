@@ -13,18 +13,54 @@ public sealed class animationMeshList : Table {
   public animationMeshTimeSample GetTimeSamples(int j) { return GetTimeSamples(new animationMeshTimeSample(), j); }
   public animationMeshTimeSample GetTimeSamples(animationMeshTimeSample obj, int j) { int o = __offset(4); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
   public int TimeSamplesLength { get { int o = __offset(4); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetLocalRangeMin(int j) { int o = __offset(6); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int LocalRangeMinLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetLocalRangeExtent(int j) { int o = __offset(8); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int LocalRangeExtentLength { get { int o = __offset(8); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetPostRangeMin(int j) { int o = __offset(10); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int PostRangeMinLength { get { int o = __offset(10); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetPostRangeExtent(int j) { int o = __offset(12); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int PostRangeExtentLength { get { int o = __offset(12); return o != 0 ? __vector_len(o) : 0; } }
+  public int QuantizeBits { get { int o = __offset(14); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
+  public int DeltaInterval { get { int o = __offset(16); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
 
   public static Offset<animationMeshList> CreateanimationMeshList(FlatBufferBuilder builder,
-      VectorOffset timeSamples = default(VectorOffset)) {
-    builder.StartObject(1);
+      VectorOffset timeSamples = default(VectorOffset),
+      VectorOffset local_range_min = default(VectorOffset),
+      VectorOffset local_range_extent = default(VectorOffset),
+      VectorOffset post_range_min = default(VectorOffset),
+      VectorOffset post_range_extent = default(VectorOffset),
+      int quantize_bits = 0,
+      int delta_interval = 0) {
+    builder.StartObject(7);
+    animationMeshList.AddDeltaInterval(builder, delta_interval);
+    animationMeshList.AddQuantizeBits(builder, quantize_bits);
+    animationMeshList.AddPostRangeExtent(builder, post_range_extent);
+    animationMeshList.AddPostRangeMin(builder, post_range_min);
+    animationMeshList.AddLocalRangeExtent(builder, local_range_extent);
+    animationMeshList.AddLocalRangeMin(builder, local_range_min);
     animationMeshList.AddTimeSamples(builder, timeSamples);
     return animationMeshList.EndanimationMeshList(builder);
   }
 
-  public static void StartanimationMeshList(FlatBufferBuilder builder) { builder.StartObject(1); }
+  public static void StartanimationMeshList(FlatBufferBuilder builder) { builder.StartObject(7); }
   public static void AddTimeSamples(FlatBufferBuilder builder, VectorOffset timeSamplesOffset) { builder.AddOffset(0, timeSamplesOffset.Value, 0); }
   public static VectorOffset CreateTimeSamplesVector(FlatBufferBuilder builder, Offset<animationMeshTimeSample>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
   public static void StartTimeSamplesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddLocalRangeMin(FlatBufferBuilder builder, VectorOffset localRangeMinOffset) { builder.AddOffset(1, localRangeMinOffset.Value, 0); }
+  public static VectorOffset CreateLocalRangeMinVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartLocalRangeMinVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddLocalRangeExtent(FlatBufferBuilder builder, VectorOffset localRangeExtentOffset) { builder.AddOffset(2, localRangeExtentOffset.Value, 0); }
+  public static VectorOffset CreateLocalRangeExtentVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartLocalRangeExtentVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddPostRangeMin(FlatBufferBuilder builder, VectorOffset postRangeMinOffset) { builder.AddOffset(3, postRangeMinOffset.Value, 0); }
+  public static VectorOffset CreatePostRangeMinVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartPostRangeMinVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddPostRangeExtent(FlatBufferBuilder builder, VectorOffset postRangeExtentOffset) { builder.AddOffset(4, postRangeExtentOffset.Value, 0); }
+  public static VectorOffset CreatePostRangeExtentVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartPostRangeExtentVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddQuantizeBits(FlatBufferBuilder builder, int quantizeBits) { builder.AddInt(5, quantizeBits, 0); }
+  public static void AddDeltaInterval(FlatBufferBuilder builder, int deltaInterval) { builder.AddInt(6, deltaInterval, 0); }
   public static Offset<animationMeshList> EndanimationMeshList(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<animationMeshList>(o);
@@ -12,19 +12,23 @@ public sealed class animationMeshOpacity : Table {
 
   public string Name { get { int o = __offset(4); return o != 0 ? __string(o + bb_pos) : null; } }
   public float Opacity { get { int o = __offset(6); return o != 0 ? bb.GetFloat(o + bb_pos) : (float)0; } }
+  public int RegionIndex { get { int o = __offset(8); return o != 0 ? bb.GetInt(o + bb_pos) : (int)-1; } }
 
   public static Offset<animationMeshOpacity> CreateanimationMeshOpacity(FlatBufferBuilder builder,
       StringOffset name = default(StringOffset),
-      float opacity = 0) {
-    builder.StartObject(2);
+      float opacity = 0,
+      int region_index = -1) {
+    builder.StartObject(3);
+    animationMeshOpacity.AddRegionIndex(builder, region_index);
     animationMeshOpacity.AddOpacity(builder, opacity);
     animationMeshOpacity.AddName(builder, name);
     return animationMeshOpacity.EndanimationMeshOpacity(builder);
   }
 
-  public static void StartanimationMeshOpacity(FlatBufferBuilder builder) { builder.StartObject(2); }
+  public static void StartanimationMeshOpacity(FlatBufferBuilder builder) { builder.StartObject(3); }
   public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
   public static void AddOpacity(FlatBufferBuilder builder, float opacity) { builder.AddFloat(1, opacity, 0); }
+  public static void AddRegionIndex(FlatBufferBuilder builder, int regionIndex) { builder.AddInt(2, regionIndex, -1); }
   public static Offset<animationMeshOpacity> EndanimationMeshOpacity(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<animationMeshOpacity>(o);
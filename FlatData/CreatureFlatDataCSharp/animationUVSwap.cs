@@ -18,14 +18,17 @@ public sealed class animationUVSwap : Table {
   public float GetScale(int j) { int o = __offset(10); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
   public int ScaleLength { get { int o = __offset(10); return o != 0 ? __vector_len(o) : 0; } }
   public bool Enabled { get { int o = __offset(12); return o != 0 ? 0!=bb.Get(o + bb_pos) : (bool)false; } }
+  public int RegionIndex { get { int o = __offset(14); return o != 0 ? bb.GetInt(o + bb_pos) : (int)-1; } }
 
   public static Offset<animationUVSwap> CreateanimationUVSwap(FlatBufferBuilder builder,
       StringOffset name = default(StringOffset),
       VectorOffset local_offset = default(VectorOffset),
       VectorOffset global_offset = default(VectorOffset),
       VectorOffset scale = default(VectorOffset),
-      bool enabled = false) {
-    builder.StartObject(5);
+      bool enabled = false,
+      int region_index = -1) {
+    builder.StartObject(6);
+    animationUVSwap.AddRegionIndex(builder, region_index);
     animationUVSwap.AddScale(builder, scale);
     animationUVSwap.AddGlobalOffset(builder, global_offset);
     animationUVSwap.AddLocalOffset(builder, local_offset);
@@ -34,7 +37,7 @@ public sealed class animationUVSwap : Table {
     return animationUVSwap.EndanimationUVSwap(builder);
   }
 
-  public static void StartanimationUVSwap(FlatBufferBuilder builder) { builder.StartObject(5); }
+  public static void StartanimationUVSwap(FlatBufferBuilder builder) { builder.StartObject(6); }
   public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
   public static void AddLocalOffset(FlatBufferBuilder builder, VectorOffset localOffsetOffset) { builder.AddOffset(1, localOffsetOffset.Value, 0); }
   public static VectorOffset CreateLocalOffsetVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
@@ -46,6 +49,7 @@ public sealed class animationUVSwap : Table {
   public static VectorOffset CreateScaleVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
   public static void StartScaleVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static void AddEnabled(FlatBufferBuilder builder, bool enabled) { builder.AddBool(4, enabled, false); }
+  public static void AddRegionIndex(FlatBufferBuilder builder, int regionIndex) { builder.AddInt(5, regionIndex, -1); }
   public static Offset<animationUVSwap> EndanimationUVSwap(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<animationUVSwap>(o);
@@ -0,0 +1,46 @@
+// automatically generated, do not modify
+
+namespace CreatureFlatData
+{
+
+using FlatBuffers;
+
+public sealed class bakedAnimation : Table {
+  public static bakedAnimation GetRootAsbakedAnimation(ByteBuffer _bb) { return GetRootAsbakedAnimation(_bb, new bakedAnimation()); }
+  public static bakedAnimation GetRootAsbakedAnimation(ByteBuffer _bb, bakedAnimation obj) { return (obj.__init(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public bakedAnimation __init(int _i, ByteBuffer _bb) { bb_pos = _i; bb = _bb; return this; }
+
+  public int PointCount { get { int o = __offset(4); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
+  public bakedClip GetClips(int j) { return GetClips(new bakedClip(), j); }
+  public bakedClip GetClips(bakedClip obj, int j) { int o = __offset(6); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
+  public int ClipsLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetClipsByName(int j) { int o = __offset(8); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int ClipsByNameLength { get { int o = __offset(8); return o != 0 ? __vector_len(o) : 0; } }
+
+  public static Offset<bakedAnimation> CreatebakedAnimation(FlatBufferBuilder builder,
+      int point_count = 0,
+      VectorOffset clips = default(VectorOffset),
+      VectorOffset clips_by_name = default(VectorOffset)) {
+    builder.StartObject(3);
+    bakedAnimation.AddClipsByName(builder, clips_by_name);
+    bakedAnimation.AddClips(builder, clips);
+    bakedAnimation.AddPointCount(builder, point_count);
+    return bakedAnimation.EndbakedAnimation(builder);
+  }
+
+  public static void StartbakedAnimation(FlatBufferBuilder builder) { builder.StartObject(3); }
+  public static void AddPointCount(FlatBufferBuilder builder, int pointCount) { builder.AddInt(0, pointCount, 0); }
+  public static void AddClips(FlatBufferBuilder builder, VectorOffset clipsOffset) { builder.AddOffset(1, clipsOffset.Value, 0); }
+  public static VectorOffset CreateClipsVector(FlatBufferBuilder builder, Offset<bakedClip>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static void StartClipsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddClipsByName(FlatBufferBuilder builder, VectorOffset clipsByNameOffset) { builder.AddOffset(2, clipsByNameOffset.Value, 0); }
+  public static VectorOffset CreateClipsByNameVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartClipsByNameVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<bakedAnimation> EndbakedAnimation(FlatBufferBuilder builder) {
+    int o = builder.EndObject();
+    return new Offset<bakedAnimation>(o);
+  }
+};
+
+
+}
@@ -0,0 +1,60 @@
+// automatically generated, do not modify
+
+namespace CreatureFlatData
+{
+
+using FlatBuffers;
+
+public sealed class bakedClip : Table {
+  public static bakedClip GetRootAsbakedClip(ByteBuffer _bb) { return GetRootAsbakedClip(_bb, new bakedClip()); }
+  public static bakedClip GetRootAsbakedClip(ByteBuffer _bb, bakedClip obj) { return (obj.__init(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public bakedClip __init(int _i, ByteBuffer _bb) { bb_pos = _i; bb = _bb; return this; }
+
+  public string Name { get { int o = __offset(4); return o != 0 ? __string(o + bb_pos) : null; } }
+  public int StartTime { get { int o = __offset(6); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
+  public int EndTime { get { int o = __offset(8); return o != 0 ? bb.GetInt(o + bb_pos) : (int)0; } }
+  public float GetBoundsMin(int j) { int o = __offset(10); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int BoundsMinLength { get { int o = __offset(10); return o != 0 ? __vector_len(o) : 0; } }
+  public float GetBoundsExtent(int j) { int o = __offset(12); return o != 0 ? bb.GetFloat(__vector(o) + j * 4) : (float)0; }
+  public int BoundsExtentLength { get { int o = __offset(12); return o != 0 ? __vector_len(o) : 0; } }
+  public ushort GetPointsQ(int j) { int o = __offset(14); return o != 0 ? bb.GetUshort(__vector(o) + j * 2) : (ushort)0; }
+  public int PointsQLength { get { int o = __offset(14); return o != 0 ? __vector_len(o) : 0; } }
+
+  public static Offset<bakedClip> CreatebakedClip(FlatBufferBuilder builder,
+      StringOffset name = default(StringOffset),
+      int start_time = 0,
+      int end_time = 0,
+      VectorOffset bounds_min = default(VectorOffset),
+      VectorOffset bounds_extent = default(VectorOffset),
+      VectorOffset points_q = default(VectorOffset)) {
+    builder.StartObject(6);
+    bakedClip.AddPointsQ(builder, points_q);
+    bakedClip.AddBoundsExtent(builder, bounds_extent);
+    bakedClip.AddBoundsMin(builder, bounds_min);
+    bakedClip.AddEndTime(builder, end_time);
+    bakedClip.AddStartTime(builder, start_time);
+    bakedClip.AddName(builder, name);
+    return bakedClip.EndbakedClip(builder);
+  }
+
+  public static void StartbakedClip(FlatBufferBuilder builder) { builder.StartObject(6); }
+  public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
+  public static void AddStartTime(FlatBufferBuilder builder, int startTime) { builder.AddInt(1, startTime, 0); }
+  public static void AddEndTime(FlatBufferBuilder builder, int endTime) { builder.AddInt(2, endTime, 0); }
+  public static void AddBoundsMin(FlatBufferBuilder builder, VectorOffset boundsMinOffset) { builder.AddOffset(3, boundsMinOffset.Value, 0); }
+  public static VectorOffset CreateBoundsMinVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartBoundsMinVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddBoundsExtent(FlatBufferBuilder builder, VectorOffset boundsExtentOffset) { builder.AddOffset(4, boundsExtentOffset.Value, 0); }
+  public static VectorOffset CreateBoundsExtentVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
+  public static void StartBoundsExtentVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddPointsQ(FlatBufferBuilder builder, VectorOffset pointsQOffset) { builder.AddOffset(5, pointsQOffset.Value, 0); }
+  public static VectorOffset CreatePointsQVector(FlatBufferBuilder builder, ushort[] data) { builder.StartVector(2, data.Length, 2); for (int i = data.Length - 1; i >= 0; i--) builder.AddUshort(data[i]); return builder.EndVector(); }
+  public static void StartPointsQVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(2, numElems, 2); }
+  public static Offset<bakedClip> EndbakedClip(FlatBufferBuilder builder) {
+    int o = builder.EndObject();
+    return new Offset<bakedClip>(o);
+  }
+};
+
+
+}
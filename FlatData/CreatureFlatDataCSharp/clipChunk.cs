@@ -0,0 +1,43 @@
+// automatically generated, do not modify
+
+namespace CreatureFlatData
+{
+
+using FlatBuffers;
+
+public sealed class clipChunk : Table {
+  public static clipChunk GetRootAsclipChunk(ByteBuffer _bb) { return GetRootAsclipChunk(_bb, new clipChunk()); }
+  public static clipChunk GetRootAsclipChunk(ByteBuffer _bb, clipChunk obj) { return (obj.__init(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public clipChunk __init(int _i, ByteBuffer _bb) { bb_pos = _i; bb = _bb; return this; }
+
+  public string Name { get { int o = __offset(4); return o != 0 ? __string(o + bb_pos) : null; } }
+  public uint Offset { get { int o = __offset(6); return o != 0 ? bb.GetUint(o + bb_pos) : (uint)0; } }
+  public uint Size { get { int o = __offset(8); return o != 0 ? bb.GetUint(o + bb_pos) : (uint)0; } }
+  public uint CompressedSize { get { int o = __offset(10); return o != 0 ? bb.GetUint(o + bb_pos) : (uint)0; } }
+
+  public static Offset<clipChunk> CreateclipChunk(FlatBufferBuilder builder,
+      StringOffset name = default(StringOffset),
+      uint offset = 0,
+      uint size = 0,
+      uint compressed_size = 0) {
+    builder.StartObject(4);
+    clipChunk.AddCompressedSize(builder, compressed_size);
+    clipChunk.AddSize(builder, size);
+    clipChunk.AddOffset(builder, offset);
+    clipChunk.AddName(builder, name);
+    return clipChunk.EndclipChunk(builder);
+  }
+
+  public static void StartclipChunk(FlatBufferBuilder builder) { builder.StartObject(4); }
+  public static void AddName(FlatBufferBuilder builder, StringOffset nameOffset) { builder.AddOffset(0, nameOffset.Value, 0); }
+  public static void AddOffset(FlatBufferBuilder builder, uint offset) { builder.AddUint(1, offset, 0); }
+  public static void AddSize(FlatBufferBuilder builder, uint size) { builder.AddUint(2, size, 0); }
+  public static void AddCompressedSize(FlatBufferBuilder builder, uint compressedSize) { builder.AddUint(3, compressedSize, 0); }
+  public static Offset<clipChunk> EndclipChunk(FlatBufferBuilder builder) {
+    int o = builder.EndObject();
+    return new Offset<clipChunk>(o);
+  }
+};
+
+
+}
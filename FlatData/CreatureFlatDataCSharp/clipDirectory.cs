@@ -0,0 +1,47 @@
+// automatically generated, do not modify
+
+namespace CreatureFlatData
+{
+
+using FlatBuffers;
+
+public sealed class clipDirectory : Table {
+  public static clipDirectory GetRootAsclipDirectory(ByteBuffer _bb) { return GetRootAsclipDirectory(_bb, new clipDirectory()); }
+  public static clipDirectory GetRootAsclipDirectory(ByteBuffer _bb, clipDirectory obj) { return (obj.__init(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public clipDirectory __init(int _i, ByteBuffer _bb) { bb_pos = _i; bb = _bb; return this; }
+
+  public clipChunk Base { get { return GetBase(new clipChunk()); } }
+  public clipChunk GetBase(clipChunk obj) { int o = __offset(4); return o != 0 ? obj.__init(__indirect(o + bb_pos), bb) : null; }
+  public clipChunk GetClips(int j) { return GetClips(new clipChunk(), j); }
+  public clipChunk GetClips(clipChunk obj, int j) { int o = __offset(6); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
+  public int ClipsLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetClipsByName(int j) { int o = __offset(8); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int ClipsByNameLength { get { int o = __offset(8); return o != 0 ? __vector_len(o) : 0; } }
+
+  public static Offset<clipDirectory> CreateclipDirectory(FlatBufferBuilder builder,
+      Offset<clipChunk> base = default(Offset<clipChunk>),
+      VectorOffset clips = default(VectorOffset),
+      VectorOffset clips_by_name = default(VectorOffset)) {
+    builder.StartObject(3);
+    clipDirectory.AddClipsByName(builder, clips_by_name);
+    clipDirectory.AddClips(builder, clips);
+    clipDirectory.AddBase(builder, base);
+    return clipDirectory.EndclipDirectory(builder);
+  }
+
+  public static void StartclipDirectory(FlatBufferBuilder builder) { builder.StartObject(3); }
+  public static void AddBase(FlatBufferBuilder builder, Offset<clipChunk> baseOffset) { builder.AddOffset(0, baseOffset.Value, 0); }
+  public static void AddClips(FlatBufferBuilder builder, VectorOffset clipsOffset) { builder.AddOffset(1, clipsOffset.Value, 0); }
+  public static VectorOffset CreateClipsVector(FlatBufferBuilder builder, Offset<clipChunk>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
+  public static void StartClipsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddClipsByName(FlatBufferBuilder builder, VectorOffset clipsByNameOffset) { builder.AddOffset(2, clipsByNameOffset.Value, 0); }
+  public static VectorOffset CreateClipsByNameVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartClipsByNameVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static Offset<clipDirectory> EndclipDirectory(FlatBufferBuilder builder) {
+    int o = builder.EndObject();
+    return new Offset<clipDirectory>(o);
+  }
+};
+
+
+}
@@ -19,13 +19,17 @@ public sealed class mesh : Table {
   public meshRegion GetRegions(int j) { return GetRegions(new meshRegion(), j); }
   public meshRegion GetRegions(meshRegion obj, int j) { int o = __offset(10); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
   public int RegionsLength { get { int o = __offset(10); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetRegionsByName(int j) { int o = __offset(12); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int RegionsByNameLength { get { int o = __offset(12); return o != 0 ? __vector_len(o) : 0; } }
 
   public static Offset<mesh> Createmesh(FlatBufferBuilder builder,
       VectorOffset points = default(VectorOffset),
       VectorOffset uvs = default(VectorOffset),
       VectorOffset indices = default(VectorOffset),
-      VectorOffset regions = default(VectorOffset)) {
-    builder.StartObject(4);
+      VectorOffset regions = default(VectorOffset),
+      VectorOffset regions_by_name = default(VectorOffset)) {
+    builder.StartObject(5);
+    mesh.AddRegionsByName(builder, regions_by_name);
     mesh.AddRegions(builder, regions);
     mesh.AddIndices(builder, indices);
     mesh.AddUvs(builder, uvs);
@@ -33,7 +37,7 @@ public sealed class mesh : Table {
     return mesh.Endmesh(builder);
   }
 
-  public static void Startmesh(FlatBufferBuilder builder) { builder.StartObject(4); }
+  public static void Startmesh(FlatBufferBuilder builder) { builder.StartObject(5); }
   public static void AddPoints(FlatBufferBuilder builder, VectorOffset pointsOffset) { builder.AddOffset(0, pointsOffset.Value, 0); }
   public static VectorOffset CreatePointsVector(FlatBufferBuilder builder, float[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddFloat(data[i]); return builder.EndVector(); }
   public static void StartPointsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
@@ -46,6 +50,9 @@ public sealed class mesh : Table {
   public static void AddRegions(FlatBufferBuilder builder, VectorOffset regionsOffset) { builder.AddOffset(3, regionsOffset.Value, 0); }
   public static VectorOffset CreateRegionsVector(FlatBufferBuilder builder, Offset<meshRegion>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
   public static void StartRegionsVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddRegionsByName(FlatBufferBuilder builder, VectorOffset regionsByNameOffset) { builder.AddOffset(4, regionsByNameOffset.Value, 0); }
+  public static VectorOffset CreateRegionsByNameVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartRegionsByNameVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<mesh> Endmesh(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<mesh>(o);
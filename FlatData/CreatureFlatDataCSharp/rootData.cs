@@ -8,6 +8,7 @@ using FlatBuffers;
 public sealed class rootData : Table {
   public static rootData GetRootAsrootData(ByteBuffer _bb) { return GetRootAsrootData(_bb, new rootData()); }
   public static rootData GetRootAsrootData(ByteBuffer _bb, rootData obj) { return (obj.__init(_bb.GetInt(_bb.Position) + _bb.Position, _bb)); }
+  public static bool rootDataBufferHasIdentifier(ByteBuffer _bb) { return __has_identifier(_bb, "CRFD"); }
   public rootData __init(int _i, ByteBuffer _bb) { bb_pos = _i; bb = _bb; return this; }
 
   public mesh DataMesh { get { return GetDataMesh(new mesh()); } }
@@ -20,14 +21,21 @@ public sealed class rootData : Table {
   public uvSwapItemHolder GetDataUvSwapItem(uvSwapItemHolder obj) { int o = __offset(10); return o != 0 ? obj.__init(__indirect(o + bb_pos), bb) : null; }
   public anchorPointsHolder DataAnchorPoints { get { return GetDataAnchorPoints(new anchorPointsHolder()); } }
   public anchorPointsHolder GetDataAnchorPoints(anchorPointsHolder obj) { int o = __offset(12); return o != 0 ? obj.__init(__indirect(o + bb_pos), bb) : null; }
+  public int Version { get { int o = __offset(14); return o != 0 ? bb.GetInt(o + bb_pos) : (int)1; } }
+  public bakedAnimation DataBakedAnimation { get { return GetDataBakedAnimation(new bakedAnimation()); } }
+  public bakedAnimation GetDataBakedAnimation(bakedAnimation obj) { int o = __offset(16); return o != 0 ? obj.__init(__indirect(o + bb_pos), bb) : null; }
 
   public static Offset<rootData> CreaterootData(FlatBufferBuilder builder,
       Offset<mesh> dataMesh = default(Offset<mesh>),
       Offset<skeleton> dataSkeleton = default(Offset<skeleton>),
       Offset<animation> dataAnimation = default(Offset<animation>),
       Offset<uvSwapItemHolder> dataUvSwapItem = default(Offset<uvSwapItemHolder>),
-      Offset<anchorPointsHolder> dataAnchorPoints = default(Offset<anchorPointsHolder>)) {
-    builder.StartObject(5);
+      Offset<anchorPointsHolder> dataAnchorPoints = default(Offset<anchorPointsHolder>),
+      int version = 1,
+      Offset<bakedAnimation> dataBakedAnimation = default(Offset<bakedAnimation>)) {
+    builder.StartObject(7);
+    rootData.AddDataBakedAnimation(builder, dataBakedAnimation);
+    rootData.AddVersion(builder, version);
     rootData.AddDataAnchorPoints(builder, dataAnchorPoints);
     rootData.AddDataUvSwapItem(builder, dataUvSwapItem);
     rootData.AddDataAnimation(builder, dataAnimation);
@@ -36,17 +44,19 @@ public sealed class rootData : Table {
     return rootData.EndrootData(builder);
   }
 
-  public static void StartrootData(FlatBufferBuilder builder) { builder.StartObject(5); }
+  public static void StartrootData(FlatBufferBuilder builder) { builder.StartObject(7); }
   public static void AddDataMesh(FlatBufferBuilder builder, Offset<mesh> dataMeshOffset) { builder.AddOffset(0, dataMeshOffset.Value, 0); }
   public static void AddDataSkeleton(FlatBufferBuilder builder, Offset<skeleton> dataSkeletonOffset) { builder.AddOffset(1, dataSkeletonOffset.Value, 0); }
   public static void AddDataAnimation(FlatBufferBuilder builder, Offset<animation> dataAnimationOffset) { builder.AddOffset(2, dataAnimationOffset.Value, 0); }
   public static void AddDataUvSwapItem(FlatBufferBuilder builder, Offset<uvSwapItemHolder> dataUvSwapItemOffset) { builder.AddOffset(3, dataUvSwapItemOffset.Value, 0); }
   public static void AddDataAnchorPoints(FlatBufferBuilder builder, Offset<anchorPointsHolder> dataAnchorPointsOffset) { builder.AddOffset(4, dataAnchorPointsOffset.Value, 0); }
+  public static void AddVersion(FlatBufferBuilder builder, int version) { builder.AddInt(5, version, 1); }
+  public static void AddDataBakedAnimation(FlatBufferBuilder builder, Offset<bakedAnimation> dataBakedAnimationOffset) { builder.AddOffset(6, dataBakedAnimationOffset.Value, 0); }
   public static Offset<rootData> EndrootData(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<rootData>(o);
   }
-  public static void FinishrootDataBuffer(FlatBufferBuilder builder, Offset<rootData> offset) { builder.Finish(offset.Value); }
+  public static void FinishrootDataBuffer(FlatBufferBuilder builder, Offset<rootData> offset) { builder.Finish(offset.Value, "CRFD"); }
 };
 
 
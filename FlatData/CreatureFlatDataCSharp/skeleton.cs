@@ -13,18 +13,25 @@ public sealed class skeleton : Table {
   public skeletonBone GetBones(int j) { return GetBones(new skeletonBone(), j); }
   public skeletonBone GetBones(skeletonBone obj, int j) { int o = __offset(4); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
   public int BonesLength { get { int o = __offset(4); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetBonesByName(int j) { int o = __offset(6); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int BonesByNameLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
 
   public static Offset<skeleton> Createskeleton(FlatBufferBuilder builder,
-      VectorOffset bones = default(VectorOffset)) {
-    builder.StartObject(1);
+      VectorOffset bones = default(VectorOffset),
+      VectorOffset bones_by_name = default(VectorOffset)) {
+    builder.StartObject(2);
+    skeleton.AddBonesByName(builder, bones_by_name);
     skeleton.AddBones(builder, bones);
     return skeleton.Endskeleton(builder);
   }
 
-  public static void Startskeleton(FlatBufferBuilder builder) { builder.StartObject(1); }
+  public static void Startskeleton(FlatBufferBuilder builder) { builder.StartObject(2); }
   public static void AddBones(FlatBufferBuilder builder, VectorOffset bonesOffset) { builder.AddOffset(0, bonesOffset.Value, 0); }
   public static VectorOffset CreateBonesVector(FlatBufferBuilder builder, Offset<skeletonBone>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
   public static void StartBonesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddBonesByName(FlatBufferBuilder builder, VectorOffset bonesByNameOffset) { builder.AddOffset(1, bonesByNameOffset.Value, 0); }
+  public static VectorOffset CreateBonesByNameVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartBonesByNameVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<skeleton> Endskeleton(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<skeleton>(o);
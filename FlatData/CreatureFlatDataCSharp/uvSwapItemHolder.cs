@@ -13,18 +13,25 @@ public sealed class uvSwapItemHolder : Table {
   public uvSwapItemMesh GetMeshes(int j) { return GetMeshes(new uvSwapItemMesh(), j); }
   public uvSwapItemMesh GetMeshes(uvSwapItemMesh obj, int j) { int o = __offset(4); return o != 0 ? obj.__init(__indirect(__vector(o) + j * 4), bb) : null; }
   public int MeshesLength { get { int o = __offset(4); return o != 0 ? __vector_len(o) : 0; } }
+  public int GetMeshesByName(int j) { int o = __offset(6); return o != 0 ? bb.GetInt(__vector(o) + j * 4) : (int)0; }
+  public int MeshesByNameLength { get { int o = __offset(6); return o != 0 ? __vector_len(o) : 0; } }
 
   public static Offset<uvSwapItemHolder> CreateuvSwapItemHolder(FlatBufferBuilder builder,
-      VectorOffset meshes = default(VectorOffset)) {
-    builder.StartObject(1);
+      VectorOffset meshes = default(VectorOffset),
+      VectorOffset meshes_by_name = default(VectorOffset)) {
+    builder.StartObject(2);
+    uvSwapItemHolder.AddMeshesByName(builder, meshes_by_name);
     uvSwapItemHolder.AddMeshes(builder, meshes);
     return uvSwapItemHolder.EnduvSwapItemHolder(builder);
   }
 
-  public static void StartuvSwapItemHolder(FlatBufferBuilder builder) { builder.StartObject(1); }
+  public static void StartuvSwapItemHolder(FlatBufferBuilder builder) { builder.StartObject(2); }
   public static void AddMeshes(FlatBufferBuilder builder, VectorOffset meshesOffset) { builder.AddOffset(0, meshesOffset.Value, 0); }
   public static VectorOffset CreateMeshesVector(FlatBufferBuilder builder, Offset<uvSwapItemMesh>[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddOffset(data[i].Value); return builder.EndVector(); }
   public static void StartMeshesVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
+  public static void AddMeshesByName(FlatBufferBuilder builder, VectorOffset meshesByNameOffset) { builder.AddOffset(1, meshesByNameOffset.Value, 0); }
+  public static VectorOffset CreateMeshesByNameVector(FlatBufferBuilder builder, int[] data) { builder.StartVector(4, data.Length, 4); for (int i = data.Length - 1; i >= 0; i--) builder.AddInt(data[i]); return builder.EndVector(); }
+  public static void StartMeshesByNameVector(FlatBufferBuilder builder, int numElems) { builder.StartVector(4, numElems, 4); }
   public static Offset<uvSwapItemHolder> EnduvSwapItemHolder(FlatBufferBuilder builder) {
     int o = builder.EndObject();
     return new Offset<uvSwapItemHolder>(o);
@@ -450,11 +450,36 @@ CreatureFlatData.mesh.prototype.regionsLength = function() {
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.mesh.prototype.regionsByName = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.mesh.prototype.regionsByNameLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.mesh.prototype.regionsByNameArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
 CreatureFlatData.mesh.startmesh = function(builder) {
-  builder.startObject(4);
+  builder.startObject(5);
 };
 
 /**
@@ -573,6 +598,35 @@ CreatureFlatData.mesh.startRegionsVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} regionsByNameOffset
+ */
+CreatureFlatData.mesh.addRegionsByName = function(builder, regionsByNameOffset) {
+  builder.addFieldOffset(4, regionsByNameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.mesh.createRegionsByNameVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.mesh.startRegionsByNameVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
@@ -935,11 +989,36 @@ CreatureFlatData.skeleton.prototype.bonesLength = function() {
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.skeleton.prototype.bonesByName = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.skeleton.prototype.bonesByNameLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.skeleton.prototype.bonesByNameArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
 CreatureFlatData.skeleton.startskeleton = function(builder) {
-  builder.startObject(1);
+  builder.startObject(2);
 };
 
 /**
@@ -971,6 +1050,35 @@ CreatureFlatData.skeleton.startBonesVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} bonesByNameOffset
+ */
+CreatureFlatData.skeleton.addBonesByName = function(builder, bonesByNameOffset) {
+  builder.addFieldOffset(1, bonesByNameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.skeleton.createBonesByNameVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.skeleton.startBonesByNameVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
@@ -1074,11 +1182,19 @@ CreatureFlatData.animationBone.prototype.endPtArray = function() {
   return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationBone.prototype.boneIndex = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : -1;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
 CreatureFlatData.animationBone.startanimationBone = function(builder) {
-  builder.startObject(3);
+  builder.startObject(4);
 };
 
 /**
@@ -1147,6 +1263,14 @@ CreatureFlatData.animationBone.startEndPtVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} boneIndex
+ */
+CreatureFlatData.animationBone.addBoneIndex = function(builder, boneIndex) {
+  builder.addFieldInt32(3, boneIndex, -1);
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
@@ -1371,7 +1495,7 @@ CreatureFlatData.animationBonesList.endanimationBonesList = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.animationMesh = function() {
+CreatureFlatData.animationBonesTrack = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -1386,9 +1510,9 @@ CreatureFlatData.animationMesh = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationMesh}
+ * @returns {CreatureFlatData.animationBonesTrack}
  */
-CreatureFlatData.animationMesh.prototype.__init = function(i, bb) {
+CreatureFlatData.animationBonesTrack.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -1396,51 +1520,101 @@ CreatureFlatData.animationMesh.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationMesh=} obj
- * @returns {CreatureFlatData.animationMesh}
+ * @param {CreatureFlatData.animationBonesTrack=} obj
+ * @returns {CreatureFlatData.animationBonesTrack}
  */
-CreatureFlatData.animationMesh.getRootAsanimationMesh = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationMesh).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.animationBonesTrack.getRootAsanimationBonesTrack = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationBonesTrack).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
- * @param {flatbuffers.Encoding=} optionalEncoding
- * @returns {string|Uint8Array}
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.name = function(optionalEncoding) {
+CreatureFlatData.animationBonesTrack.prototype.times = function(index) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
- * @returns {boolean}
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.useDq = function() {
+CreatureFlatData.animationBonesTrack.prototype.timesLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.animationBonesTrack.prototype.timesArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationBonesTrack.prototype.positions = function(index) {
   var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
- * @returns {boolean}
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.useLocalDisplacements = function() {
+CreatureFlatData.animationBonesTrack.prototype.positionsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationBonesTrack.prototype.positionsArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationBonesTrack.prototype.boneCount = function() {
   var offset = this.bb.__offset(this.bb_pos, 8);
-  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
 };
 
 /**
- * @returns {boolean}
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.usePostDisplacements = function() {
+CreatureFlatData.animationBonesTrack.prototype.positionsQ = function(index) {
   var offset = this.bb.__offset(this.bb_pos, 10);
-  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
+  return offset ? this.bb.readUint16(this.bb.__vector(this.bb_pos + offset) + index * 2) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationBonesTrack.prototype.positionsQLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Uint16Array}
+ */
+CreatureFlatData.animationBonesTrack.prototype.positionsQArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? new Uint16Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
  * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.localDisplacements = function(index) {
+CreatureFlatData.animationBonesTrack.prototype.rangeMin = function(index) {
   var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
@@ -1448,7 +1622,7 @@ CreatureFlatData.animationMesh.prototype.localDisplacements = function(index) {
 /**
  * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.localDisplacementsLength = function() {
+CreatureFlatData.animationBonesTrack.prototype.rangeMinLength = function() {
   var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
@@ -1456,7 +1630,7 @@ CreatureFlatData.animationMesh.prototype.localDisplacementsLength = function() {
 /**
  * @returns {Float32Array}
  */
-CreatureFlatData.animationMesh.prototype.localDisplacementsArray = function() {
+CreatureFlatData.animationBonesTrack.prototype.rangeMinArray = function() {
   var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
@@ -1465,7 +1639,7 @@ CreatureFlatData.animationMesh.prototype.localDisplacementsArray = function() {
  * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.postDisplacements = function(index) {
+CreatureFlatData.animationBonesTrack.prototype.rangeExtent = function(index) {
   var offset = this.bb.__offset(this.bb_pos, 14);
   return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
@@ -1473,7 +1647,7 @@ CreatureFlatData.animationMesh.prototype.postDisplacements = function(index) {
 /**
  * @returns {number}
  */
-CreatureFlatData.animationMesh.prototype.postDisplacementsLength = function() {
+CreatureFlatData.animationBonesTrack.prototype.rangeExtentLength = function() {
   var offset = this.bb.__offset(this.bb_pos, 14);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
@@ -1481,56 +1655,65 @@ CreatureFlatData.animationMesh.prototype.postDisplacementsLength = function() {
 /**
  * @returns {Float32Array}
  */
-CreatureFlatData.animationMesh.prototype.postDisplacementsArray = function() {
+CreatureFlatData.animationBonesTrack.prototype.rangeExtentArray = function() {
   var offset = this.bb.__offset(this.bb_pos, 14);
   return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.startanimationMesh = function(builder) {
-  builder.startObject(6);
+CreatureFlatData.animationBonesTrack.prototype.quantizeBits = function() {
+  var offset = this.bb.__offset(this.bb_pos, 16);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} nameOffset
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.addName = function(builder, nameOffset) {
-  builder.addFieldOffset(0, nameOffset, 0);
+CreatureFlatData.animationBonesTrack.prototype.deltaInterval = function() {
+  var offset = this.bb.__offset(this.bb_pos, 18);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {boolean} useDq
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.addUseDq = function(builder, useDq) {
-  builder.addFieldInt8(1, +useDq, +false);
+CreatureFlatData.animationBonesTrack.prototype.animatedBones = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 20);
+  return offset ? this.bb.readUint8(this.bb.__vector(this.bb_pos + offset) + index * 1) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {boolean} useLocalDisplacements
+ * @returns {number}
  */
-CreatureFlatData.animationMesh.addUseLocalDisplacements = function(builder, useLocalDisplacements) {
-  builder.addFieldInt8(2, +useLocalDisplacements, +false);
+CreatureFlatData.animationBonesTrack.prototype.animatedBonesLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 20);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Uint8Array}
+ */
+CreatureFlatData.animationBonesTrack.prototype.animatedBonesArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 20);
+  return offset ? new Uint8Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {boolean} usePostDisplacements
  */
-CreatureFlatData.animationMesh.addUsePostDisplacements = function(builder, usePostDisplacements) {
-  builder.addFieldInt8(3, +usePostDisplacements, +false);
+CreatureFlatData.animationBonesTrack.startanimationBonesTrack = function(builder) {
+  builder.startObject(9);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} localDisplacementsOffset
+ * @param {flatbuffers.Offset} timesOffset
  */
-CreatureFlatData.animationMesh.addLocalDisplacements = function(builder, localDisplacementsOffset) {
-  builder.addFieldOffset(4, localDisplacementsOffset, 0);
+CreatureFlatData.animationBonesTrack.addTimes = function(builder, timesOffset) {
+  builder.addFieldOffset(0, timesOffset, 0);
 };
 
 /**
@@ -1538,10 +1721,10 @@ CreatureFlatData.animationMesh.addLocalDisplacements = function(builder, localDi
  * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMesh.createLocalDisplacementsVector = function(builder, data) {
+CreatureFlatData.animationBonesTrack.createTimesVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
-    builder.addFloat32(data[i]);
+    builder.addInt32(data[i]);
   }
   return builder.endVector();
 };
@@ -1550,16 +1733,16 @@ CreatureFlatData.animationMesh.createLocalDisplacementsVector = function(builder
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationMesh.startLocalDisplacementsVector = function(builder, numElems) {
+CreatureFlatData.animationBonesTrack.startTimesVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} postDisplacementsOffset
+ * @param {flatbuffers.Offset} positionsOffset
  */
-CreatureFlatData.animationMesh.addPostDisplacements = function(builder, postDisplacementsOffset) {
-  builder.addFieldOffset(5, postDisplacementsOffset, 0);
+CreatureFlatData.animationBonesTrack.addPositions = function(builder, positionsOffset) {
+  builder.addFieldOffset(1, positionsOffset, 0);
 };
 
 /**
@@ -1567,7 +1750,7 @@ CreatureFlatData.animationMesh.addPostDisplacements = function(builder, postDisp
  * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMesh.createPostDisplacementsVector = function(builder, data) {
+CreatureFlatData.animationBonesTrack.createPositionsVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addFloat32(data[i]);
@@ -1579,104 +1762,64 @@ CreatureFlatData.animationMesh.createPostDisplacementsVector = function(builder,
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationMesh.startPostDisplacementsVector = function(builder, numElems) {
+CreatureFlatData.animationBonesTrack.startPositionsVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @returns {flatbuffers.Offset}
+ * @param {number} boneCount
  */
-CreatureFlatData.animationMesh.endanimationMesh = function(builder) {
-  var offset = builder.endObject();
-  return offset;
+CreatureFlatData.animationBonesTrack.addBoneCount = function(builder, boneCount) {
+  builder.addFieldInt32(2, boneCount, 0);
 };
 
 /**
- * @constructor
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} positionsQOffset
  */
-CreatureFlatData.animationMeshTimeSample = function() {
-  /**
-   * @type {flatbuffers.ByteBuffer}
-   */
-  this.bb = null;
-
-  /**
-   * @type {number}
-   */
-  this.bb_pos = 0;
+CreatureFlatData.animationBonesTrack.addPositionsQ = function(builder, positionsQOffset) {
+  builder.addFieldOffset(3, positionsQOffset, 0);
 };
 
 /**
- * @param {number} i
- * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationMeshTimeSample}
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshTimeSample.prototype.__init = function(i, bb) {
-  this.bb_pos = i;
-  this.bb = bb;
-  return this;
-};
-
-/**
- * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationMeshTimeSample=} obj
- * @returns {CreatureFlatData.animationMeshTimeSample}
- */
-CreatureFlatData.animationMeshTimeSample.getRootAsanimationMeshTimeSample = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationMeshTimeSample).__init(bb.readInt32(bb.position()) + bb.position(), bb);
-};
-
-/**
- * @param {number} index
- * @param {CreatureFlatData.animationMesh=} obj
- * @returns {CreatureFlatData.animationMesh}
- */
-CreatureFlatData.animationMeshTimeSample.prototype.meshes = function(index, obj) {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.animationMesh).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
-};
-
-/**
- * @returns {number}
- */
-CreatureFlatData.animationMeshTimeSample.prototype.meshesLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
-};
-
-/**
- * @returns {number}
- */
-CreatureFlatData.animationMeshTimeSample.prototype.time = function() {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+CreatureFlatData.animationBonesTrack.createPositionsQVector = function(builder, data) {
+  builder.startVector(2, data.length, 2);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt16(data[i]);
+  }
+  return builder.endVector();
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
  */
-CreatureFlatData.animationMeshTimeSample.startanimationMeshTimeSample = function(builder) {
-  builder.startObject(2);
+CreatureFlatData.animationBonesTrack.startPositionsQVector = function(builder, numElems) {
+  builder.startVector(2, numElems, 2);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} meshesOffset
+ * @param {flatbuffers.Offset} rangeMinOffset
  */
-CreatureFlatData.animationMeshTimeSample.addMeshes = function(builder, meshesOffset) {
-  builder.addFieldOffset(0, meshesOffset, 0);
+CreatureFlatData.animationBonesTrack.addRangeMin = function(builder, rangeMinOffset) {
+  builder.addFieldOffset(4, rangeMinOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {Array.<flatbuffers.Offset>} data
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshTimeSample.createMeshesVector = function(builder, data) {
+CreatureFlatData.animationBonesTrack.createRangeMinVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
-    builder.addOffset(data[i]);
+    builder.addFloat32(data[i]);
   }
   return builder.endVector();
 };
@@ -1685,104 +1828,72 @@ CreatureFlatData.animationMeshTimeSample.createMeshesVector = function(builder,
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationMeshTimeSample.startMeshesVector = function(builder, numElems) {
+CreatureFlatData.animationBonesTrack.startRangeMinVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} time
+ * @param {flatbuffers.Offset} rangeExtentOffset
  */
-CreatureFlatData.animationMeshTimeSample.addTime = function(builder, time) {
-  builder.addFieldInt32(1, time, 0);
+CreatureFlatData.animationBonesTrack.addRangeExtent = function(builder, rangeExtentOffset) {
+  builder.addFieldOffset(5, rangeExtentOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshTimeSample.endanimationMeshTimeSample = function(builder) {
-  var offset = builder.endObject();
-  return offset;
-};
-
-/**
- * @constructor
- */
-CreatureFlatData.animationMeshList = function() {
-  /**
-   * @type {flatbuffers.ByteBuffer}
-   */
-  this.bb = null;
-
-  /**
-   * @type {number}
-   */
-  this.bb_pos = 0;
-};
-
-/**
- * @param {number} i
- * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationMeshList}
- */
-CreatureFlatData.animationMeshList.prototype.__init = function(i, bb) {
-  this.bb_pos = i;
-  this.bb = bb;
-  return this;
-};
-
-/**
- * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationMeshList=} obj
- * @returns {CreatureFlatData.animationMeshList}
- */
-CreatureFlatData.animationMeshList.getRootAsanimationMeshList = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationMeshList).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.animationBonesTrack.createRangeExtentVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
 };
 
 /**
- * @param {number} index
- * @param {CreatureFlatData.animationMeshTimeSample=} obj
- * @returns {CreatureFlatData.animationMeshTimeSample}
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
  */
-CreatureFlatData.animationMeshList.prototype.timeSamples = function(index, obj) {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.animationMeshTimeSample).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+CreatureFlatData.animationBonesTrack.startRangeExtentVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
 };
 
 /**
- * @returns {number}
+ * @param {flatbuffers.Builder} builder
+ * @param {number} quantizeBits
  */
-CreatureFlatData.animationMeshList.prototype.timeSamplesLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+CreatureFlatData.animationBonesTrack.addQuantizeBits = function(builder, quantizeBits) {
+  builder.addFieldInt32(6, quantizeBits, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {number} deltaInterval
  */
-CreatureFlatData.animationMeshList.startanimationMeshList = function(builder) {
-  builder.startObject(1);
+CreatureFlatData.animationBonesTrack.addDeltaInterval = function(builder, deltaInterval) {
+  builder.addFieldInt32(7, deltaInterval, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} timeSamplesOffset
+ * @param {flatbuffers.Offset} animatedBonesOffset
  */
-CreatureFlatData.animationMeshList.addTimeSamples = function(builder, timeSamplesOffset) {
-  builder.addFieldOffset(0, timeSamplesOffset, 0);
+CreatureFlatData.animationBonesTrack.addAnimatedBones = function(builder, animatedBonesOffset) {
+  builder.addFieldOffset(8, animatedBonesOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {Array.<flatbuffers.Offset>} data
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshList.createTimeSamplesVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
+CreatureFlatData.animationBonesTrack.createAnimatedBonesVector = function(builder, data) {
+  builder.startVector(1, data.length, 1);
   for (var i = data.length - 1; i >= 0; i--) {
-    builder.addOffset(data[i]);
+    builder.addInt8(data[i]);
   }
   return builder.endVector();
 };
@@ -1791,15 +1902,15 @@ CreatureFlatData.animationMeshList.createTimeSamplesVector = function(builder, d
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationMeshList.startTimeSamplesVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.animationBonesTrack.startAnimatedBonesVector = function(builder, numElems) {
+  builder.startVector(1, numElems, 1);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshList.endanimationMeshList = function(builder) {
+CreatureFlatData.animationBonesTrack.endanimationBonesTrack = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -1807,7 +1918,7 @@ CreatureFlatData.animationMeshList.endanimationMeshList = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.animationUVSwap = function() {
+CreatureFlatData.animationMesh = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -1822,9 +1933,9 @@ CreatureFlatData.animationUVSwap = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationUVSwap}
+ * @returns {CreatureFlatData.animationMesh}
  */
-CreatureFlatData.animationUVSwap.prototype.__init = function(i, bb) {
+CreatureFlatData.animationMesh.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -1832,69 +1943,68 @@ CreatureFlatData.animationUVSwap.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationUVSwap=} obj
- * @returns {CreatureFlatData.animationUVSwap}
+ * @param {CreatureFlatData.animationMesh=} obj
+ * @returns {CreatureFlatData.animationMesh}
  */
-CreatureFlatData.animationUVSwap.getRootAsanimationUVSwap = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationUVSwap).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.animationMesh.getRootAsanimationMesh = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationMesh).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
  * @param {flatbuffers.Encoding=} optionalEncoding
  * @returns {string|Uint8Array}
  */
-CreatureFlatData.animationUVSwap.prototype.name = function(optionalEncoding) {
+CreatureFlatData.animationMesh.prototype.name = function(optionalEncoding) {
   var offset = this.bb.__offset(this.bb_pos, 4);
   return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
 };
 
 /**
- * @param {number} index
- * @returns {number}
+ * @returns {boolean}
  */
-CreatureFlatData.animationUVSwap.prototype.localOffset = function(index) {
+CreatureFlatData.animationMesh.prototype.useDq = function() {
   var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
 };
 
 /**
- * @returns {number}
+ * @returns {boolean}
  */
-CreatureFlatData.animationUVSwap.prototype.localOffsetLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+CreatureFlatData.animationMesh.prototype.useLocalDisplacements = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
 };
 
 /**
- * @returns {Float32Array}
+ * @returns {boolean}
  */
-CreatureFlatData.animationUVSwap.prototype.localOffsetArray = function() {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+CreatureFlatData.animationMesh.prototype.usePostDisplacements = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
 };
 
 /**
  * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.animationUVSwap.prototype.globalOffset = function(index) {
-  var offset = this.bb.__offset(this.bb_pos, 8);
+CreatureFlatData.animationMesh.prototype.localDisplacements = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.animationUVSwap.prototype.globalOffsetLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 8);
+CreatureFlatData.animationMesh.prototype.localDisplacementsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
  * @returns {Float32Array}
  */
-CreatureFlatData.animationUVSwap.prototype.globalOffsetArray = function() {
-  var offset = this.bb.__offset(this.bb_pos, 8);
+CreatureFlatData.animationMesh.prototype.localDisplacementsArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
@@ -1902,125 +2012,1698 @@ CreatureFlatData.animationUVSwap.prototype.globalOffsetArray = function() {
  * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.animationUVSwap.prototype.scale = function(index) {
-  var offset = this.bb.__offset(this.bb_pos, 10);
+CreatureFlatData.animationMesh.prototype.postDisplacements = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 14);
   return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.animationUVSwap.prototype.scaleLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 10);
+CreatureFlatData.animationMesh.prototype.postDisplacementsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 14);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
  * @returns {Float32Array}
  */
-CreatureFlatData.animationUVSwap.prototype.scaleArray = function() {
-  var offset = this.bb.__offset(this.bb_pos, 10);
+CreatureFlatData.animationMesh.prototype.postDisplacementsArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 14);
   return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
- * @returns {boolean}
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwap.prototype.enabled = function() {
-  var offset = this.bb.__offset(this.bb_pos, 12);
-  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
+CreatureFlatData.animationMesh.prototype.regionIndex = function() {
+  var offset = this.bb.__offset(this.bb_pos, 16);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : -1;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwap.startanimationUVSwap = function(builder) {
-  builder.startObject(5);
+CreatureFlatData.animationMesh.prototype.localDisplacementsQ = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 18);
+  return offset ? this.bb.readUint16(this.bb.__vector(this.bb_pos + offset) + index * 2) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} nameOffset
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwap.addName = function(builder, nameOffset) {
-  builder.addFieldOffset(0, nameOffset, 0);
+CreatureFlatData.animationMesh.prototype.localDisplacementsQLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 18);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} localOffsetOffset
+ * @returns {Uint16Array}
  */
-CreatureFlatData.animationUVSwap.addLocalOffset = function(builder, localOffsetOffset) {
-  builder.addFieldOffset(1, localOffsetOffset, 0);
+CreatureFlatData.animationMesh.prototype.localDisplacementsQArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 18);
+  return offset ? new Uint16Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {Array.<number>} data
- * @returns {flatbuffers.Offset}
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwap.createLocalOffsetVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
-  for (var i = data.length - 1; i >= 0; i--) {
-    builder.addFloat32(data[i]);
-  }
-  return builder.endVector();
+CreatureFlatData.animationMesh.prototype.postDisplacementsQ = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 20);
+  return offset ? this.bb.readUint16(this.bb.__vector(this.bb_pos + offset) + index * 2) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {number} numElems
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwap.startLocalOffsetVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.animationMesh.prototype.postDisplacementsQLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 20);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} globalOffsetOffset
+ * @returns {Uint16Array}
  */
-CreatureFlatData.animationUVSwap.addGlobalOffset = function(builder, globalOffsetOffset) {
-  builder.addFieldOffset(2, globalOffsetOffset, 0);
+CreatureFlatData.animationMesh.prototype.postDisplacementsQArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 20);
+  return offset ? new Uint16Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {Array.<number>} data
- * @returns {flatbuffers.Offset}
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwap.createGlobalOffsetVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
-  for (var i = data.length - 1; i >= 0; i--) {
-    builder.addFloat32(data[i]);
-  }
-  return builder.endVector();
+CreatureFlatData.animationMesh.prototype.localDisplacementsRuns = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 22);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {number} numElems
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwap.startGlobalOffsetVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.animationMesh.prototype.localDisplacementsRunsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 22);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} scaleOffset
+ * @returns {Int32Array}
  */
-CreatureFlatData.animationUVSwap.addScale = function(builder, scaleOffset) {
-  builder.addFieldOffset(3, scaleOffset, 0);
+CreatureFlatData.animationMesh.prototype.localDisplacementsRunsArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 22);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {Array.<number>} data
- * @returns {flatbuffers.Offset}
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationMesh.prototype.localDisplacementsSparse = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 24);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMesh.prototype.localDisplacementsSparseLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 24);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationMesh.prototype.localDisplacementsSparseArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 24);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationMesh.prototype.postDisplacementsRuns = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 26);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMesh.prototype.postDisplacementsRunsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 26);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.animationMesh.prototype.postDisplacementsRunsArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 26);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationMesh.prototype.postDisplacementsSparse = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 28);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMesh.prototype.postDisplacementsSparseLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 28);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationMesh.prototype.postDisplacementsSparseArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 28);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationMesh.startanimationMesh = function(builder) {
+  builder.startObject(13);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} nameOffset
+ */
+CreatureFlatData.animationMesh.addName = function(builder, nameOffset) {
+  builder.addFieldOffset(0, nameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {boolean} useDq
+ */
+CreatureFlatData.animationMesh.addUseDq = function(builder, useDq) {
+  builder.addFieldInt8(1, +useDq, +false);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {boolean} useLocalDisplacements
+ */
+CreatureFlatData.animationMesh.addUseLocalDisplacements = function(builder, useLocalDisplacements) {
+  builder.addFieldInt8(2, +useLocalDisplacements, +false);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {boolean} usePostDisplacements
+ */
+CreatureFlatData.animationMesh.addUsePostDisplacements = function(builder, usePostDisplacements) {
+  builder.addFieldInt8(3, +usePostDisplacements, +false);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} localDisplacementsOffset
+ */
+CreatureFlatData.animationMesh.addLocalDisplacements = function(builder, localDisplacementsOffset) {
+  builder.addFieldOffset(4, localDisplacementsOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createLocalDisplacementsVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startLocalDisplacementsVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} postDisplacementsOffset
+ */
+CreatureFlatData.animationMesh.addPostDisplacements = function(builder, postDisplacementsOffset) {
+  builder.addFieldOffset(5, postDisplacementsOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createPostDisplacementsVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startPostDisplacementsVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} regionIndex
+ */
+CreatureFlatData.animationMesh.addRegionIndex = function(builder, regionIndex) {
+  builder.addFieldInt32(6, regionIndex, -1);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} localDisplacementsQOffset
+ */
+CreatureFlatData.animationMesh.addLocalDisplacementsQ = function(builder, localDisplacementsQOffset) {
+  builder.addFieldOffset(7, localDisplacementsQOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createLocalDisplacementsQVector = function(builder, data) {
+  builder.startVector(2, data.length, 2);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt16(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startLocalDisplacementsQVector = function(builder, numElems) {
+  builder.startVector(2, numElems, 2);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} postDisplacementsQOffset
+ */
+CreatureFlatData.animationMesh.addPostDisplacementsQ = function(builder, postDisplacementsQOffset) {
+  builder.addFieldOffset(8, postDisplacementsQOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createPostDisplacementsQVector = function(builder, data) {
+  builder.startVector(2, data.length, 2);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt16(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startPostDisplacementsQVector = function(builder, numElems) {
+  builder.startVector(2, numElems, 2);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} localDisplacementsRunsOffset
+ */
+CreatureFlatData.animationMesh.addLocalDisplacementsRuns = function(builder, localDisplacementsRunsOffset) {
+  builder.addFieldOffset(9, localDisplacementsRunsOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createLocalDisplacementsRunsVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startLocalDisplacementsRunsVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} localDisplacementsSparseOffset
+ */
+CreatureFlatData.animationMesh.addLocalDisplacementsSparse = function(builder, localDisplacementsSparseOffset) {
+  builder.addFieldOffset(10, localDisplacementsSparseOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createLocalDisplacementsSparseVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startLocalDisplacementsSparseVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} postDisplacementsRunsOffset
+ */
+CreatureFlatData.animationMesh.addPostDisplacementsRuns = function(builder, postDisplacementsRunsOffset) {
+  builder.addFieldOffset(11, postDisplacementsRunsOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createPostDisplacementsRunsVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startPostDisplacementsRunsVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} postDisplacementsSparseOffset
+ */
+CreatureFlatData.animationMesh.addPostDisplacementsSparse = function(builder, postDisplacementsSparseOffset) {
+  builder.addFieldOffset(12, postDisplacementsSparseOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.createPostDisplacementsSparseVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMesh.startPostDisplacementsSparseVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMesh.endanimationMesh = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationMeshTimeSample = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationMeshTimeSample}
+ */
+CreatureFlatData.animationMeshTimeSample.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationMeshTimeSample=} obj
+ * @returns {CreatureFlatData.animationMeshTimeSample}
+ */
+CreatureFlatData.animationMeshTimeSample.getRootAsanimationMeshTimeSample = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationMeshTimeSample).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.animationMesh=} obj
+ * @returns {CreatureFlatData.animationMesh}
+ */
+CreatureFlatData.animationMeshTimeSample.prototype.meshes = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? (obj || new CreatureFlatData.animationMesh).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshTimeSample.prototype.meshesLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshTimeSample.prototype.time = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationMeshTimeSample.startanimationMeshTimeSample = function(builder) {
+  builder.startObject(2);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} meshesOffset
+ */
+CreatureFlatData.animationMeshTimeSample.addMeshes = function(builder, meshesOffset) {
+  builder.addFieldOffset(0, meshesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<flatbuffers.Offset>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshTimeSample.createMeshesVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addOffset(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMeshTimeSample.startMeshesVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} time
+ */
+CreatureFlatData.animationMeshTimeSample.addTime = function(builder, time) {
+  builder.addFieldInt32(1, time, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshTimeSample.endanimationMeshTimeSample = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationMeshList = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationMeshList}
+ */
+CreatureFlatData.animationMeshList.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationMeshList=} obj
+ * @returns {CreatureFlatData.animationMeshList}
+ */
+CreatureFlatData.animationMeshList.getRootAsanimationMeshList = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationMeshList).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.animationMeshTimeSample=} obj
+ * @returns {CreatureFlatData.animationMeshTimeSample}
+ */
+CreatureFlatData.animationMeshList.prototype.timeSamples = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? (obj || new CreatureFlatData.animationMeshTimeSample).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.timeSamplesLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.localRangeMin = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.localRangeMinLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationMeshList.prototype.localRangeMinArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.localRangeExtent = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.localRangeExtentLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationMeshList.prototype.localRangeExtentArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.postRangeMin = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.postRangeMinLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationMeshList.prototype.postRangeMinArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.postRangeExtent = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.postRangeExtentLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationMeshList.prototype.postRangeExtentArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.quantizeBits = function() {
+  var offset = this.bb.__offset(this.bb_pos, 14);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshList.prototype.deltaInterval = function() {
+  var offset = this.bb.__offset(this.bb_pos, 16);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationMeshList.startanimationMeshList = function(builder) {
+  builder.startObject(7);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} timeSamplesOffset
+ */
+CreatureFlatData.animationMeshList.addTimeSamples = function(builder, timeSamplesOffset) {
+  builder.addFieldOffset(0, timeSamplesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<flatbuffers.Offset>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshList.createTimeSamplesVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addOffset(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMeshList.startTimeSamplesVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} localRangeMinOffset
+ */
+CreatureFlatData.animationMeshList.addLocalRangeMin = function(builder, localRangeMinOffset) {
+  builder.addFieldOffset(1, localRangeMinOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshList.createLocalRangeMinVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMeshList.startLocalRangeMinVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} localRangeExtentOffset
+ */
+CreatureFlatData.animationMeshList.addLocalRangeExtent = function(builder, localRangeExtentOffset) {
+  builder.addFieldOffset(2, localRangeExtentOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshList.createLocalRangeExtentVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMeshList.startLocalRangeExtentVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} postRangeMinOffset
+ */
+CreatureFlatData.animationMeshList.addPostRangeMin = function(builder, postRangeMinOffset) {
+  builder.addFieldOffset(3, postRangeMinOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshList.createPostRangeMinVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMeshList.startPostRangeMinVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} postRangeExtentOffset
+ */
+CreatureFlatData.animationMeshList.addPostRangeExtent = function(builder, postRangeExtentOffset) {
+  builder.addFieldOffset(4, postRangeExtentOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshList.createPostRangeExtentVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMeshList.startPostRangeExtentVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} quantizeBits
+ */
+CreatureFlatData.animationMeshList.addQuantizeBits = function(builder, quantizeBits) {
+  builder.addFieldInt32(5, quantizeBits, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} deltaInterval
+ */
+CreatureFlatData.animationMeshList.addDeltaInterval = function(builder, deltaInterval) {
+  builder.addFieldInt32(6, deltaInterval, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshList.endanimationMeshList = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationUVSwap = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationUVSwap}
+ */
+CreatureFlatData.animationUVSwap.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationUVSwap=} obj
+ * @returns {CreatureFlatData.animationUVSwap}
+ */
+CreatureFlatData.animationUVSwap.getRootAsanimationUVSwap = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationUVSwap).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {flatbuffers.Encoding=} optionalEncoding
+ * @returns {string|Uint8Array}
+ */
+CreatureFlatData.animationUVSwap.prototype.name = function(optionalEncoding) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwap.prototype.localOffset = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwap.prototype.localOffsetLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationUVSwap.prototype.localOffsetArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwap.prototype.globalOffset = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwap.prototype.globalOffsetLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationUVSwap.prototype.globalOffsetArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwap.prototype.scale = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwap.prototype.scaleLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.animationUVSwap.prototype.scaleArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @returns {boolean}
+ */
+CreatureFlatData.animationUVSwap.prototype.enabled = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? !!this.bb.readInt8(this.bb_pos + offset) : false;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwap.prototype.regionIndex = function() {
+  var offset = this.bb.__offset(this.bb_pos, 14);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : -1;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationUVSwap.startanimationUVSwap = function(builder) {
+  builder.startObject(6);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} nameOffset
+ */
+CreatureFlatData.animationUVSwap.addName = function(builder, nameOffset) {
+  builder.addFieldOffset(0, nameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} localOffsetOffset
+ */
+CreatureFlatData.animationUVSwap.addLocalOffset = function(builder, localOffsetOffset) {
+  builder.addFieldOffset(1, localOffsetOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationUVSwap.createLocalOffsetVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationUVSwap.startLocalOffsetVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} globalOffsetOffset
+ */
+CreatureFlatData.animationUVSwap.addGlobalOffset = function(builder, globalOffsetOffset) {
+  builder.addFieldOffset(2, globalOffsetOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationUVSwap.createGlobalOffsetVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationUVSwap.startGlobalOffsetVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} scaleOffset
+ */
+CreatureFlatData.animationUVSwap.addScale = function(builder, scaleOffset) {
+  builder.addFieldOffset(3, scaleOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
  */
 CreatureFlatData.animationUVSwap.createScaleVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
-    builder.addFloat32(data[i]);
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationUVSwap.startScaleVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {boolean} enabled
+ */
+CreatureFlatData.animationUVSwap.addEnabled = function(builder, enabled) {
+  builder.addFieldInt8(4, +enabled, +false);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} regionIndex
+ */
+CreatureFlatData.animationUVSwap.addRegionIndex = function(builder, regionIndex) {
+  builder.addFieldInt32(5, regionIndex, -1);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationUVSwap.endanimationUVSwap = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationUVSwapTimeSample = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationUVSwapTimeSample}
+ */
+CreatureFlatData.animationUVSwapTimeSample.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationUVSwapTimeSample=} obj
+ * @returns {CreatureFlatData.animationUVSwapTimeSample}
+ */
+CreatureFlatData.animationUVSwapTimeSample.getRootAsanimationUVSwapTimeSample = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationUVSwapTimeSample).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.animationUVSwap=} obj
+ * @returns {CreatureFlatData.animationUVSwap}
+ */
+CreatureFlatData.animationUVSwapTimeSample.prototype.uvSwaps = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? (obj || new CreatureFlatData.animationUVSwap).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwapTimeSample.prototype.uvSwapsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwapTimeSample.prototype.time = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationUVSwapTimeSample.startanimationUVSwapTimeSample = function(builder) {
+  builder.startObject(2);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} uvSwapsOffset
+ */
+CreatureFlatData.animationUVSwapTimeSample.addUvSwaps = function(builder, uvSwapsOffset) {
+  builder.addFieldOffset(0, uvSwapsOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<flatbuffers.Offset>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationUVSwapTimeSample.createUvSwapsVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addOffset(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationUVSwapTimeSample.startUvSwapsVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} time
+ */
+CreatureFlatData.animationUVSwapTimeSample.addTime = function(builder, time) {
+  builder.addFieldInt32(1, time, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationUVSwapTimeSample.endanimationUVSwapTimeSample = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationUVSwapList = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationUVSwapList}
+ */
+CreatureFlatData.animationUVSwapList.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationUVSwapList=} obj
+ * @returns {CreatureFlatData.animationUVSwapList}
+ */
+CreatureFlatData.animationUVSwapList.getRootAsanimationUVSwapList = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationUVSwapList).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.animationUVSwapTimeSample=} obj
+ * @returns {CreatureFlatData.animationUVSwapTimeSample}
+ */
+CreatureFlatData.animationUVSwapList.prototype.timeSamples = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? (obj || new CreatureFlatData.animationUVSwapTimeSample).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationUVSwapList.prototype.timeSamplesLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationUVSwapList.startanimationUVSwapList = function(builder) {
+  builder.startObject(1);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} timeSamplesOffset
+ */
+CreatureFlatData.animationUVSwapList.addTimeSamples = function(builder, timeSamplesOffset) {
+  builder.addFieldOffset(0, timeSamplesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<flatbuffers.Offset>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationUVSwapList.createTimeSamplesVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addOffset(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationUVSwapList.startTimeSamplesVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationUVSwapList.endanimationUVSwapList = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationMeshOpacity = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationMeshOpacity}
+ */
+CreatureFlatData.animationMeshOpacity.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationMeshOpacity=} obj
+ * @returns {CreatureFlatData.animationMeshOpacity}
+ */
+CreatureFlatData.animationMeshOpacity.getRootAsanimationMeshOpacity = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationMeshOpacity).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {flatbuffers.Encoding=} optionalEncoding
+ * @returns {string|Uint8Array}
+ */
+CreatureFlatData.animationMeshOpacity.prototype.name = function(optionalEncoding) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshOpacity.prototype.opacity = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readFloat32(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshOpacity.prototype.regionIndex = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : -1;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationMeshOpacity.startanimationMeshOpacity = function(builder) {
+  builder.startObject(3);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} nameOffset
+ */
+CreatureFlatData.animationMeshOpacity.addName = function(builder, nameOffset) {
+  builder.addFieldOffset(0, nameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} opacity
+ */
+CreatureFlatData.animationMeshOpacity.addOpacity = function(builder, opacity) {
+  builder.addFieldFloat32(1, opacity, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} regionIndex
+ */
+CreatureFlatData.animationMeshOpacity.addRegionIndex = function(builder, regionIndex) {
+  builder.addFieldInt32(2, regionIndex, -1);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshOpacity.endanimationMeshOpacity = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationMeshOpacityTimeSample = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationMeshOpacityTimeSample}
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationMeshOpacityTimeSample=} obj
+ * @returns {CreatureFlatData.animationMeshOpacityTimeSample}
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.getRootAsanimationMeshOpacityTimeSample = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationMeshOpacityTimeSample).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.animationMeshOpacity=} obj
+ * @returns {CreatureFlatData.animationMeshOpacity}
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.prototype.meshOpacities = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? (obj || new CreatureFlatData.animationMeshOpacity).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.prototype.meshOpacitiesLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.prototype.time = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.startanimationMeshOpacityTimeSample = function(builder) {
+  builder.startObject(2);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} meshOpacitiesOffset
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.addMeshOpacities = function(builder, meshOpacitiesOffset) {
+  builder.addFieldOffset(0, meshOpacitiesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<flatbuffers.Offset>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.createMeshOpacitiesVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addOffset(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.startMeshOpacitiesVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} time
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.addTime = function(builder, time) {
+  builder.addFieldInt32(1, time, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshOpacityTimeSample.endanimationMeshOpacityTimeSample = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationMeshOpacityList = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationMeshOpacityList}
+ */
+CreatureFlatData.animationMeshOpacityList.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationMeshOpacityList=} obj
+ * @returns {CreatureFlatData.animationMeshOpacityList}
+ */
+CreatureFlatData.animationMeshOpacityList.getRootAsanimationMeshOpacityList = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationMeshOpacityList).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.animationMeshOpacityTimeSample=} obj
+ * @returns {CreatureFlatData.animationMeshOpacityTimeSample}
+ */
+CreatureFlatData.animationMeshOpacityList.prototype.timeSamples = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? (obj || new CreatureFlatData.animationMeshOpacityTimeSample).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animationMeshOpacityList.prototype.timeSamplesLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationMeshOpacityList.startanimationMeshOpacityList = function(builder) {
+  builder.startObject(1);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} timeSamplesOffset
+ */
+CreatureFlatData.animationMeshOpacityList.addTimeSamples = function(builder, timeSamplesOffset) {
+  builder.addFieldOffset(0, timeSamplesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<flatbuffers.Offset>} data
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animationMeshOpacityList.createTimeSamplesVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addOffset(data[i]);
   }
   return builder.endVector();
 };
@@ -2029,23 +3712,168 @@ CreatureFlatData.animationUVSwap.createScaleVector = function(builder, data) {
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationUVSwap.startScaleVector = function(builder, numElems) {
+CreatureFlatData.animationMeshOpacityList.startTimeSamplesVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {boolean} enabled
+ * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationUVSwap.addEnabled = function(builder, enabled) {
-  builder.addFieldInt8(4, +enabled, +false);
+CreatureFlatData.animationMeshOpacityList.endanimationMeshOpacityList = function(builder) {
+  var offset = builder.endObject();
+  return offset;
+};
+
+/**
+ * @constructor
+ */
+CreatureFlatData.animationClip = function() {
+  /**
+   * @type {flatbuffers.ByteBuffer}
+   */
+  this.bb = null;
+
+  /**
+   * @type {number}
+   */
+  this.bb_pos = 0;
+};
+
+/**
+ * @param {number} i
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {CreatureFlatData.animationClip}
+ */
+CreatureFlatData.animationClip.prototype.__init = function(i, bb) {
+  this.bb_pos = i;
+  this.bb = bb;
+  return this;
+};
+
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.animationClip=} obj
+ * @returns {CreatureFlatData.animationClip}
+ */
+CreatureFlatData.animationClip.getRootAsanimationClip = function(bb, obj) {
+  return (obj || new CreatureFlatData.animationClip).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {flatbuffers.Encoding=} optionalEncoding
+ * @returns {string|Uint8Array}
+ */
+CreatureFlatData.animationClip.prototype.name = function(optionalEncoding) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
+};
+
+/**
+ * @param {CreatureFlatData.animationBonesList=} obj
+ * @returns {CreatureFlatData.animationBonesList}
+ */
+CreatureFlatData.animationClip.prototype.bones = function(obj) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? (obj || new CreatureFlatData.animationBonesList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+};
+
+/**
+ * @param {CreatureFlatData.animationMeshList=} obj
+ * @returns {CreatureFlatData.animationMeshList}
+ */
+CreatureFlatData.animationClip.prototype.meshes = function(obj) {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? (obj || new CreatureFlatData.animationMeshList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+};
+
+/**
+ * @param {CreatureFlatData.animationUVSwapList=} obj
+ * @returns {CreatureFlatData.animationUVSwapList}
+ */
+CreatureFlatData.animationClip.prototype.uvSwaps = function(obj) {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? (obj || new CreatureFlatData.animationUVSwapList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+};
+
+/**
+ * @param {CreatureFlatData.animationMeshOpacityList=} obj
+ * @returns {CreatureFlatData.animationMeshOpacityList}
+ */
+CreatureFlatData.animationClip.prototype.meshOpacities = function(obj) {
+  var offset = this.bb.__offset(this.bb_pos, 12);
+  return offset ? (obj || new CreatureFlatData.animationMeshOpacityList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+};
+
+/**
+ * @param {CreatureFlatData.animationBonesTrack=} obj
+ * @returns {CreatureFlatData.animationBonesTrack}
+ */
+CreatureFlatData.animationClip.prototype.bonesTrack = function(obj) {
+  var offset = this.bb.__offset(this.bb_pos, 14);
+  return offset ? (obj || new CreatureFlatData.animationBonesTrack).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ */
+CreatureFlatData.animationClip.startanimationClip = function(builder) {
+  builder.startObject(6);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} nameOffset
+ */
+CreatureFlatData.animationClip.addName = function(builder, nameOffset) {
+  builder.addFieldOffset(0, nameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} bonesOffset
+ */
+CreatureFlatData.animationClip.addBones = function(builder, bonesOffset) {
+  builder.addFieldOffset(1, bonesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} meshesOffset
+ */
+CreatureFlatData.animationClip.addMeshes = function(builder, meshesOffset) {
+  builder.addFieldOffset(2, meshesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} uvSwapsOffset
+ */
+CreatureFlatData.animationClip.addUvSwaps = function(builder, uvSwapsOffset) {
+  builder.addFieldOffset(3, uvSwapsOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} meshOpacitiesOffset
+ */
+CreatureFlatData.animationClip.addMeshOpacities = function(builder, meshOpacitiesOffset) {
+  builder.addFieldOffset(4, meshOpacitiesOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} bonesTrackOffset
+ */
+CreatureFlatData.animationClip.addBonesTrack = function(builder, bonesTrackOffset) {
+  builder.addFieldOffset(5, bonesTrackOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationUVSwap.endanimationUVSwap = function(builder) {
+CreatureFlatData.animationClip.endanimationClip = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -2053,7 +3881,7 @@ CreatureFlatData.animationUVSwap.endanimationUVSwap = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.animationUVSwapTimeSample = function() {
+CreatureFlatData.animation = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -2068,9 +3896,9 @@ CreatureFlatData.animationUVSwapTimeSample = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationUVSwapTimeSample}
+ * @returns {CreatureFlatData.animation}
  */
-CreatureFlatData.animationUVSwapTimeSample.prototype.__init = function(i, bb) {
+CreatureFlatData.animation.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -2078,52 +3906,69 @@ CreatureFlatData.animationUVSwapTimeSample.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationUVSwapTimeSample=} obj
- * @returns {CreatureFlatData.animationUVSwapTimeSample}
+ * @param {CreatureFlatData.animation=} obj
+ * @returns {CreatureFlatData.animation}
  */
-CreatureFlatData.animationUVSwapTimeSample.getRootAsanimationUVSwapTimeSample = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationUVSwapTimeSample).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.animation.getRootAsanimation = function(bb, obj) {
+  return (obj || new CreatureFlatData.animation).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
  * @param {number} index
- * @param {CreatureFlatData.animationUVSwap=} obj
- * @returns {CreatureFlatData.animationUVSwap}
+ * @param {CreatureFlatData.animationClip=} obj
+ * @returns {CreatureFlatData.animationClip}
  */
-CreatureFlatData.animationUVSwapTimeSample.prototype.uvSwaps = function(index, obj) {
+CreatureFlatData.animation.prototype.clips = function(index, obj) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.animationUVSwap).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+  return offset ? (obj || new CreatureFlatData.animationClip).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.animationUVSwapTimeSample.prototype.uvSwapsLength = function() {
+CreatureFlatData.animation.prototype.clipsLength = function() {
   var offset = this.bb.__offset(this.bb_pos, 4);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
+ * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.animationUVSwapTimeSample.prototype.time = function() {
+CreatureFlatData.animation.prototype.clipsByName = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.animation.prototype.clipsByNameLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.animation.prototype.clipsByNameArray = function() {
   var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  */
-CreatureFlatData.animationUVSwapTimeSample.startanimationUVSwapTimeSample = function(builder) {
+CreatureFlatData.animation.startanimation = function(builder) {
   builder.startObject(2);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} uvSwapsOffset
+ * @param {flatbuffers.Offset} clipsOffset
  */
-CreatureFlatData.animationUVSwapTimeSample.addUvSwaps = function(builder, uvSwapsOffset) {
-  builder.addFieldOffset(0, uvSwapsOffset, 0);
+CreatureFlatData.animation.addClips = function(builder, clipsOffset) {
+  builder.addFieldOffset(0, clipsOffset, 0);
 };
 
 /**
@@ -2131,7 +3976,7 @@ CreatureFlatData.animationUVSwapTimeSample.addUvSwaps = function(builder, uvSwap
  * @param {Array.<flatbuffers.Offset>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationUVSwapTimeSample.createUvSwapsVector = function(builder, data) {
+CreatureFlatData.animation.createClipsVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addOffset(data[i]);
@@ -2143,23 +3988,44 @@ CreatureFlatData.animationUVSwapTimeSample.createUvSwapsVector = function(builde
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationUVSwapTimeSample.startUvSwapsVector = function(builder, numElems) {
+CreatureFlatData.animation.startClipsVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} time
+ * @param {flatbuffers.Offset} clipsByNameOffset
  */
-CreatureFlatData.animationUVSwapTimeSample.addTime = function(builder, time) {
-  builder.addFieldInt32(1, time, 0);
+CreatureFlatData.animation.addClipsByName = function(builder, clipsByNameOffset) {
+  builder.addFieldOffset(1, clipsByNameOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationUVSwapTimeSample.endanimationUVSwapTimeSample = function(builder) {
+CreatureFlatData.animation.createClipsByNameVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.animation.startClipsByNameVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.animation.endanimation = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -2167,7 +4033,7 @@ CreatureFlatData.animationUVSwapTimeSample.endanimationUVSwapTimeSample = functi
 /**
  * @constructor
  */
-CreatureFlatData.animationUVSwapList = function() {
+CreatureFlatData.uvSwapItemData = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -2182,9 +4048,9 @@ CreatureFlatData.animationUVSwapList = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationUVSwapList}
+ * @returns {CreatureFlatData.uvSwapItemData}
  */
-CreatureFlatData.animationUVSwapList.prototype.__init = function(i, bb) {
+CreatureFlatData.uvSwapItemData.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -2192,156 +4058,203 @@ CreatureFlatData.animationUVSwapList.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationUVSwapList=} obj
- * @returns {CreatureFlatData.animationUVSwapList}
+ * @param {CreatureFlatData.uvSwapItemData=} obj
+ * @returns {CreatureFlatData.uvSwapItemData}
  */
-CreatureFlatData.animationUVSwapList.getRootAsanimationUVSwapList = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationUVSwapList).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.uvSwapItemData.getRootAsuvSwapItemData = function(bb, obj) {
+  return (obj || new CreatureFlatData.uvSwapItemData).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
  * @param {number} index
- * @param {CreatureFlatData.animationUVSwapTimeSample=} obj
- * @returns {CreatureFlatData.animationUVSwapTimeSample}
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwapList.prototype.timeSamples = function(index, obj) {
+CreatureFlatData.uvSwapItemData.prototype.localOffset = function(index) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.animationUVSwapTimeSample).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.animationUVSwapList.prototype.timeSamplesLength = function() {
+CreatureFlatData.uvSwapItemData.prototype.localOffsetLength = function() {
   var offset = this.bb.__offset(this.bb_pos, 4);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
+ * @returns {Float32Array}
  */
-CreatureFlatData.animationUVSwapList.startanimationUVSwapList = function(builder) {
-  builder.startObject(1);
+CreatureFlatData.uvSwapItemData.prototype.localOffsetArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} timeSamplesOffset
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationUVSwapList.addTimeSamples = function(builder, timeSamplesOffset) {
-  builder.addFieldOffset(0, timeSamplesOffset, 0);
+CreatureFlatData.uvSwapItemData.prototype.globalOffset = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.uvSwapItemData.prototype.globalOffsetLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.uvSwapItemData.prototype.globalOffsetArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.uvSwapItemData.prototype.scale = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.uvSwapItemData.prototype.scaleLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Float32Array}
+ */
+CreatureFlatData.uvSwapItemData.prototype.scaleArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.uvSwapItemData.prototype.tag = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {Array.<flatbuffers.Offset>} data
- * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationUVSwapList.createTimeSamplesVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
-  for (var i = data.length - 1; i >= 0; i--) {
-    builder.addOffset(data[i]);
-  }
-  return builder.endVector();
+CreatureFlatData.uvSwapItemData.startuvSwapItemData = function(builder) {
+  builder.startObject(4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} numElems
+ * @param {flatbuffers.Offset} localOffsetOffset
  */
-CreatureFlatData.animationUVSwapList.startTimeSamplesVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.uvSwapItemData.addLocalOffset = function(builder, localOffsetOffset) {
+  builder.addFieldOffset(0, localOffsetOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationUVSwapList.endanimationUVSwapList = function(builder) {
-  var offset = builder.endObject();
-  return offset;
+CreatureFlatData.uvSwapItemData.createLocalOffsetVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
 };
 
 /**
- * @constructor
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
  */
-CreatureFlatData.animationMeshOpacity = function() {
-  /**
-   * @type {flatbuffers.ByteBuffer}
-   */
-  this.bb = null;
-
-  /**
-   * @type {number}
-   */
-  this.bb_pos = 0;
+CreatureFlatData.uvSwapItemData.startLocalOffsetVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
 };
 
 /**
- * @param {number} i
- * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationMeshOpacity}
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} globalOffsetOffset
  */
-CreatureFlatData.animationMeshOpacity.prototype.__init = function(i, bb) {
-  this.bb_pos = i;
-  this.bb = bb;
-  return this;
+CreatureFlatData.uvSwapItemData.addGlobalOffset = function(builder, globalOffsetOffset) {
+  builder.addFieldOffset(1, globalOffsetOffset, 0);
 };
 
 /**
- * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationMeshOpacity=} obj
- * @returns {CreatureFlatData.animationMeshOpacity}
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshOpacity.getRootAsanimationMeshOpacity = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationMeshOpacity).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.uvSwapItemData.createGlobalOffsetVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
 };
 
 /**
- * @param {flatbuffers.Encoding=} optionalEncoding
- * @returns {string|Uint8Array}
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
  */
-CreatureFlatData.animationMeshOpacity.prototype.name = function(optionalEncoding) {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
+CreatureFlatData.uvSwapItemData.startGlobalOffsetVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
 };
 
 /**
- * @returns {number}
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} scaleOffset
  */
-CreatureFlatData.animationMeshOpacity.prototype.opacity = function() {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.readFloat32(this.bb_pos + offset) : 0;
+CreatureFlatData.uvSwapItemData.addScale = function(builder, scaleOffset) {
+  builder.addFieldOffset(2, scaleOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshOpacity.startanimationMeshOpacity = function(builder) {
-  builder.startObject(2);
+CreatureFlatData.uvSwapItemData.createScaleVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} nameOffset
+ * @param {number} numElems
  */
-CreatureFlatData.animationMeshOpacity.addName = function(builder, nameOffset) {
-  builder.addFieldOffset(0, nameOffset, 0);
+CreatureFlatData.uvSwapItemData.startScaleVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} opacity
+ * @param {number} tag
  */
-CreatureFlatData.animationMeshOpacity.addOpacity = function(builder, opacity) {
-  builder.addFieldFloat32(1, opacity, 0);
+CreatureFlatData.uvSwapItemData.addTag = function(builder, tag) {
+  builder.addFieldInt32(3, tag, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshOpacity.endanimationMeshOpacity = function(builder) {
+CreatureFlatData.uvSwapItemData.enduvSwapItemData = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -2349,7 +4262,7 @@ CreatureFlatData.animationMeshOpacity.endanimationMeshOpacity = function(builder
 /**
  * @constructor
  */
-CreatureFlatData.animationMeshOpacityTimeSample = function() {
+CreatureFlatData.uvSwapItemMesh = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -2364,9 +4277,9 @@ CreatureFlatData.animationMeshOpacityTimeSample = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationMeshOpacityTimeSample}
+ * @returns {CreatureFlatData.uvSwapItemMesh}
  */
-CreatureFlatData.animationMeshOpacityTimeSample.prototype.__init = function(i, bb) {
+CreatureFlatData.uvSwapItemMesh.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -2374,52 +4287,61 @@ CreatureFlatData.animationMeshOpacityTimeSample.prototype.__init = function(i, b
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationMeshOpacityTimeSample=} obj
- * @returns {CreatureFlatData.animationMeshOpacityTimeSample}
+ * @param {CreatureFlatData.uvSwapItemMesh=} obj
+ * @returns {CreatureFlatData.uvSwapItemMesh}
  */
-CreatureFlatData.animationMeshOpacityTimeSample.getRootAsanimationMeshOpacityTimeSample = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationMeshOpacityTimeSample).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.uvSwapItemMesh.getRootAsuvSwapItemMesh = function(bb, obj) {
+  return (obj || new CreatureFlatData.uvSwapItemMesh).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
- * @param {number} index
- * @param {CreatureFlatData.animationMeshOpacity=} obj
- * @returns {CreatureFlatData.animationMeshOpacity}
+ * @param {flatbuffers.Encoding=} optionalEncoding
+ * @returns {string|Uint8Array}
  */
-CreatureFlatData.animationMeshOpacityTimeSample.prototype.meshOpacities = function(index, obj) {
+CreatureFlatData.uvSwapItemMesh.prototype.name = function(optionalEncoding) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.animationMeshOpacity).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
 };
 
 /**
- * @returns {number}
+ * @param {number} index
+ * @param {CreatureFlatData.uvSwapItemData=} obj
+ * @returns {CreatureFlatData.uvSwapItemData}
  */
-CreatureFlatData.animationMeshOpacityTimeSample.prototype.meshOpacitiesLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+CreatureFlatData.uvSwapItemMesh.prototype.items = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? (obj || new CreatureFlatData.uvSwapItemData).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.animationMeshOpacityTimeSample.prototype.time = function() {
+CreatureFlatData.uvSwapItemMesh.prototype.itemsLength = function() {
   var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  */
-CreatureFlatData.animationMeshOpacityTimeSample.startanimationMeshOpacityTimeSample = function(builder) {
+CreatureFlatData.uvSwapItemMesh.startuvSwapItemMesh = function(builder) {
   builder.startObject(2);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} meshOpacitiesOffset
+ * @param {flatbuffers.Offset} nameOffset
  */
-CreatureFlatData.animationMeshOpacityTimeSample.addMeshOpacities = function(builder, meshOpacitiesOffset) {
-  builder.addFieldOffset(0, meshOpacitiesOffset, 0);
+CreatureFlatData.uvSwapItemMesh.addName = function(builder, nameOffset) {
+  builder.addFieldOffset(0, nameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} itemsOffset
+ */
+CreatureFlatData.uvSwapItemMesh.addItems = function(builder, itemsOffset) {
+  builder.addFieldOffset(1, itemsOffset, 0);
 };
 
 /**
@@ -2427,7 +4349,7 @@ CreatureFlatData.animationMeshOpacityTimeSample.addMeshOpacities = function(buil
  * @param {Array.<flatbuffers.Offset>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshOpacityTimeSample.createMeshOpacitiesVector = function(builder, data) {
+CreatureFlatData.uvSwapItemMesh.createItemsVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addOffset(data[i]);
@@ -2439,23 +4361,15 @@ CreatureFlatData.animationMeshOpacityTimeSample.createMeshOpacitiesVector = func
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationMeshOpacityTimeSample.startMeshOpacitiesVector = function(builder, numElems) {
+CreatureFlatData.uvSwapItemMesh.startItemsVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
-/**
- * @param {flatbuffers.Builder} builder
- * @param {number} time
- */
-CreatureFlatData.animationMeshOpacityTimeSample.addTime = function(builder, time) {
-  builder.addFieldInt32(1, time, 0);
-};
-
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshOpacityTimeSample.endanimationMeshOpacityTimeSample = function(builder) {
+CreatureFlatData.uvSwapItemMesh.enduvSwapItemMesh = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -2463,7 +4377,7 @@ CreatureFlatData.animationMeshOpacityTimeSample.endanimationMeshOpacityTimeSampl
 /**
  * @constructor
  */
-CreatureFlatData.animationMeshOpacityList = function() {
+CreatureFlatData.uvSwapItemHolder = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -2478,9 +4392,9 @@ CreatureFlatData.animationMeshOpacityList = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationMeshOpacityList}
+ * @returns {CreatureFlatData.uvSwapItemHolder}
  */
-CreatureFlatData.animationMeshOpacityList.prototype.__init = function(i, bb) {
+CreatureFlatData.uvSwapItemHolder.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -2488,44 +4402,69 @@ CreatureFlatData.animationMeshOpacityList.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationMeshOpacityList=} obj
- * @returns {CreatureFlatData.animationMeshOpacityList}
+ * @param {CreatureFlatData.uvSwapItemHolder=} obj
+ * @returns {CreatureFlatData.uvSwapItemHolder}
  */
-CreatureFlatData.animationMeshOpacityList.getRootAsanimationMeshOpacityList = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationMeshOpacityList).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.uvSwapItemHolder.getRootAsuvSwapItemHolder = function(bb, obj) {
+  return (obj || new CreatureFlatData.uvSwapItemHolder).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
  * @param {number} index
- * @param {CreatureFlatData.animationMeshOpacityTimeSample=} obj
- * @returns {CreatureFlatData.animationMeshOpacityTimeSample}
+ * @param {CreatureFlatData.uvSwapItemMesh=} obj
+ * @returns {CreatureFlatData.uvSwapItemMesh}
  */
-CreatureFlatData.animationMeshOpacityList.prototype.timeSamples = function(index, obj) {
+CreatureFlatData.uvSwapItemHolder.prototype.meshes = function(index, obj) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.animationMeshOpacityTimeSample).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+  return offset ? (obj || new CreatureFlatData.uvSwapItemMesh).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.animationMeshOpacityList.prototype.timeSamplesLength = function() {
+CreatureFlatData.uvSwapItemHolder.prototype.meshesLength = function() {
   var offset = this.bb.__offset(this.bb_pos, 4);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.uvSwapItemHolder.prototype.meshesByName = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.uvSwapItemHolder.prototype.meshesByNameLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.uvSwapItemHolder.prototype.meshesByNameArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
-CreatureFlatData.animationMeshOpacityList.startanimationMeshOpacityList = function(builder) {
-  builder.startObject(1);
+CreatureFlatData.uvSwapItemHolder.startuvSwapItemHolder = function(builder) {
+  builder.startObject(2);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} timeSamplesOffset
+ * @param {flatbuffers.Offset} meshesOffset
  */
-CreatureFlatData.animationMeshOpacityList.addTimeSamples = function(builder, timeSamplesOffset) {
-  builder.addFieldOffset(0, timeSamplesOffset, 0);
+CreatureFlatData.uvSwapItemHolder.addMeshes = function(builder, meshesOffset) {
+  builder.addFieldOffset(0, meshesOffset, 0);
 };
 
 /**
@@ -2533,7 +4472,7 @@ CreatureFlatData.animationMeshOpacityList.addTimeSamples = function(builder, tim
  * @param {Array.<flatbuffers.Offset>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshOpacityList.createTimeSamplesVector = function(builder, data) {
+CreatureFlatData.uvSwapItemHolder.createMeshesVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addOffset(data[i]);
@@ -2545,15 +4484,44 @@ CreatureFlatData.animationMeshOpacityList.createTimeSamplesVector = function(bui
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animationMeshOpacityList.startTimeSamplesVector = function(builder, numElems) {
+CreatureFlatData.uvSwapItemHolder.startMeshesVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} meshesByNameOffset
+ */
+CreatureFlatData.uvSwapItemHolder.addMeshesByName = function(builder, meshesByNameOffset) {
+  builder.addFieldOffset(1, meshesByNameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationMeshOpacityList.endanimationMeshOpacityList = function(builder) {
+CreatureFlatData.uvSwapItemHolder.createMeshesByNameVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.uvSwapItemHolder.startMeshesByNameVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.uvSwapItemHolder.enduvSwapItemHolder = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -2561,7 +4529,7 @@ CreatureFlatData.animationMeshOpacityList.endanimationMeshOpacityList = function
 /**
  * @constructor
  */
-CreatureFlatData.animationClip = function() {
+CreatureFlatData.anchorPointData = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -2576,9 +4544,9 @@ CreatureFlatData.animationClip = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animationClip}
+ * @returns {CreatureFlatData.anchorPointData}
  */
-CreatureFlatData.animationClip.prototype.__init = function(i, bb) {
+CreatureFlatData.anchorPointData.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -2586,110 +4554,96 @@ CreatureFlatData.animationClip.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animationClip=} obj
- * @returns {CreatureFlatData.animationClip}
+ * @param {CreatureFlatData.anchorPointData=} obj
+ * @returns {CreatureFlatData.anchorPointData}
  */
-CreatureFlatData.animationClip.getRootAsanimationClip = function(bb, obj) {
-  return (obj || new CreatureFlatData.animationClip).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.anchorPointData.getRootAsanchorPointData = function(bb, obj) {
+  return (obj || new CreatureFlatData.anchorPointData).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
- * @param {flatbuffers.Encoding=} optionalEncoding
- * @returns {string|Uint8Array}
+ * @param {number} index
+ * @returns {number}
  */
-CreatureFlatData.animationClip.prototype.name = function(optionalEncoding) {
+CreatureFlatData.anchorPointData.prototype.point = function(index) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
-};
-
-/**
- * @param {CreatureFlatData.animationBonesList=} obj
- * @returns {CreatureFlatData.animationBonesList}
- */
-CreatureFlatData.animationClip.prototype.bones = function(obj) {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? (obj || new CreatureFlatData.animationBonesList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
-};
-
-/**
- * @param {CreatureFlatData.animationMeshList=} obj
- * @returns {CreatureFlatData.animationMeshList}
- */
-CreatureFlatData.animationClip.prototype.meshes = function(obj) {
-  var offset = this.bb.__offset(this.bb_pos, 8);
-  return offset ? (obj || new CreatureFlatData.animationMeshList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
- * @param {CreatureFlatData.animationUVSwapList=} obj
- * @returns {CreatureFlatData.animationUVSwapList}
+ * @returns {number}
  */
-CreatureFlatData.animationClip.prototype.uvSwaps = function(obj) {
-  var offset = this.bb.__offset(this.bb_pos, 10);
-  return offset ? (obj || new CreatureFlatData.animationUVSwapList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+CreatureFlatData.anchorPointData.prototype.pointLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {CreatureFlatData.animationMeshOpacityList=} obj
- * @returns {CreatureFlatData.animationMeshOpacityList}
+ * @returns {Float32Array}
  */
-CreatureFlatData.animationClip.prototype.meshOpacities = function(obj) {
-  var offset = this.bb.__offset(this.bb_pos, 12);
-  return offset ? (obj || new CreatureFlatData.animationMeshOpacityList).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+CreatureFlatData.anchorPointData.prototype.pointArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Encoding=} optionalEncoding
+ * @returns {string|Uint8Array}
  */
-CreatureFlatData.animationClip.startanimationClip = function(builder) {
-  builder.startObject(5);
+CreatureFlatData.anchorPointData.prototype.animClipName = function(optionalEncoding) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} nameOffset
  */
-CreatureFlatData.animationClip.addName = function(builder, nameOffset) {
-  builder.addFieldOffset(0, nameOffset, 0);
+CreatureFlatData.anchorPointData.startanchorPointData = function(builder) {
+  builder.startObject(2);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} bonesOffset
+ * @param {flatbuffers.Offset} pointOffset
  */
-CreatureFlatData.animationClip.addBones = function(builder, bonesOffset) {
-  builder.addFieldOffset(1, bonesOffset, 0);
+CreatureFlatData.anchorPointData.addPoint = function(builder, pointOffset) {
+  builder.addFieldOffset(0, pointOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} meshesOffset
+ * @param {Array.<number>} data
+ * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationClip.addMeshes = function(builder, meshesOffset) {
-  builder.addFieldOffset(2, meshesOffset, 0);
+CreatureFlatData.anchorPointData.createPointVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} uvSwapsOffset
+ * @param {number} numElems
  */
-CreatureFlatData.animationClip.addUvSwaps = function(builder, uvSwapsOffset) {
-  builder.addFieldOffset(3, uvSwapsOffset, 0);
+CreatureFlatData.anchorPointData.startPointVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} meshOpacitiesOffset
+ * @param {flatbuffers.Offset} animClipNameOffset
  */
-CreatureFlatData.animationClip.addMeshOpacities = function(builder, meshOpacitiesOffset) {
-  builder.addFieldOffset(4, meshOpacitiesOffset, 0);
+CreatureFlatData.anchorPointData.addAnimClipName = function(builder, animClipNameOffset) {
+  builder.addFieldOffset(1, animClipNameOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animationClip.endanimationClip = function(builder) {
+CreatureFlatData.anchorPointData.endanchorPointData = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -2697,7 +4651,7 @@ CreatureFlatData.animationClip.endanimationClip = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.animation = function() {
+CreatureFlatData.anchorPointsHolder = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -2712,54 +4666,79 @@ CreatureFlatData.animation = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.animation}
+ * @returns {CreatureFlatData.anchorPointsHolder}
  */
-CreatureFlatData.animation.prototype.__init = function(i, bb) {
+CreatureFlatData.anchorPointsHolder.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
 };
 
 /**
- * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.animation=} obj
- * @returns {CreatureFlatData.animation}
+ * @param {flatbuffers.ByteBuffer} bb
+ * @param {CreatureFlatData.anchorPointsHolder=} obj
+ * @returns {CreatureFlatData.anchorPointsHolder}
+ */
+CreatureFlatData.anchorPointsHolder.getRootAsanchorPointsHolder = function(bb, obj) {
+  return (obj || new CreatureFlatData.anchorPointsHolder).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.anchorPointData=} obj
+ * @returns {CreatureFlatData.anchorPointData}
+ */
+CreatureFlatData.anchorPointsHolder.prototype.anchorPoints = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? (obj || new CreatureFlatData.anchorPointData).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+};
+
+/**
+ * @returns {number}
  */
-CreatureFlatData.animation.getRootAsanimation = function(bb, obj) {
-  return (obj || new CreatureFlatData.animation).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.anchorPointsHolder.prototype.anchorPointsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 4);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
  * @param {number} index
- * @param {CreatureFlatData.animationClip=} obj
- * @returns {CreatureFlatData.animationClip}
+ * @returns {number}
  */
-CreatureFlatData.animation.prototype.clips = function(index, obj) {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.animationClip).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+CreatureFlatData.anchorPointsHolder.prototype.anchorPointsByClipName = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.animation.prototype.clipsLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
+CreatureFlatData.anchorPointsHolder.prototype.anchorPointsByClipNameLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.anchorPointsHolder.prototype.anchorPointsByClipNameArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
-CreatureFlatData.animation.startanimation = function(builder) {
-  builder.startObject(1);
+CreatureFlatData.anchorPointsHolder.startanchorPointsHolder = function(builder) {
+  builder.startObject(2);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} clipsOffset
+ * @param {flatbuffers.Offset} anchorPointsOffset
  */
-CreatureFlatData.animation.addClips = function(builder, clipsOffset) {
-  builder.addFieldOffset(0, clipsOffset, 0);
+CreatureFlatData.anchorPointsHolder.addAnchorPoints = function(builder, anchorPointsOffset) {
+  builder.addFieldOffset(0, anchorPointsOffset, 0);
 };
 
 /**
@@ -2767,7 +4746,7 @@ CreatureFlatData.animation.addClips = function(builder, clipsOffset) {
  * @param {Array.<flatbuffers.Offset>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animation.createClipsVector = function(builder, data) {
+CreatureFlatData.anchorPointsHolder.createAnchorPointsVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addOffset(data[i]);
@@ -2779,15 +4758,44 @@ CreatureFlatData.animation.createClipsVector = function(builder, data) {
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.animation.startClipsVector = function(builder, numElems) {
+CreatureFlatData.anchorPointsHolder.startAnchorPointsVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} anchorPointsByClipNameOffset
+ */
+CreatureFlatData.anchorPointsHolder.addAnchorPointsByClipName = function(builder, anchorPointsByClipNameOffset) {
+  builder.addFieldOffset(1, anchorPointsByClipNameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.animation.endanimation = function(builder) {
+CreatureFlatData.anchorPointsHolder.createAnchorPointsByClipNameVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.anchorPointsHolder.startAnchorPointsByClipNameVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.anchorPointsHolder.endanchorPointsHolder = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -2795,7 +4803,7 @@ CreatureFlatData.animation.endanimation = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.uvSwapItemData = function() {
+CreatureFlatData.bakedClip = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -2810,9 +4818,9 @@ CreatureFlatData.uvSwapItemData = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.uvSwapItemData}
+ * @returns {CreatureFlatData.bakedClip}
  */
-CreatureFlatData.uvSwapItemData.prototype.__init = function(i, bb) {
+CreatureFlatData.bakedClip.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -2820,60 +4828,60 @@ CreatureFlatData.uvSwapItemData.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.uvSwapItemData=} obj
- * @returns {CreatureFlatData.uvSwapItemData}
+ * @param {CreatureFlatData.bakedClip=} obj
+ * @returns {CreatureFlatData.bakedClip}
  */
-CreatureFlatData.uvSwapItemData.getRootAsuvSwapItemData = function(bb, obj) {
-  return (obj || new CreatureFlatData.uvSwapItemData).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.bakedClip.getRootAsbakedClip = function(bb, obj) {
+  return (obj || new CreatureFlatData.bakedClip).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
- * @param {number} index
- * @returns {number}
+ * @param {flatbuffers.Encoding=} optionalEncoding
+ * @returns {string|Uint8Array}
  */
-CreatureFlatData.uvSwapItemData.prototype.localOffset = function(index) {
+CreatureFlatData.bakedClip.prototype.name = function(optionalEncoding) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.prototype.localOffsetLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+CreatureFlatData.bakedClip.prototype.startTime = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
 };
 
 /**
- * @returns {Float32Array}
+ * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.prototype.localOffsetArray = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+CreatureFlatData.bakedClip.prototype.endTime = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
 };
 
 /**
  * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.prototype.globalOffset = function(index) {
-  var offset = this.bb.__offset(this.bb_pos, 6);
+CreatureFlatData.bakedClip.prototype.boundsMin = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 10);
   return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.prototype.globalOffsetLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 6);
+CreatureFlatData.bakedClip.prototype.boundsMinLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
  * @returns {Float32Array}
  */
-CreatureFlatData.uvSwapItemData.prototype.globalOffsetArray = function() {
-  var offset = this.bb.__offset(this.bb_pos, 6);
+CreatureFlatData.bakedClip.prototype.boundsMinArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
   return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
@@ -2881,106 +4889,89 @@ CreatureFlatData.uvSwapItemData.prototype.globalOffsetArray = function() {
  * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.prototype.scale = function(index) {
-  var offset = this.bb.__offset(this.bb_pos, 8);
+CreatureFlatData.bakedClip.prototype.boundsExtent = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.prototype.scaleLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 8);
+CreatureFlatData.bakedClip.prototype.boundsExtentLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
  * @returns {Float32Array}
  */
-CreatureFlatData.uvSwapItemData.prototype.scaleArray = function() {
-  var offset = this.bb.__offset(this.bb_pos, 8);
+CreatureFlatData.bakedClip.prototype.boundsExtentArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 12);
   return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
+ * @param {number} index
  * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.prototype.tag = function() {
-  var offset = this.bb.__offset(this.bb_pos, 10);
-  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
-};
-
-/**
- * @param {flatbuffers.Builder} builder
- */
-CreatureFlatData.uvSwapItemData.startuvSwapItemData = function(builder) {
-  builder.startObject(4);
+CreatureFlatData.bakedClip.prototype.pointsQ = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 14);
+  return offset ? this.bb.readUint16(this.bb.__vector(this.bb_pos + offset) + index * 2) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} localOffsetOffset
+ * @returns {number}
  */
-CreatureFlatData.uvSwapItemData.addLocalOffset = function(builder, localOffsetOffset) {
-  builder.addFieldOffset(0, localOffsetOffset, 0);
+CreatureFlatData.bakedClip.prototype.pointsQLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 14);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Builder} builder
- * @param {Array.<number>} data
- * @returns {flatbuffers.Offset}
+ * @returns {Uint16Array}
  */
-CreatureFlatData.uvSwapItemData.createLocalOffsetVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
-  for (var i = data.length - 1; i >= 0; i--) {
-    builder.addFloat32(data[i]);
-  }
-  return builder.endVector();
+CreatureFlatData.bakedClip.prototype.pointsQArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 14);
+  return offset ? new Uint16Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} numElems
  */
-CreatureFlatData.uvSwapItemData.startLocalOffsetVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.bakedClip.startbakedClip = function(builder) {
+  builder.startObject(6);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} globalOffsetOffset
+ * @param {flatbuffers.Offset} nameOffset
  */
-CreatureFlatData.uvSwapItemData.addGlobalOffset = function(builder, globalOffsetOffset) {
-  builder.addFieldOffset(1, globalOffsetOffset, 0);
+CreatureFlatData.bakedClip.addName = function(builder, nameOffset) {
+  builder.addFieldOffset(0, nameOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {Array.<number>} data
- * @returns {flatbuffers.Offset}
+ * @param {number} startTime
  */
-CreatureFlatData.uvSwapItemData.createGlobalOffsetVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
-  for (var i = data.length - 1; i >= 0; i--) {
-    builder.addFloat32(data[i]);
-  }
-  return builder.endVector();
+CreatureFlatData.bakedClip.addStartTime = function(builder, startTime) {
+  builder.addFieldInt32(1, startTime, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} numElems
+ * @param {number} endTime
  */
-CreatureFlatData.uvSwapItemData.startGlobalOffsetVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.bakedClip.addEndTime = function(builder, endTime) {
+  builder.addFieldInt32(2, endTime, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} scaleOffset
+ * @param {flatbuffers.Offset} boundsMinOffset
  */
-CreatureFlatData.uvSwapItemData.addScale = function(builder, scaleOffset) {
-  builder.addFieldOffset(2, scaleOffset, 0);
+CreatureFlatData.bakedClip.addBoundsMin = function(builder, boundsMinOffset) {
+  builder.addFieldOffset(3, boundsMinOffset, 0);
 };
 
 /**
@@ -2988,7 +4979,7 @@ CreatureFlatData.uvSwapItemData.addScale = function(builder, scaleOffset) {
  * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.uvSwapItemData.createScaleVector = function(builder, data) {
+CreatureFlatData.bakedClip.createBoundsMinVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addFloat32(data[i]);
@@ -3000,121 +4991,56 @@ CreatureFlatData.uvSwapItemData.createScaleVector = function(builder, data) {
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.uvSwapItemData.startScaleVector = function(builder, numElems) {
+CreatureFlatData.bakedClip.startBoundsMinVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} tag
+ * @param {flatbuffers.Offset} boundsExtentOffset
  */
-CreatureFlatData.uvSwapItemData.addTag = function(builder, tag) {
-  builder.addFieldInt32(3, tag, 0);
+CreatureFlatData.bakedClip.addBoundsExtent = function(builder, boundsExtentOffset) {
+  builder.addFieldOffset(4, boundsExtentOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.uvSwapItemData.enduvSwapItemData = function(builder) {
-  var offset = builder.endObject();
-  return offset;
-};
-
-/**
- * @constructor
- */
-CreatureFlatData.uvSwapItemMesh = function() {
-  /**
-   * @type {flatbuffers.ByteBuffer}
-   */
-  this.bb = null;
-
-  /**
-   * @type {number}
-   */
-  this.bb_pos = 0;
-};
-
-/**
- * @param {number} i
- * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.uvSwapItemMesh}
- */
-CreatureFlatData.uvSwapItemMesh.prototype.__init = function(i, bb) {
-  this.bb_pos = i;
-  this.bb = bb;
-  return this;
-};
-
-/**
- * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.uvSwapItemMesh=} obj
- * @returns {CreatureFlatData.uvSwapItemMesh}
- */
-CreatureFlatData.uvSwapItemMesh.getRootAsuvSwapItemMesh = function(bb, obj) {
-  return (obj || new CreatureFlatData.uvSwapItemMesh).__init(bb.readInt32(bb.position()) + bb.position(), bb);
-};
-
-/**
- * @param {flatbuffers.Encoding=} optionalEncoding
- * @returns {string|Uint8Array}
- */
-CreatureFlatData.uvSwapItemMesh.prototype.name = function(optionalEncoding) {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
-};
-
-/**
- * @param {number} index
- * @param {CreatureFlatData.uvSwapItemData=} obj
- * @returns {CreatureFlatData.uvSwapItemData}
- */
-CreatureFlatData.uvSwapItemMesh.prototype.items = function(index, obj) {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? (obj || new CreatureFlatData.uvSwapItemData).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
-};
-
-/**
- * @returns {number}
- */
-CreatureFlatData.uvSwapItemMesh.prototype.itemsLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
-};
-
-/**
- * @param {flatbuffers.Builder} builder
- */
-CreatureFlatData.uvSwapItemMesh.startuvSwapItemMesh = function(builder) {
-  builder.startObject(2);
+CreatureFlatData.bakedClip.createBoundsExtentVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addFloat32(data[i]);
+  }
+  return builder.endVector();
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} nameOffset
+ * @param {number} numElems
  */
-CreatureFlatData.uvSwapItemMesh.addName = function(builder, nameOffset) {
-  builder.addFieldOffset(0, nameOffset, 0);
+CreatureFlatData.bakedClip.startBoundsExtentVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} itemsOffset
+ * @param {flatbuffers.Offset} pointsQOffset
  */
-CreatureFlatData.uvSwapItemMesh.addItems = function(builder, itemsOffset) {
-  builder.addFieldOffset(1, itemsOffset, 0);
+CreatureFlatData.bakedClip.addPointsQ = function(builder, pointsQOffset) {
+  builder.addFieldOffset(5, pointsQOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {Array.<flatbuffers.Offset>} data
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.uvSwapItemMesh.createItemsVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
+CreatureFlatData.bakedClip.createPointsQVector = function(builder, data) {
+  builder.startVector(2, data.length, 2);
   for (var i = data.length - 1; i >= 0; i--) {
-    builder.addOffset(data[i]);
+    builder.addInt16(data[i]);
   }
   return builder.endVector();
 };
@@ -3123,15 +5049,15 @@ CreatureFlatData.uvSwapItemMesh.createItemsVector = function(builder, data) {
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.uvSwapItemMesh.startItemsVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.bakedClip.startPointsQVector = function(builder, numElems) {
+  builder.startVector(2, numElems, 2);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.uvSwapItemMesh.enduvSwapItemMesh = function(builder) {
+CreatureFlatData.bakedClip.endbakedClip = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -3139,7 +5065,7 @@ CreatureFlatData.uvSwapItemMesh.enduvSwapItemMesh = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.uvSwapItemHolder = function() {
+CreatureFlatData.bakedAnimation = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -3154,9 +5080,9 @@ CreatureFlatData.uvSwapItemHolder = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.uvSwapItemHolder}
+ * @returns {CreatureFlatData.bakedAnimation}
  */
-CreatureFlatData.uvSwapItemHolder.prototype.__init = function(i, bb) {
+CreatureFlatData.bakedAnimation.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -3164,44 +5090,85 @@ CreatureFlatData.uvSwapItemHolder.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.uvSwapItemHolder=} obj
- * @returns {CreatureFlatData.uvSwapItemHolder}
+ * @param {CreatureFlatData.bakedAnimation=} obj
+ * @returns {CreatureFlatData.bakedAnimation}
  */
-CreatureFlatData.uvSwapItemHolder.getRootAsuvSwapItemHolder = function(bb, obj) {
-  return (obj || new CreatureFlatData.uvSwapItemHolder).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.bakedAnimation.getRootAsbakedAnimation = function(bb, obj) {
+  return (obj || new CreatureFlatData.bakedAnimation).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
- * @param {number} index
- * @param {CreatureFlatData.uvSwapItemMesh=} obj
- * @returns {CreatureFlatData.uvSwapItemMesh}
+ * @returns {number}
  */
-CreatureFlatData.uvSwapItemHolder.prototype.meshes = function(index, obj) {
+CreatureFlatData.bakedAnimation.prototype.pointCount = function() {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.uvSwapItemMesh).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.bakedClip=} obj
+ * @returns {CreatureFlatData.bakedClip}
+ */
+CreatureFlatData.bakedAnimation.prototype.clips = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? (obj || new CreatureFlatData.bakedClip).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.uvSwapItemHolder.prototype.meshesLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
+CreatureFlatData.bakedAnimation.prototype.clipsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.bakedAnimation.prototype.clipsByName = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.bakedAnimation.prototype.clipsByNameLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.bakedAnimation.prototype.clipsByNameArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
-CreatureFlatData.uvSwapItemHolder.startuvSwapItemHolder = function(builder) {
-  builder.startObject(1);
+CreatureFlatData.bakedAnimation.startbakedAnimation = function(builder) {
+  builder.startObject(3);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} meshesOffset
+ * @param {number} pointCount
  */
-CreatureFlatData.uvSwapItemHolder.addMeshes = function(builder, meshesOffset) {
-  builder.addFieldOffset(0, meshesOffset, 0);
+CreatureFlatData.bakedAnimation.addPointCount = function(builder, pointCount) {
+  builder.addFieldInt32(0, pointCount, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} clipsOffset
+ */
+CreatureFlatData.bakedAnimation.addClips = function(builder, clipsOffset) {
+  builder.addFieldOffset(1, clipsOffset, 0);
 };
 
 /**
@@ -3209,7 +5176,7 @@ CreatureFlatData.uvSwapItemHolder.addMeshes = function(builder, meshesOffset) {
  * @param {Array.<flatbuffers.Offset>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.uvSwapItemHolder.createMeshesVector = function(builder, data) {
+CreatureFlatData.bakedAnimation.createClipsVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addOffset(data[i]);
@@ -3221,15 +5188,44 @@ CreatureFlatData.uvSwapItemHolder.createMeshesVector = function(builder, data) {
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.uvSwapItemHolder.startMeshesVector = function(builder, numElems) {
+CreatureFlatData.bakedAnimation.startClipsVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} clipsByNameOffset
+ */
+CreatureFlatData.bakedAnimation.addClipsByName = function(builder, clipsByNameOffset) {
+  builder.addFieldOffset(2, clipsByNameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.uvSwapItemHolder.enduvSwapItemHolder = function(builder) {
+CreatureFlatData.bakedAnimation.createClipsByNameVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.bakedAnimation.startClipsByNameVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.bakedAnimation.endbakedAnimation = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -3237,7 +5233,7 @@ CreatureFlatData.uvSwapItemHolder.enduvSwapItemHolder = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.anchorPointData = function() {
+CreatureFlatData.clipChunk = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -3252,9 +5248,9 @@ CreatureFlatData.anchorPointData = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.anchorPointData}
+ * @returns {CreatureFlatData.clipChunk}
  */
-CreatureFlatData.anchorPointData.prototype.__init = function(i, bb) {
+CreatureFlatData.clipChunk.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -3262,96 +5258,90 @@ CreatureFlatData.anchorPointData.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.anchorPointData=} obj
- * @returns {CreatureFlatData.anchorPointData}
+ * @param {CreatureFlatData.clipChunk=} obj
+ * @returns {CreatureFlatData.clipChunk}
  */
-CreatureFlatData.anchorPointData.getRootAsanchorPointData = function(bb, obj) {
-  return (obj || new CreatureFlatData.anchorPointData).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.clipChunk.getRootAsclipChunk = function(bb, obj) {
+  return (obj || new CreatureFlatData.clipChunk).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
- * @param {number} index
- * @returns {number}
+ * @param {flatbuffers.Encoding=} optionalEncoding
+ * @returns {string|Uint8Array}
  */
-CreatureFlatData.anchorPointData.prototype.point = function(index) {
+CreatureFlatData.clipChunk.prototype.name = function(optionalEncoding) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.readFloat32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.anchorPointData.prototype.pointLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+CreatureFlatData.clipChunk.prototype.offset = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.readUint32(this.bb_pos + offset) : 0;
 };
 
 /**
- * @returns {Float32Array}
+ * @returns {number}
  */
-CreatureFlatData.anchorPointData.prototype.pointArray = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? new Float32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+CreatureFlatData.clipChunk.prototype.size = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readUint32(this.bb_pos + offset) : 0;
 };
 
 /**
- * @param {flatbuffers.Encoding=} optionalEncoding
- * @returns {string|Uint8Array}
+ * @returns {number}
  */
-CreatureFlatData.anchorPointData.prototype.animClipName = function(optionalEncoding) {
-  var offset = this.bb.__offset(this.bb_pos, 6);
-  return offset ? this.bb.__string(this.bb_pos + offset, optionalEncoding) : null;
+CreatureFlatData.clipChunk.prototype.compressedSize = function() {
+  var offset = this.bb.__offset(this.bb_pos, 10);
+  return offset ? this.bb.readUint32(this.bb_pos + offset) : 0;
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  */
-CreatureFlatData.anchorPointData.startanchorPointData = function(builder) {
-  builder.startObject(2);
+CreatureFlatData.clipChunk.startclipChunk = function(builder) {
+  builder.startObject(4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} pointOffset
+ * @param {flatbuffers.Offset} nameOffset
  */
-CreatureFlatData.anchorPointData.addPoint = function(builder, pointOffset) {
-  builder.addFieldOffset(0, pointOffset, 0);
+CreatureFlatData.clipChunk.addName = function(builder, nameOffset) {
+  builder.addFieldOffset(0, nameOffset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {Array.<number>} data
- * @returns {flatbuffers.Offset}
+ * @param {number} offset
  */
-CreatureFlatData.anchorPointData.createPointVector = function(builder, data) {
-  builder.startVector(4, data.length, 4);
-  for (var i = data.length - 1; i >= 0; i--) {
-    builder.addFloat32(data[i]);
-  }
-  return builder.endVector();
+CreatureFlatData.clipChunk.addOffset = function(builder, offset) {
+  builder.addFieldInt32(1, offset, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {number} numElems
+ * @param {number} size
  */
-CreatureFlatData.anchorPointData.startPointVector = function(builder, numElems) {
-  builder.startVector(4, numElems, 4);
+CreatureFlatData.clipChunk.addSize = function(builder, size) {
+  builder.addFieldInt32(2, size, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} animClipNameOffset
+ * @param {number} compressedSize
  */
-CreatureFlatData.anchorPointData.addAnimClipName = function(builder, animClipNameOffset) {
-  builder.addFieldOffset(1, animClipNameOffset, 0);
+CreatureFlatData.clipChunk.addCompressedSize = function(builder, compressedSize) {
+  builder.addFieldInt32(3, compressedSize, 0);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.anchorPointData.endanchorPointData = function(builder) {
+CreatureFlatData.clipChunk.endclipChunk = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -3359,7 +5349,7 @@ CreatureFlatData.anchorPointData.endanchorPointData = function(builder) {
 /**
  * @constructor
  */
-CreatureFlatData.anchorPointsHolder = function() {
+CreatureFlatData.clipDirectory = function() {
   /**
    * @type {flatbuffers.ByteBuffer}
    */
@@ -3374,9 +5364,9 @@ CreatureFlatData.anchorPointsHolder = function() {
 /**
  * @param {number} i
  * @param {flatbuffers.ByteBuffer} bb
- * @returns {CreatureFlatData.anchorPointsHolder}
+ * @returns {CreatureFlatData.clipDirectory}
  */
-CreatureFlatData.anchorPointsHolder.prototype.__init = function(i, bb) {
+CreatureFlatData.clipDirectory.prototype.__init = function(i, bb) {
   this.bb_pos = i;
   this.bb = bb;
   return this;
@@ -3384,44 +5374,86 @@ CreatureFlatData.anchorPointsHolder.prototype.__init = function(i, bb) {
 
 /**
  * @param {flatbuffers.ByteBuffer} bb
- * @param {CreatureFlatData.anchorPointsHolder=} obj
- * @returns {CreatureFlatData.anchorPointsHolder}
+ * @param {CreatureFlatData.clipDirectory=} obj
+ * @returns {CreatureFlatData.clipDirectory}
  */
-CreatureFlatData.anchorPointsHolder.getRootAsanchorPointsHolder = function(bb, obj) {
-  return (obj || new CreatureFlatData.anchorPointsHolder).__init(bb.readInt32(bb.position()) + bb.position(), bb);
+CreatureFlatData.clipDirectory.getRootAsclipDirectory = function(bb, obj) {
+  return (obj || new CreatureFlatData.clipDirectory).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
 /**
- * @param {number} index
- * @param {CreatureFlatData.anchorPointData=} obj
- * @returns {CreatureFlatData.anchorPointData}
+ * @param {CreatureFlatData.clipChunk=} obj
+ * @returns {CreatureFlatData.clipChunk}
  */
-CreatureFlatData.anchorPointsHolder.prototype.anchorPoints = function(index, obj) {
+CreatureFlatData.clipDirectory.prototype.base = function(obj) {
   var offset = this.bb.__offset(this.bb_pos, 4);
-  return offset ? (obj || new CreatureFlatData.anchorPointData).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
+  return offset ? (obj || new CreatureFlatData.clipChunk).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+};
+
+/**
+ * @param {number} index
+ * @param {CreatureFlatData.clipChunk=} obj
+ * @returns {CreatureFlatData.clipChunk}
+ */
+CreatureFlatData.clipDirectory.prototype.clips = function(index, obj) {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? (obj || new CreatureFlatData.clipChunk).__init(this.bb.__indirect(this.bb.__vector(this.bb_pos + offset) + index * 4), this.bb) : null;
 };
 
 /**
  * @returns {number}
  */
-CreatureFlatData.anchorPointsHolder.prototype.anchorPointsLength = function() {
-  var offset = this.bb.__offset(this.bb_pos, 4);
+CreatureFlatData.clipDirectory.prototype.clipsLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 6);
+  return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
+};
+
+/**
+ * @param {number} index
+ * @returns {number}
+ */
+CreatureFlatData.clipDirectory.prototype.clipsByName = function(index) {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? this.bb.readInt32(this.bb.__vector(this.bb_pos + offset) + index * 4) : 0;
+};
+
+/**
+ * @returns {number}
+ */
+CreatureFlatData.clipDirectory.prototype.clipsByNameLength = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
   return offset ? this.bb.__vector_len(this.bb_pos + offset) : 0;
 };
 
+/**
+ * @returns {Int32Array}
+ */
+CreatureFlatData.clipDirectory.prototype.clipsByNameArray = function() {
+  var offset = this.bb.__offset(this.bb_pos, 8);
+  return offset ? new Int32Array(this.bb.bytes().buffer, this.bb.__vector(this.bb_pos + offset), this.bb.__vector_len(this.bb_pos + offset)) : null;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
-CreatureFlatData.anchorPointsHolder.startanchorPointsHolder = function(builder) {
-  builder.startObject(1);
+CreatureFlatData.clipDirectory.startclipDirectory = function(builder) {
+  builder.startObject(3);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
- * @param {flatbuffers.Offset} anchorPointsOffset
+ * @param {flatbuffers.Offset} baseOffset
  */
-CreatureFlatData.anchorPointsHolder.addAnchorPoints = function(builder, anchorPointsOffset) {
-  builder.addFieldOffset(0, anchorPointsOffset, 0);
+CreatureFlatData.clipDirectory.addBase = function(builder, baseOffset) {
+  builder.addFieldOffset(0, baseOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} clipsOffset
+ */
+CreatureFlatData.clipDirectory.addClips = function(builder, clipsOffset) {
+  builder.addFieldOffset(1, clipsOffset, 0);
 };
 
 /**
@@ -3429,7 +5461,7 @@ CreatureFlatData.anchorPointsHolder.addAnchorPoints = function(builder, anchorPo
  * @param {Array.<flatbuffers.Offset>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.anchorPointsHolder.createAnchorPointsVector = function(builder, data) {
+CreatureFlatData.clipDirectory.createClipsVector = function(builder, data) {
   builder.startVector(4, data.length, 4);
   for (var i = data.length - 1; i >= 0; i--) {
     builder.addOffset(data[i]);
@@ -3441,15 +5473,44 @@ CreatureFlatData.anchorPointsHolder.createAnchorPointsVector = function(builder,
  * @param {flatbuffers.Builder} builder
  * @param {number} numElems
  */
-CreatureFlatData.anchorPointsHolder.startAnchorPointsVector = function(builder, numElems) {
+CreatureFlatData.clipDirectory.startClipsVector = function(builder, numElems) {
   builder.startVector(4, numElems, 4);
 };
 
 /**
  * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} clipsByNameOffset
+ */
+CreatureFlatData.clipDirectory.addClipsByName = function(builder, clipsByNameOffset) {
+  builder.addFieldOffset(2, clipsByNameOffset, 0);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {Array.<number>} data
  * @returns {flatbuffers.Offset}
  */
-CreatureFlatData.anchorPointsHolder.endanchorPointsHolder = function(builder) {
+CreatureFlatData.clipDirectory.createClipsByNameVector = function(builder, data) {
+  builder.startVector(4, data.length, 4);
+  for (var i = data.length - 1; i >= 0; i--) {
+    builder.addInt32(data[i]);
+  }
+  return builder.endVector();
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} numElems
+ */
+CreatureFlatData.clipDirectory.startClipsByNameVector = function(builder, numElems) {
+  builder.startVector(4, numElems, 4);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @returns {flatbuffers.Offset}
+ */
+CreatureFlatData.clipDirectory.endclipDirectory = function(builder) {
   var offset = builder.endObject();
   return offset;
 };
@@ -3489,6 +5550,14 @@ CreatureFlatData.rootData.getRootAsrootData = function(bb, obj) {
   return (obj || new CreatureFlatData.rootData).__init(bb.readInt32(bb.position()) + bb.position(), bb);
 };
 
+/**
+ * @param {flatbuffers.ByteBuffer} bb
+ * @returns {boolean}
+ */
+CreatureFlatData.rootData.bufferHasIdentifier = function(bb) {
+  return bb.__has_identifier('CRFD');
+};
+
 /**
  * @param {CreatureFlatData.mesh=} obj
  * @returns {CreatureFlatData.mesh}
@@ -3534,11 +5603,28 @@ CreatureFlatData.rootData.prototype.dataAnchorPoints = function(obj) {
   return offset ? (obj || new CreatureFlatData.anchorPointsHolder).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
 };
 
+/**
+ * @returns {number}
+ */
+CreatureFlatData.rootData.prototype.version = function() {
+  var offset = this.bb.__offset(this.bb_pos, 14);
+  return offset ? this.bb.readInt32(this.bb_pos + offset) : 1;
+};
+
+/**
+ * @param {CreatureFlatData.bakedAnimation=} obj
+ * @returns {CreatureFlatData.bakedAnimation}
+ */
+CreatureFlatData.rootData.prototype.dataBakedAnimation = function(obj) {
+  var offset = this.bb.__offset(this.bb_pos, 16);
+  return offset ? (obj || new CreatureFlatData.bakedAnimation).__init(this.bb.__indirect(this.bb_pos + offset), this.bb) : null;
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  */
 CreatureFlatData.rootData.startrootData = function(builder) {
-  builder.startObject(5);
+  builder.startObject(7);
 };
 
 /**
@@ -3581,6 +5667,22 @@ CreatureFlatData.rootData.addDataAnchorPoints = function(builder, dataAnchorPoin
   builder.addFieldOffset(4, dataAnchorPointsOffset, 0);
 };
 
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {number} version
+ */
+CreatureFlatData.rootData.addVersion = function(builder, version) {
+  builder.addFieldInt32(5, version, 1);
+};
+
+/**
+ * @param {flatbuffers.Builder} builder
+ * @param {flatbuffers.Offset} dataBakedAnimationOffset
+ */
+CreatureFlatData.rootData.addDataBakedAnimation = function(builder, dataBakedAnimationOffset) {
+  builder.addFieldOffset(6, dataBakedAnimationOffset, 0);
+};
+
 /**
  * @param {flatbuffers.Builder} builder
  * @returns {flatbuffers.Offset}
@@ -3595,7 +5697,7 @@ CreatureFlatData.rootData.endrootData = function(builder) {
  * @param {flatbuffers.Offset} offset
  */
 CreatureFlatData.rootData.finishrootDataBuffer = function(builder, offset) {
-  builder.finish(offset);
+  builder.finish(offset, 'CRFD');
 };
 
 // Exports for Node.js and RequireJS
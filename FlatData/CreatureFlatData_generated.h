@@ -16,6 +16,7 @@ struct skeleton;
 struct animationBone;
 struct animationBonesTimeSample;
 struct animationBonesList;
+struct animationBonesTrack;
 struct animationMesh;
 struct animationMeshTimeSample;
 struct animationMeshList;
@@ -32,6 +33,10 @@ struct uvSwapItemMesh;
 struct uvSwapItemHolder;
 struct anchorPointData;
 struct anchorPointsHolder;
+struct bakedClip;
+struct bakedAnimation;
+struct clipChunk;
+struct clipDirectory;
 struct rootData;
 
 struct meshRegionBone FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
@@ -135,6 +140,7 @@ struct mesh FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<float> *uvs() const { return GetPointer<const flatbuffers::Vector<float> *>(6); }
   const flatbuffers::Vector<int32_t> *indices() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(8); }
   const flatbuffers::Vector<flatbuffers::Offset<meshRegion>> *regions() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<meshRegion>> *>(10); }
+  const flatbuffers::Vector<int32_t> *regions_by_name() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(12); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* points */) &&
@@ -146,6 +152,8 @@ struct mesh FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<flatbuffers::uoffset_t>(verifier, 10 /* regions */) &&
            verifier.Verify(regions()) &&
            verifier.VerifyVectorOfTables(regions()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 12 /* regions_by_name */) &&
+           verifier.Verify(regions_by_name()) &&
            verifier.EndTable();
   }
 };
@@ -157,10 +165,11 @@ struct meshBuilder {
   void add_uvs(flatbuffers::Offset<flatbuffers::Vector<float>> uvs) { fbb_.AddOffset(6, uvs); }
   void add_indices(flatbuffers::Offset<flatbuffers::Vector<int32_t>> indices) { fbb_.AddOffset(8, indices); }
   void add_regions(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<meshRegion>>> regions) { fbb_.AddOffset(10, regions); }
+  void add_regions_by_name(flatbuffers::Offset<flatbuffers::Vector<int32_t>> regions_by_name) { fbb_.AddOffset(12, regions_by_name); }
   meshBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   meshBuilder &operator=(const meshBuilder &);
   flatbuffers::Offset<mesh> Finish() {
-    auto o = flatbuffers::Offset<mesh>(fbb_.EndTable(start_, 4));
+    auto o = flatbuffers::Offset<mesh>(fbb_.EndTable(start_, 5));
     return o;
   }
 };
@@ -169,8 +178,10 @@ inline flatbuffers::Offset<mesh> Createmesh(flatbuffers::FlatBufferBuilder &_fbb
    flatbuffers::Offset<flatbuffers::Vector<float>> points = 0,
    flatbuffers::Offset<flatbuffers::Vector<float>> uvs = 0,
    flatbuffers::Offset<flatbuffers::Vector<int32_t>> indices = 0,
-   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<meshRegion>>> regions = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<meshRegion>>> regions = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> regions_by_name = 0) {
   meshBuilder builder_(_fbb);
+  builder_.add_regions_by_name(regions_by_name);
   builder_.add_regions(regions);
   builder_.add_indices(indices);
   builder_.add_uvs(uvs);
@@ -238,11 +249,14 @@ inline flatbuffers::Offset<skeletonBone> CreateskeletonBone(flatbuffers::FlatBuf
 
 struct skeleton FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<skeletonBone>> *bones() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<skeletonBone>> *>(4); }
+  const flatbuffers::Vector<int32_t> *bones_by_name() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(6); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* bones */) &&
            verifier.Verify(bones()) &&
            verifier.VerifyVectorOfTables(bones()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* bones_by_name */) &&
+           verifier.Verify(bones_by_name()) &&
            verifier.EndTable();
   }
 };
@@ -251,17 +265,20 @@ struct skeletonBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
   void add_bones(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<skeletonBone>>> bones) { fbb_.AddOffset(4, bones); }
+  void add_bones_by_name(flatbuffers::Offset<flatbuffers::Vector<int32_t>> bones_by_name) { fbb_.AddOffset(6, bones_by_name); }
   skeletonBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   skeletonBuilder &operator=(const skeletonBuilder &);
   flatbuffers::Offset<skeleton> Finish() {
-    auto o = flatbuffers::Offset<skeleton>(fbb_.EndTable(start_, 1));
+    auto o = flatbuffers::Offset<skeleton>(fbb_.EndTable(start_, 2));
     return o;
   }
 };
 
 inline flatbuffers::Offset<skeleton> Createskeleton(flatbuffers::FlatBufferBuilder &_fbb,
-   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<skeletonBone>>> bones = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<skeletonBone>>> bones = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> bones_by_name = 0) {
   skeletonBuilder builder_(_fbb);
+  builder_.add_bones_by_name(bones_by_name);
   builder_.add_bones(bones);
   return builder_.Finish();
 }
@@ -270,6 +287,7 @@ struct animationBone FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(4); }
   const flatbuffers::Vector<float> *start_pt() const { return GetPointer<const flatbuffers::Vector<float> *>(6); }
   const flatbuffers::Vector<float> *end_pt() const { return GetPointer<const flatbuffers::Vector<float> *>(8); }
+  int32_t bone_index() const { return GetField<int32_t>(10, -1); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* name */) &&
@@ -278,6 +296,7 @@ struct animationBone FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.Verify(start_pt()) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 8 /* end_pt */) &&
            verifier.Verify(end_pt()) &&
+           VerifyField<int32_t>(verifier, 10 /* bone_index */) &&
            verifier.EndTable();
   }
 };
@@ -288,10 +307,11 @@ struct animationBoneBuilder {
   void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(4, name); }
   void add_start_pt(flatbuffers::Offset<flatbuffers::Vector<float>> start_pt) { fbb_.AddOffset(6, start_pt); }
   void add_end_pt(flatbuffers::Offset<flatbuffers::Vector<float>> end_pt) { fbb_.AddOffset(8, end_pt); }
+  void add_bone_index(int32_t bone_index) { fbb_.AddElement<int32_t>(10, bone_index, -1); }
   animationBoneBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   animationBoneBuilder &operator=(const animationBoneBuilder &);
   flatbuffers::Offset<animationBone> Finish() {
-    auto o = flatbuffers::Offset<animationBone>(fbb_.EndTable(start_, 3));
+    auto o = flatbuffers::Offset<animationBone>(fbb_.EndTable(start_, 4));
     return o;
   }
 };
@@ -299,8 +319,10 @@ struct animationBoneBuilder {
 inline flatbuffers::Offset<animationBone> CreateanimationBone(flatbuffers::FlatBufferBuilder &_fbb,
    flatbuffers::Offset<flatbuffers::String> name = 0,
    flatbuffers::Offset<flatbuffers::Vector<float>> start_pt = 0,
-   flatbuffers::Offset<flatbuffers::Vector<float>> end_pt = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<float>> end_pt = 0,
+   int32_t bone_index = -1) {
   animationBoneBuilder builder_(_fbb);
+  builder_.add_bone_index(bone_index);
   builder_.add_end_pt(end_pt);
   builder_.add_start_pt(start_pt);
   builder_.add_name(name);
@@ -372,6 +394,80 @@ inline flatbuffers::Offset<animationBonesList> CreateanimationBonesList(flatbuff
   return builder_.Finish();
 }
 
+struct animationBonesTrack FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  const flatbuffers::Vector<int32_t> *times() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(4); }
+  const flatbuffers::Vector<float> *positions() const { return GetPointer<const flatbuffers::Vector<float> *>(6); }
+  int32_t bone_count() const { return GetField<int32_t>(8, 0); }
+  const flatbuffers::Vector<uint16_t> *positions_q() const { return GetPointer<const flatbuffers::Vector<uint16_t> *>(10); }
+  const flatbuffers::Vector<float> *range_min() const { return GetPointer<const flatbuffers::Vector<float> *>(12); }
+  const flatbuffers::Vector<float> *range_extent() const { return GetPointer<const flatbuffers::Vector<float> *>(14); }
+  int32_t quantize_bits() const { return GetField<int32_t>(16, 0); }
+  int32_t delta_interval() const { return GetField<int32_t>(18, 0); }
+  const flatbuffers::Vector<uint8_t> *animated_bones() const { return GetPointer<const flatbuffers::Vector<uint8_t> *>(20); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* times */) &&
+           verifier.Verify(times()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* positions */) &&
+           verifier.Verify(positions()) &&
+           VerifyField<int32_t>(verifier, 8 /* bone_count */) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 10 /* positions_q */) &&
+           verifier.Verify(positions_q()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 12 /* range_min */) &&
+           verifier.Verify(range_min()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 14 /* range_extent */) &&
+           verifier.Verify(range_extent()) &&
+           VerifyField<int32_t>(verifier, 16 /* quantize_bits */) &&
+           VerifyField<int32_t>(verifier, 18 /* delta_interval */) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 20 /* animated_bones */) &&
+           verifier.Verify(animated_bones()) &&
+           verifier.EndTable();
+  }
+};
+
+struct animationBonesTrackBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_times(flatbuffers::Offset<flatbuffers::Vector<int32_t>> times) { fbb_.AddOffset(4, times); }
+  void add_positions(flatbuffers::Offset<flatbuffers::Vector<float>> positions) { fbb_.AddOffset(6, positions); }
+  void add_bone_count(int32_t bone_count) { fbb_.AddElement<int32_t>(8, bone_count, 0); }
+  void add_positions_q(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> positions_q) { fbb_.AddOffset(10, positions_q); }
+  void add_range_min(flatbuffers::Offset<flatbuffers::Vector<float>> range_min) { fbb_.AddOffset(12, range_min); }
+  void add_range_extent(flatbuffers::Offset<flatbuffers::Vector<float>> range_extent) { fbb_.AddOffset(14, range_extent); }
+  void add_quantize_bits(int32_t quantize_bits) { fbb_.AddElement<int32_t>(16, quantize_bits, 0); }
+  void add_delta_interval(int32_t delta_interval) { fbb_.AddElement<int32_t>(18, delta_interval, 0); }
+  void add_animated_bones(flatbuffers::Offset<flatbuffers::Vector<uint8_t>> animated_bones) { fbb_.AddOffset(20, animated_bones); }
+  animationBonesTrackBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  animationBonesTrackBuilder &operator=(const animationBonesTrackBuilder &);
+  flatbuffers::Offset<animationBonesTrack> Finish() {
+    auto o = flatbuffers::Offset<animationBonesTrack>(fbb_.EndTable(start_, 9));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<animationBonesTrack> CreateanimationBonesTrack(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> times = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> positions = 0,
+   int32_t bone_count = 0,
+   flatbuffers::Offset<flatbuffers::Vector<uint16_t>> positions_q = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> range_min = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> range_extent = 0,
+   int32_t quantize_bits = 0,
+   int32_t delta_interval = 0,
+   flatbuffers::Offset<flatbuffers::Vector<uint8_t>> animated_bones = 0) {
+  animationBonesTrackBuilder builder_(_fbb);
+  builder_.add_animated_bones(animated_bones);
+  builder_.add_delta_interval(delta_interval);
+  builder_.add_quantize_bits(quantize_bits);
+  builder_.add_range_extent(range_extent);
+  builder_.add_range_min(range_min);
+  builder_.add_positions_q(positions_q);
+  builder_.add_bone_count(bone_count);
+  builder_.add_positions(positions);
+  builder_.add_times(times);
+  return builder_.Finish();
+}
+
 struct animationMesh FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(4); }
   uint8_t use_dq() const { return GetField<uint8_t>(6, 0); }
@@ -379,6 +475,13 @@ struct animationMesh FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   uint8_t use_post_displacements() const { return GetField<uint8_t>(10, 0); }
   const flatbuffers::Vector<float> *local_displacements() const { return GetPointer<const flatbuffers::Vector<float> *>(12); }
   const flatbuffers::Vector<float> *post_displacements() const { return GetPointer<const flatbuffers::Vector<float> *>(14); }
+  int32_t region_index() const { return GetField<int32_t>(16, -1); }
+  const flatbuffers::Vector<uint16_t> *local_displacements_q() const { return GetPointer<const flatbuffers::Vector<uint16_t> *>(18); }
+  const flatbuffers::Vector<uint16_t> *post_displacements_q() const { return GetPointer<const flatbuffers::Vector<uint16_t> *>(20); }
+  const flatbuffers::Vector<int32_t> *local_displacements_runs() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(22); }
+  const flatbuffers::Vector<float> *local_displacements_sparse() const { return GetPointer<const flatbuffers::Vector<float> *>(24); }
+  const flatbuffers::Vector<int32_t> *post_displacements_runs() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(26); }
+  const flatbuffers::Vector<float> *post_displacements_sparse() const { return GetPointer<const flatbuffers::Vector<float> *>(28); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* name */) &&
@@ -390,6 +493,19 @@ struct animationMesh FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.Verify(local_displacements()) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 14 /* post_displacements */) &&
            verifier.Verify(post_displacements()) &&
+           VerifyField<int32_t>(verifier, 16 /* region_index */) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 18 /* local_displacements_q */) &&
+           verifier.Verify(local_displacements_q()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 20 /* post_displacements_q */) &&
+           verifier.Verify(post_displacements_q()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 22 /* local_displacements_runs */) &&
+           verifier.Verify(local_displacements_runs()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 24 /* local_displacements_sparse */) &&
+           verifier.Verify(local_displacements_sparse()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 26 /* post_displacements_runs */) &&
+           verifier.Verify(post_displacements_runs()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 28 /* post_displacements_sparse */) &&
+           verifier.Verify(post_displacements_sparse()) &&
            verifier.EndTable();
   }
 };
@@ -403,10 +519,17 @@ struct animationMeshBuilder {
   void add_use_post_displacements(uint8_t use_post_displacements) { fbb_.AddElement<uint8_t>(10, use_post_displacements, 0); }
   void add_local_displacements(flatbuffers::Offset<flatbuffers::Vector<float>> local_displacements) { fbb_.AddOffset(12, local_displacements); }
   void add_post_displacements(flatbuffers::Offset<flatbuffers::Vector<float>> post_displacements) { fbb_.AddOffset(14, post_displacements); }
+  void add_region_index(int32_t region_index) { fbb_.AddElement<int32_t>(16, region_index, -1); }
+  void add_local_displacements_q(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> local_displacements_q) { fbb_.AddOffset(18, local_displacements_q); }
+  void add_post_displacements_q(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> post_displacements_q) { fbb_.AddOffset(20, post_displacements_q); }
+  void add_local_displacements_runs(flatbuffers::Offset<flatbuffers::Vector<int32_t>> local_displacements_runs) { fbb_.AddOffset(22, local_displacements_runs); }
+  void add_local_displacements_sparse(flatbuffers::Offset<flatbuffers::Vector<float>> local_displacements_sparse) { fbb_.AddOffset(24, local_displacements_sparse); }
+  void add_post_displacements_runs(flatbuffers::Offset<flatbuffers::Vector<int32_t>> post_displacements_runs) { fbb_.AddOffset(26, post_displacements_runs); }
+  void add_post_displacements_sparse(flatbuffers::Offset<flatbuffers::Vector<float>> post_displacements_sparse) { fbb_.AddOffset(28, post_displacements_sparse); }
   animationMeshBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   animationMeshBuilder &operator=(const animationMeshBuilder &);
   flatbuffers::Offset<animationMesh> Finish() {
-    auto o = flatbuffers::Offset<animationMesh>(fbb_.EndTable(start_, 6));
+    auto o = flatbuffers::Offset<animationMesh>(fbb_.EndTable(start_, 13));
     return o;
   }
 };
@@ -417,8 +540,22 @@ inline flatbuffers::Offset<animationMesh> CreateanimationMesh(flatbuffers::FlatB
    uint8_t use_local_displacements = 0,
    uint8_t use_post_displacements = 0,
    flatbuffers::Offset<flatbuffers::Vector<float>> local_displacements = 0,
-   flatbuffers::Offset<flatbuffers::Vector<float>> post_displacements = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<float>> post_displacements = 0,
+   int32_t region_index = -1,
+   flatbuffers::Offset<flatbuffers::Vector<uint16_t>> local_displacements_q = 0,
+   flatbuffers::Offset<flatbuffers::Vector<uint16_t>> post_displacements_q = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> local_displacements_runs = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> local_displacements_sparse = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> post_displacements_runs = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> post_displacements_sparse = 0) {
   animationMeshBuilder builder_(_fbb);
+  builder_.add_post_displacements_sparse(post_displacements_sparse);
+  builder_.add_post_displacements_runs(post_displacements_runs);
+  builder_.add_local_displacements_sparse(local_displacements_sparse);
+  builder_.add_local_displacements_runs(local_displacements_runs);
+  builder_.add_post_displacements_q(post_displacements_q);
+  builder_.add_local_displacements_q(local_displacements_q);
+  builder_.add_region_index(region_index);
   builder_.add_post_displacements(post_displacements);
   builder_.add_local_displacements(local_displacements);
   builder_.add_name(name);
@@ -465,11 +602,27 @@ inline flatbuffers::Offset<animationMeshTimeSample> CreateanimationMeshTimeSampl
 
 struct animationMeshList FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<animationMeshTimeSample>> *timeSamples() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<animationMeshTimeSample>> *>(4); }
+  const flatbuffers::Vector<float> *local_range_min() const { return GetPointer<const flatbuffers::Vector<float> *>(6); }
+  const flatbuffers::Vector<float> *local_range_extent() const { return GetPointer<const flatbuffers::Vector<float> *>(8); }
+  const flatbuffers::Vector<float> *post_range_min() const { return GetPointer<const flatbuffers::Vector<float> *>(10); }
+  const flatbuffers::Vector<float> *post_range_extent() const { return GetPointer<const flatbuffers::Vector<float> *>(12); }
+  int32_t quantize_bits() const { return GetField<int32_t>(14, 0); }
+  int32_t delta_interval() const { return GetField<int32_t>(16, 0); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* timeSamples */) &&
            verifier.Verify(timeSamples()) &&
            verifier.VerifyVectorOfTables(timeSamples()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* local_range_min */) &&
+           verifier.Verify(local_range_min()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 8 /* local_range_extent */) &&
+           verifier.Verify(local_range_extent()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 10 /* post_range_min */) &&
+           verifier.Verify(post_range_min()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 12 /* post_range_extent */) &&
+           verifier.Verify(post_range_extent()) &&
+           VerifyField<int32_t>(verifier, 14 /* quantize_bits */) &&
+           VerifyField<int32_t>(verifier, 16 /* delta_interval */) &&
            verifier.EndTable();
   }
 };
@@ -478,17 +631,35 @@ struct animationMeshListBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
   void add_timeSamples(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<animationMeshTimeSample>>> timeSamples) { fbb_.AddOffset(4, timeSamples); }
+  void add_local_range_min(flatbuffers::Offset<flatbuffers::Vector<float>> local_range_min) { fbb_.AddOffset(6, local_range_min); }
+  void add_local_range_extent(flatbuffers::Offset<flatbuffers::Vector<float>> local_range_extent) { fbb_.AddOffset(8, local_range_extent); }
+  void add_post_range_min(flatbuffers::Offset<flatbuffers::Vector<float>> post_range_min) { fbb_.AddOffset(10, post_range_min); }
+  void add_post_range_extent(flatbuffers::Offset<flatbuffers::Vector<float>> post_range_extent) { fbb_.AddOffset(12, post_range_extent); }
+  void add_quantize_bits(int32_t quantize_bits) { fbb_.AddElement<int32_t>(14, quantize_bits, 0); }
+  void add_delta_interval(int32_t delta_interval) { fbb_.AddElement<int32_t>(16, delta_interval, 0); }
   animationMeshListBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   animationMeshListBuilder &operator=(const animationMeshListBuilder &);
   flatbuffers::Offset<animationMeshList> Finish() {
-    auto o = flatbuffers::Offset<animationMeshList>(fbb_.EndTable(start_, 1));
+    auto o = flatbuffers::Offset<animationMeshList>(fbb_.EndTable(start_, 7));
     return o;
   }
 };
 
 inline flatbuffers::Offset<animationMeshList> CreateanimationMeshList(flatbuffers::FlatBufferBuilder &_fbb,
-   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<animationMeshTimeSample>>> timeSamples = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<animationMeshTimeSample>>> timeSamples = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> local_range_min = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> local_range_extent = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> post_range_min = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> post_range_extent = 0,
+   int32_t quantize_bits = 0,
+   int32_t delta_interval = 0) {
   animationMeshListBuilder builder_(_fbb);
+  builder_.add_delta_interval(delta_interval);
+  builder_.add_quantize_bits(quantize_bits);
+  builder_.add_post_range_extent(post_range_extent);
+  builder_.add_post_range_min(post_range_min);
+  builder_.add_local_range_extent(local_range_extent);
+  builder_.add_local_range_min(local_range_min);
   builder_.add_timeSamples(timeSamples);
   return builder_.Finish();
 }
@@ -499,6 +670,7 @@ struct animationUVSwap FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<float> *global_offset() const { return GetPointer<const flatbuffers::Vector<float> *>(8); }
   const flatbuffers::Vector<float> *scale() const { return GetPointer<const flatbuffers::Vector<float> *>(10); }
   uint8_t enabled() const { return GetField<uint8_t>(12, 0); }
+  int32_t region_index() const { return GetField<int32_t>(14, -1); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* name */) &&
@@ -510,6 +682,7 @@ struct animationUVSwap FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            VerifyField<flatbuffers::uoffset_t>(verifier, 10 /* scale */) &&
            verifier.Verify(scale()) &&
            VerifyField<uint8_t>(verifier, 12 /* enabled */) &&
+           VerifyField<int32_t>(verifier, 14 /* region_index */) &&
            verifier.EndTable();
   }
 };
@@ -522,10 +695,11 @@ struct animationUVSwapBuilder {
   void add_global_offset(flatbuffers::Offset<flatbuffers::Vector<float>> global_offset) { fbb_.AddOffset(8, global_offset); }
   void add_scale(flatbuffers::Offset<flatbuffers::Vector<float>> scale) { fbb_.AddOffset(10, scale); }
   void add_enabled(uint8_t enabled) { fbb_.AddElement<uint8_t>(12, enabled, 0); }
+  void add_region_index(int32_t region_index) { fbb_.AddElement<int32_t>(14, region_index, -1); }
   animationUVSwapBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   animationUVSwapBuilder &operator=(const animationUVSwapBuilder &);
   flatbuffers::Offset<animationUVSwap> Finish() {
-    auto o = flatbuffers::Offset<animationUVSwap>(fbb_.EndTable(start_, 5));
+    auto o = flatbuffers::Offset<animationUVSwap>(fbb_.EndTable(start_, 6));
     return o;
   }
 };
@@ -535,8 +709,10 @@ inline flatbuffers::Offset<animationUVSwap> CreateanimationUVSwap(flatbuffers::F
    flatbuffers::Offset<flatbuffers::Vector<float>> local_offset = 0,
    flatbuffers::Offset<flatbuffers::Vector<float>> global_offset = 0,
    flatbuffers::Offset<flatbuffers::Vector<float>> scale = 0,
-   uint8_t enabled = 0) {
+   uint8_t enabled = 0,
+   int32_t region_index = -1) {
   animationUVSwapBuilder builder_(_fbb);
+  builder_.add_region_index(region_index);
   builder_.add_scale(scale);
   builder_.add_global_offset(global_offset);
   builder_.add_local_offset(local_offset);
@@ -613,11 +789,13 @@ inline flatbuffers::Offset<animationUVSwapList> CreateanimationUVSwapList(flatbu
 struct animationMeshOpacity FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(4); }
   float opacity() const { return GetField<float>(6, 0); }
+  int32_t region_index() const { return GetField<int32_t>(8, -1); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* name */) &&
            verifier.Verify(name()) &&
            VerifyField<float>(verifier, 6 /* opacity */) &&
+           VerifyField<int32_t>(verifier, 8 /* region_index */) &&
            verifier.EndTable();
   }
 };
@@ -627,18 +805,21 @@ struct animationMeshOpacityBuilder {
   flatbuffers::uoffset_t start_;
   void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(4, name); }
   void add_opacity(float opacity) { fbb_.AddElement<float>(6, opacity, 0); }
+  void add_region_index(int32_t region_index) { fbb_.AddElement<int32_t>(8, region_index, -1); }
   animationMeshOpacityBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   animationMeshOpacityBuilder &operator=(const animationMeshOpacityBuilder &);
   flatbuffers::Offset<animationMeshOpacity> Finish() {
-    auto o = flatbuffers::Offset<animationMeshOpacity>(fbb_.EndTable(start_, 2));
+    auto o = flatbuffers::Offset<animationMeshOpacity>(fbb_.EndTable(start_, 3));
     return o;
   }
 };
 
 inline flatbuffers::Offset<animationMeshOpacity> CreateanimationMeshOpacity(flatbuffers::FlatBufferBuilder &_fbb,
    flatbuffers::Offset<flatbuffers::String> name = 0,
-   float opacity = 0) {
+   float opacity = 0,
+   int32_t region_index = -1) {
   animationMeshOpacityBuilder builder_(_fbb);
+  builder_.add_region_index(region_index);
   builder_.add_opacity(opacity);
   builder_.add_name(name);
   return builder_.Finish();
@@ -715,6 +896,7 @@ struct animationClip FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const animationMeshList *meshes() const { return GetPointer<const animationMeshList *>(8); }
   const animationUVSwapList *uvSwaps() const { return GetPointer<const animationUVSwapList *>(10); }
   const animationMeshOpacityList *meshOpacities() const { return GetPointer<const animationMeshOpacityList *>(12); }
+  const animationBonesTrack *bonesTrack() const { return GetPointer<const animationBonesTrack *>(14); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* name */) &&
@@ -727,6 +909,8 @@ struct animationClip FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(uvSwaps()) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 12 /* meshOpacities */) &&
            verifier.VerifyTable(meshOpacities()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 14 /* bonesTrack */) &&
+           verifier.VerifyTable(bonesTrack()) &&
            verifier.EndTable();
   }
 };
@@ -739,10 +923,11 @@ struct animationClipBuilder {
   void add_meshes(flatbuffers::Offset<animationMeshList> meshes) { fbb_.AddOffset(8, meshes); }
   void add_uvSwaps(flatbuffers::Offset<animationUVSwapList> uvSwaps) { fbb_.AddOffset(10, uvSwaps); }
   void add_meshOpacities(flatbuffers::Offset<animationMeshOpacityList> meshOpacities) { fbb_.AddOffset(12, meshOpacities); }
+  void add_bonesTrack(flatbuffers::Offset<animationBonesTrack> bonesTrack) { fbb_.AddOffset(14, bonesTrack); }
   animationClipBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   animationClipBuilder &operator=(const animationClipBuilder &);
   flatbuffers::Offset<animationClip> Finish() {
-    auto o = flatbuffers::Offset<animationClip>(fbb_.EndTable(start_, 5));
+    auto o = flatbuffers::Offset<animationClip>(fbb_.EndTable(start_, 6));
     return o;
   }
 };
@@ -752,8 +937,10 @@ inline flatbuffers::Offset<animationClip> CreateanimationClip(flatbuffers::FlatB
    flatbuffers::Offset<animationBonesList> bones = 0,
    flatbuffers::Offset<animationMeshList> meshes = 0,
    flatbuffers::Offset<animationUVSwapList> uvSwaps = 0,
-   flatbuffers::Offset<animationMeshOpacityList> meshOpacities = 0) {
+   flatbuffers::Offset<animationMeshOpacityList> meshOpacities = 0,
+   flatbuffers::Offset<animationBonesTrack> bonesTrack = 0) {
   animationClipBuilder builder_(_fbb);
+  builder_.add_bonesTrack(bonesTrack);
   builder_.add_meshOpacities(meshOpacities);
   builder_.add_uvSwaps(uvSwaps);
   builder_.add_meshes(meshes);
@@ -764,11 +951,14 @@ inline flatbuffers::Offset<animationClip> CreateanimationClip(flatbuffers::FlatB
 
 struct animation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<animationClip>> *clips() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<animationClip>> *>(4); }
+  const flatbuffers::Vector<int32_t> *clips_by_name() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(6); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* clips */) &&
            verifier.Verify(clips()) &&
            verifier.VerifyVectorOfTables(clips()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* clips_by_name */) &&
+           verifier.Verify(clips_by_name()) &&
            verifier.EndTable();
   }
 };
@@ -777,17 +967,20 @@ struct animationBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
   void add_clips(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<animationClip>>> clips) { fbb_.AddOffset(4, clips); }
+  void add_clips_by_name(flatbuffers::Offset<flatbuffers::Vector<int32_t>> clips_by_name) { fbb_.AddOffset(6, clips_by_name); }
   animationBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   animationBuilder &operator=(const animationBuilder &);
   flatbuffers::Offset<animation> Finish() {
-    auto o = flatbuffers::Offset<animation>(fbb_.EndTable(start_, 1));
+    auto o = flatbuffers::Offset<animation>(fbb_.EndTable(start_, 2));
     return o;
   }
 };
 
 inline flatbuffers::Offset<animation> Createanimation(flatbuffers::FlatBufferBuilder &_fbb,
-   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<animationClip>>> clips = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<animationClip>>> clips = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> clips_by_name = 0) {
   animationBuilder builder_(_fbb);
+  builder_.add_clips_by_name(clips_by_name);
   builder_.add_clips(clips);
   return builder_.Finish();
 }
@@ -876,11 +1069,14 @@ inline flatbuffers::Offset<uvSwapItemMesh> CreateuvSwapItemMesh(flatbuffers::Fla
 
 struct uvSwapItemHolder FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<uvSwapItemMesh>> *meshes() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<uvSwapItemMesh>> *>(4); }
+  const flatbuffers::Vector<int32_t> *meshes_by_name() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(6); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* meshes */) &&
            verifier.Verify(meshes()) &&
            verifier.VerifyVectorOfTables(meshes()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* meshes_by_name */) &&
+           verifier.Verify(meshes_by_name()) &&
            verifier.EndTable();
   }
 };
@@ -889,17 +1085,20 @@ struct uvSwapItemHolderBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
   void add_meshes(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<uvSwapItemMesh>>> meshes) { fbb_.AddOffset(4, meshes); }
+  void add_meshes_by_name(flatbuffers::Offset<flatbuffers::Vector<int32_t>> meshes_by_name) { fbb_.AddOffset(6, meshes_by_name); }
   uvSwapItemHolderBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   uvSwapItemHolderBuilder &operator=(const uvSwapItemHolderBuilder &);
   flatbuffers::Offset<uvSwapItemHolder> Finish() {
-    auto o = flatbuffers::Offset<uvSwapItemHolder>(fbb_.EndTable(start_, 1));
+    auto o = flatbuffers::Offset<uvSwapItemHolder>(fbb_.EndTable(start_, 2));
     return o;
   }
 };
 
 inline flatbuffers::Offset<uvSwapItemHolder> CreateuvSwapItemHolder(flatbuffers::FlatBufferBuilder &_fbb,
-   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<uvSwapItemMesh>>> meshes = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<uvSwapItemMesh>>> meshes = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> meshes_by_name = 0) {
   uvSwapItemHolderBuilder builder_(_fbb);
+  builder_.add_meshes_by_name(meshes_by_name);
   builder_.add_meshes(meshes);
   return builder_.Finish();
 }
@@ -941,11 +1140,14 @@ inline flatbuffers::Offset<anchorPointData> CreateanchorPointData(flatbuffers::F
 
 struct anchorPointsHolder FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const flatbuffers::Vector<flatbuffers::Offset<anchorPointData>> *anchorPoints() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<anchorPointData>> *>(4); }
+  const flatbuffers::Vector<int32_t> *anchorPoints_by_clip_name() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(6); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* anchorPoints */) &&
            verifier.Verify(anchorPoints()) &&
            verifier.VerifyVectorOfTables(anchorPoints()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* anchorPoints_by_clip_name */) &&
+           verifier.Verify(anchorPoints_by_clip_name()) &&
            verifier.EndTable();
   }
 };
@@ -954,27 +1156,216 @@ struct anchorPointsHolderBuilder {
   flatbuffers::FlatBufferBuilder &fbb_;
   flatbuffers::uoffset_t start_;
   void add_anchorPoints(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<anchorPointData>>> anchorPoints) { fbb_.AddOffset(4, anchorPoints); }
+  void add_anchorPoints_by_clip_name(flatbuffers::Offset<flatbuffers::Vector<int32_t>> anchorPoints_by_clip_name) { fbb_.AddOffset(6, anchorPoints_by_clip_name); }
   anchorPointsHolderBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   anchorPointsHolderBuilder &operator=(const anchorPointsHolderBuilder &);
   flatbuffers::Offset<anchorPointsHolder> Finish() {
-    auto o = flatbuffers::Offset<anchorPointsHolder>(fbb_.EndTable(start_, 1));
+    auto o = flatbuffers::Offset<anchorPointsHolder>(fbb_.EndTable(start_, 2));
     return o;
   }
 };
 
 inline flatbuffers::Offset<anchorPointsHolder> CreateanchorPointsHolder(flatbuffers::FlatBufferBuilder &_fbb,
-   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<anchorPointData>>> anchorPoints = 0) {
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<anchorPointData>>> anchorPoints = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> anchorPoints_by_clip_name = 0) {
   anchorPointsHolderBuilder builder_(_fbb);
+  builder_.add_anchorPoints_by_clip_name(anchorPoints_by_clip_name);
   builder_.add_anchorPoints(anchorPoints);
   return builder_.Finish();
 }
 
+struct bakedClip FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(4); }
+  int32_t start_time() const { return GetField<int32_t>(6, 0); }
+  int32_t end_time() const { return GetField<int32_t>(8, 0); }
+  const flatbuffers::Vector<float> *bounds_min() const { return GetPointer<const flatbuffers::Vector<float> *>(10); }
+  const flatbuffers::Vector<float> *bounds_extent() const { return GetPointer<const flatbuffers::Vector<float> *>(12); }
+  const flatbuffers::Vector<uint16_t> *points_q() const { return GetPointer<const flatbuffers::Vector<uint16_t> *>(14); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* name */) &&
+           verifier.Verify(name()) &&
+           VerifyField<int32_t>(verifier, 6 /* start_time */) &&
+           VerifyField<int32_t>(verifier, 8 /* end_time */) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 10 /* bounds_min */) &&
+           verifier.Verify(bounds_min()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 12 /* bounds_extent */) &&
+           verifier.Verify(bounds_extent()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 14 /* points_q */) &&
+           verifier.Verify(points_q()) &&
+           verifier.EndTable();
+  }
+};
+
+struct bakedClipBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(4, name); }
+  void add_start_time(int32_t start_time) { fbb_.AddElement<int32_t>(6, start_time, 0); }
+  void add_end_time(int32_t end_time) { fbb_.AddElement<int32_t>(8, end_time, 0); }
+  void add_bounds_min(flatbuffers::Offset<flatbuffers::Vector<float>> bounds_min) { fbb_.AddOffset(10, bounds_min); }
+  void add_bounds_extent(flatbuffers::Offset<flatbuffers::Vector<float>> bounds_extent) { fbb_.AddOffset(12, bounds_extent); }
+  void add_points_q(flatbuffers::Offset<flatbuffers::Vector<uint16_t>> points_q) { fbb_.AddOffset(14, points_q); }
+  bakedClipBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  bakedClipBuilder &operator=(const bakedClipBuilder &);
+  flatbuffers::Offset<bakedClip> Finish() {
+    auto o = flatbuffers::Offset<bakedClip>(fbb_.EndTable(start_, 6));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<bakedClip> CreatebakedClip(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name = 0,
+   int32_t start_time = 0,
+   int32_t end_time = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> bounds_min = 0,
+   flatbuffers::Offset<flatbuffers::Vector<float>> bounds_extent = 0,
+   flatbuffers::Offset<flatbuffers::Vector<uint16_t>> points_q = 0) {
+  bakedClipBuilder builder_(_fbb);
+  builder_.add_points_q(points_q);
+  builder_.add_bounds_extent(bounds_extent);
+  builder_.add_bounds_min(bounds_min);
+  builder_.add_end_time(end_time);
+  builder_.add_start_time(start_time);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct bakedAnimation FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  int32_t point_count() const { return GetField<int32_t>(4, 0); }
+  const flatbuffers::Vector<flatbuffers::Offset<bakedClip>> *clips() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<bakedClip>> *>(6); }
+  const flatbuffers::Vector<int32_t> *clips_by_name() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(8); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<int32_t>(verifier, 4 /* point_count */) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* clips */) &&
+           verifier.Verify(clips()) &&
+           verifier.VerifyVectorOfTables(clips()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 8 /* clips_by_name */) &&
+           verifier.Verify(clips_by_name()) &&
+           verifier.EndTable();
+  }
+};
+
+struct bakedAnimationBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_point_count(int32_t point_count) { fbb_.AddElement<int32_t>(4, point_count, 0); }
+  void add_clips(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<bakedClip>>> clips) { fbb_.AddOffset(6, clips); }
+  void add_clips_by_name(flatbuffers::Offset<flatbuffers::Vector<int32_t>> clips_by_name) { fbb_.AddOffset(8, clips_by_name); }
+  bakedAnimationBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  bakedAnimationBuilder &operator=(const bakedAnimationBuilder &);
+  flatbuffers::Offset<bakedAnimation> Finish() {
+    auto o = flatbuffers::Offset<bakedAnimation>(fbb_.EndTable(start_, 3));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<bakedAnimation> CreatebakedAnimation(flatbuffers::FlatBufferBuilder &_fbb,
+   int32_t point_count = 0,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<bakedClip>>> clips = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> clips_by_name = 0) {
+  bakedAnimationBuilder builder_(_fbb);
+  builder_.add_clips_by_name(clips_by_name);
+  builder_.add_clips(clips);
+  builder_.add_point_count(point_count);
+  return builder_.Finish();
+}
+
+struct clipChunk FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  const flatbuffers::String *name() const { return GetPointer<const flatbuffers::String *>(4); }
+  uint32_t offset() const { return GetField<uint32_t>(6, 0); }
+  uint32_t size() const { return GetField<uint32_t>(8, 0); }
+  uint32_t compressed_size() const { return GetField<uint32_t>(10, 0); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* name */) &&
+           verifier.Verify(name()) &&
+           VerifyField<uint32_t>(verifier, 6 /* offset */) &&
+           VerifyField<uint32_t>(verifier, 8 /* size */) &&
+           VerifyField<uint32_t>(verifier, 10 /* compressed_size */) &&
+           verifier.EndTable();
+  }
+};
+
+struct clipChunkBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_name(flatbuffers::Offset<flatbuffers::String> name) { fbb_.AddOffset(4, name); }
+  void add_offset(uint32_t offset) { fbb_.AddElement<uint32_t>(6, offset, 0); }
+  void add_size(uint32_t size) { fbb_.AddElement<uint32_t>(8, size, 0); }
+  void add_compressed_size(uint32_t compressed_size) { fbb_.AddElement<uint32_t>(10, compressed_size, 0); }
+  clipChunkBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  clipChunkBuilder &operator=(const clipChunkBuilder &);
+  flatbuffers::Offset<clipChunk> Finish() {
+    auto o = flatbuffers::Offset<clipChunk>(fbb_.EndTable(start_, 4));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<clipChunk> CreateclipChunk(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<flatbuffers::String> name = 0,
+   uint32_t offset = 0,
+   uint32_t size = 0,
+   uint32_t compressed_size = 0) {
+  clipChunkBuilder builder_(_fbb);
+  builder_.add_compressed_size(compressed_size);
+  builder_.add_size(size);
+  builder_.add_offset(offset);
+  builder_.add_name(name);
+  return builder_.Finish();
+}
+
+struct clipDirectory FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
+  const clipChunk *base() const { return GetPointer<const clipChunk *>(4); }
+  const flatbuffers::Vector<flatbuffers::Offset<clipChunk>> *clips() const { return GetPointer<const flatbuffers::Vector<flatbuffers::Offset<clipChunk>> *>(6); }
+  const flatbuffers::Vector<int32_t> *clips_by_name() const { return GetPointer<const flatbuffers::Vector<int32_t> *>(8); }
+  bool Verify(flatbuffers::Verifier &verifier) const {
+    return VerifyTableStart(verifier) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* base */) &&
+           verifier.VerifyTable(base()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 6 /* clips */) &&
+           verifier.Verify(clips()) &&
+           verifier.VerifyVectorOfTables(clips()) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 8 /* clips_by_name */) &&
+           verifier.Verify(clips_by_name()) &&
+           verifier.EndTable();
+  }
+};
+
+struct clipDirectoryBuilder {
+  flatbuffers::FlatBufferBuilder &fbb_;
+  flatbuffers::uoffset_t start_;
+  void add_base(flatbuffers::Offset<clipChunk> base) { fbb_.AddOffset(4, base); }
+  void add_clips(flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<clipChunk>>> clips) { fbb_.AddOffset(6, clips); }
+  void add_clips_by_name(flatbuffers::Offset<flatbuffers::Vector<int32_t>> clips_by_name) { fbb_.AddOffset(8, clips_by_name); }
+  clipDirectoryBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
+  clipDirectoryBuilder &operator=(const clipDirectoryBuilder &);
+  flatbuffers::Offset<clipDirectory> Finish() {
+    auto o = flatbuffers::Offset<clipDirectory>(fbb_.EndTable(start_, 3));
+    return o;
+  }
+};
+
+inline flatbuffers::Offset<clipDirectory> CreateclipDirectory(flatbuffers::FlatBufferBuilder &_fbb,
+   flatbuffers::Offset<clipChunk> base = 0,
+   flatbuffers::Offset<flatbuffers::Vector<flatbuffers::Offset<clipChunk>>> clips = 0,
+   flatbuffers::Offset<flatbuffers::Vector<int32_t>> clips_by_name = 0) {
+  clipDirectoryBuilder builder_(_fbb);
+  builder_.add_clips_by_name(clips_by_name);
+  builder_.add_clips(clips);
+  builder_.add_base(base);
+  return builder_.Finish();
+}
+
 struct rootData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
   const mesh *dataMesh() const { return GetPointer<const mesh *>(4); }
   const skeleton *dataSkeleton() const { return GetPointer<const skeleton *>(6); }
   const animation *dataAnimation() const { return GetPointer<const animation *>(8); }
   const uvSwapItemHolder *dataUvSwapItem() const { return GetPointer<const uvSwapItemHolder *>(10); }
   const anchorPointsHolder *dataAnchorPoints() const { return GetPointer<const anchorPointsHolder *>(12); }
+  int32_t version() const { return GetField<int32_t>(14, 1); }
+  const bakedAnimation *dataBakedAnimation() const { return GetPointer<const bakedAnimation *>(16); }
   bool Verify(flatbuffers::Verifier &verifier) const {
     return VerifyTableStart(verifier) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 4 /* dataMesh */) &&
@@ -987,6 +1378,9 @@ struct rootData FLATBUFFERS_FINAL_CLASS : private flatbuffers::Table {
            verifier.VerifyTable(dataUvSwapItem()) &&
            VerifyField<flatbuffers::uoffset_t>(verifier, 12 /* dataAnchorPoints */) &&
            verifier.VerifyTable(dataAnchorPoints()) &&
+           VerifyField<int32_t>(verifier, 14 /* version */) &&
+           VerifyField<flatbuffers::uoffset_t>(verifier, 16 /* dataBakedAnimation */) &&
+           verifier.VerifyTable(dataBakedAnimation()) &&
            verifier.EndTable();
   }
 };
@@ -999,10 +1393,12 @@ struct rootDataBuilder {
   void add_dataAnimation(flatbuffers::Offset<animation> dataAnimation) { fbb_.AddOffset(8, dataAnimation); }
   void add_dataUvSwapItem(flatbuffers::Offset<uvSwapItemHolder> dataUvSwapItem) { fbb_.AddOffset(10, dataUvSwapItem); }
   void add_dataAnchorPoints(flatbuffers::Offset<anchorPointsHolder> dataAnchorPoints) { fbb_.AddOffset(12, dataAnchorPoints); }
+  void add_version(int32_t version) { fbb_.AddElement<int32_t>(14, version, 1); }
+  void add_dataBakedAnimation(flatbuffers::Offset<bakedAnimation> dataBakedAnimation) { fbb_.AddOffset(16, dataBakedAnimation); }
   rootDataBuilder(flatbuffers::FlatBufferBuilder &_fbb) : fbb_(_fbb) { start_ = fbb_.StartTable(); }
   rootDataBuilder &operator=(const rootDataBuilder &);
   flatbuffers::Offset<rootData> Finish() {
-    auto o = flatbuffers::Offset<rootData>(fbb_.EndTable(start_, 5));
+    auto o = flatbuffers::Offset<rootData>(fbb_.EndTable(start_, 7));
     return o;
   }
 };
@@ -1012,8 +1408,12 @@ inline flatbuffers::Offset<rootData> CreaterootData(flatbuffers::FlatBufferBuild
    flatbuffers::Offset<skeleton> dataSkeleton = 0,
    flatbuffers::Offset<animation> dataAnimation = 0,
    flatbuffers::Offset<uvSwapItemHolder> dataUvSwapItem = 0,
-   flatbuffers::Offset<anchorPointsHolder> dataAnchorPoints = 0) {
+   flatbuffers::Offset<anchorPointsHolder> dataAnchorPoints = 0,
+   int32_t version = 1,
+   flatbuffers::Offset<bakedAnimation> dataBakedAnimation = 0) {
   rootDataBuilder builder_(_fbb);
+  builder_.add_dataBakedAnimation(dataBakedAnimation);
+  builder_.add_version(version);
   builder_.add_dataAnchorPoints(dataAnchorPoints);
   builder_.add_dataUvSwapItem(dataUvSwapItem);
   builder_.add_dataAnimation(dataAnimation);
@@ -1024,9 +1424,13 @@ inline flatbuffers::Offset<rootData> CreaterootData(flatbuffers::FlatBufferBuild
 
 inline const CreatureFlatData::rootData *GetrootData(const void *buf) { return flatbuffers::GetRoot<CreatureFlatData::rootData>(buf); }
 
+inline const char *rootDataIdentifier() { return "CRFD"; }
+
+inline bool rootDataBufferHasIdentifier(const void *buf) { return flatbuffers::BufferHasIdentifier(buf, rootDataIdentifier()); }
+
 inline bool VerifyrootDataBuffer(flatbuffers::Verifier &verifier) { return verifier.VerifyBuffer<CreatureFlatData::rootData>(); }
 
-inline void FinishrootDataBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<CreatureFlatData::rootData> root) { fbb.Finish(root); }
+inline void FinishrootDataBuffer(flatbuffers::FlatBufferBuilder &fbb, flatbuffers::Offset<CreatureFlatData::rootData> root) { fbb.Finish(root, rootDataIdentifier()); }
 
 }  // namespace CreatureFlatData
 
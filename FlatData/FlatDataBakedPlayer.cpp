@@ -0,0 +1,88 @@
+#include <cmath>
+#include <algorithm>
+#include <FlatDataBakedPlayer.h>
+
+FlatDataBakedPlayer::FlatDataBakedPlayer(const CreatureFlatData::rootData * root_in)
+	: baked_data(root_in->dataBakedAnimation()),
+	point_count(0)
+{
+	if (baked_data && baked_data->clips())
+	{
+		point_count = baked_data->point_count();
+	}
+	else
+	{
+		baked_data = nullptr;
+	}
+}
+
+bool
+FlatDataBakedPlayer::IsValid() const
+{
+	return baked_data != nullptr;
+}
+
+int
+FlatDataBakedPlayer::GetClipCount() const
+{
+	return baked_data ? (int)baked_data->clips()->size() : 0;
+}
+
+int
+FlatDataBakedPlayer::GetPointCount() const
+{
+	return point_count;
+}
+
+bool
+FlatDataBakedPlayer::GetClipTimeRange(int clip_index, int& start_time_out, int& end_time_out) const
+{
+	if ((clip_index < 0) || (clip_index >= GetClipCount()))
+	{
+		return false;
+	}
+
+	auto cur_clip = baked_data->clips()->Get(clip_index);
+	start_time_out = cur_clip->start_time();
+	end_time_out = cur_clip->end_time();
+	return (end_time_out >= start_time_out) && cur_clip->points_q();
+}
+
+bool
+FlatDataBakedPlayer::Sample(int clip_index, float time_in, float * points_out) const
+{
+	int start_time = 0, end_time = 0;
+	if (!GetClipTimeRange(clip_index, start_time, end_time))
+	{
+		return false;
+	}
+
+	auto cur_clip = baked_data->clips()->Get(clip_index);
+	auto bounds_min = cur_clip->bounds_min();
+	auto bounds_extent = cur_clip->bounds_extent();
+	size_t row_size = (size_t)point_count * 2;
+	size_t frame_count = (size_t)(end_time - start_time + 1);
+	if (!bounds_min || !bounds_extent || (bounds_min->size() < 2) || (bounds_extent->size() < 2)
+		|| (cur_clip->points_q()->size() < frame_count * row_size))
+	{
+		return false;
+	}
+
+	float frame_time = std::min(std::max(time_in - (float)start_time, 0.0f), (float)(frame_count - 1));
+	size_t frame_index = (size_t)std::floor(frame_time);
+	size_t next_index = std::min(frame_index + 1, frame_count - 1);
+	float alpha = frame_time - (float)frame_index;
+
+	const uint16_t * frame_q = cur_clip->points_q()->data() + frame_index * row_size;
+	const uint16_t * next_q = cur_clip->points_q()->data() + next_index * row_size;
+	float read_min[2] = { bounds_min->Get(0), bounds_min->Get(1) };
+	float read_scale[2] = { bounds_extent->Get(0) / 65535.0f, bounds_extent->Get(1) / 65535.0f };
+	for (size_t i = 0; i < row_size; i++)
+	{
+		float cur_q = (float)frame_q[i];
+		cur_q += ((float)next_q[i] - cur_q) * alpha;
+		points_out[i] = read_min[i & 1] + cur_q * read_scale[i & 1];
+	}
+
+	return true;
+}
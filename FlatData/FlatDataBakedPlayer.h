@@ -0,0 +1,30 @@
+#pragma once
+
+#include <CreatureFlatData_generated.h>
+
+// Plays the bakedAnimation of a Creature FlatData file written by the converter's -bake
+// mode. A sample dequantizes and blends the two stored frames around its time, with no
+// sampling or skinning. Only reads root_in, so one player can serve many threads.
+class FlatDataBakedPlayer
+{
+public:
+	FlatDataBakedPlayer(const CreatureFlatData::rootData * root_in);
+
+	// False if the file holds no baked animation
+	bool IsValid() const;
+
+	int GetClipCount() const;
+
+	int GetPointCount() const;
+
+	// First and last frame times of a clip, false if it has no frames
+	bool GetClipTimeRange(int clip_index, int& start_time_out, int& end_time_out) const;
+
+	// Writes the points of the clip at time_in to points_out as GetPointCount() x, y pairs.
+	// Times outside the clip clamp to its first or last frame.
+	bool Sample(int clip_index, float time_in, float * points_out) const;
+
+private:
+	const CreatureFlatData::bakedAnimation * baked_data;
+	int point_count;
+};
@@ -0,0 +1,122 @@
+#include <algorithm>
+#include <FlatDataBatchUpdate.h>
+
+// ----------- Batch Output ----------------------
+
+FlatDataBatchOutput::FlatDataBatchOutput()
+	: instance_count(0),
+	bone_stride(0),
+	point_stride(0)
+{
+}
+
+void
+FlatDataBatchOutput::Init(const CreatureFlatData::rootData * root_in, size_t instance_count_in, bool skin_points)
+{
+	auto skeleton_data = root_in->dataSkeleton();
+	auto mesh_data = root_in->dataMesh();
+	size_t bone_count = (skeleton_data && skeleton_data->bones()) ? skeleton_data->bones()->size() : 0;
+	size_t point_count = (mesh_data && mesh_data->points()) ? mesh_data->points()->size() / 2 : 0;
+
+	instance_count = instance_count_in;
+	bone_stride = bone_count * 4;
+	point_stride = skin_points ? point_count * 2 : 0;
+	bone_positions.assign(instance_count * bone_stride, 0.0f);
+	points.assign(instance_count * point_stride, 0.0f);
+}
+
+// ----------- Batch Updater ----------------------
+
+FlatDataBatchUpdater::FlatDataBatchUpdater(const CreatureFlatData::rootData * root_in,
+	int thread_count, int instances_per_task_in)
+	: root_data(root_in),
+	sampler(root_in),
+	has_skin_mesh(false),
+	instances_per_task((size_t)std::max(instances_per_task_in, 1)),
+	pose_cache(nullptr),
+	update_pool(thread_count)
+{
+	has_skin_mesh = skin_mesh.Init(root_in);
+}
+
+void
+FlatDataBatchUpdater::SetPoseCache(FlatDataPoseCache * cache_in)
+{
+	pose_cache = cache_in;
+}
+
+int
+FlatDataBatchUpdater::GetThreadCount() const
+{
+	return update_pool.GetThreadCount();
+}
+
+void
+FlatDataBatchUpdater::UpdateRange(const FlatDataInstance * instances_in, size_t start_index, size_t end_index,
+	FlatDataPose& pose_io, FlatDataBatchOutput& output_io, FlatDataSkinKernel kernel_in) const
+{
+	bool skin_points = has_skin_mesh && (output_io.point_stride > 0);
+	bool use_cache = pose_cache && (!skin_points || pose_cache->IsSkinning());
+	for (size_t i = start_index; i < end_index; i++)
+	{
+		if (use_cache)
+		{
+			auto cached_pose = pose_cache->Get(instances_in[i].clip_index, instances_in[i].time);
+			if (cached_pose)
+			{
+				std::copy(cached_pose->bone_positions.begin(), cached_pose->bone_positions.end(),
+					output_io.bone_positions.begin() + i * output_io.bone_stride);
+				if (skin_points)
+				{
+					std::copy(cached_pose->points.begin(), cached_pose->points.end(),
+						output_io.points.begin() + i * output_io.point_stride);
+				}
+
+				continue;
+			}
+		}
+
+		// Bones a clip does not animate would otherwise keep the previous instance's values
+		std::fill(pose_io.bone_positions.begin(), pose_io.bone_positions.end(), 0.0f);
+		sampler.Sample(instances_in[i].clip_index, instances_in[i].time, pose_io);
+
+		std::copy(pose_io.bone_positions.begin(), pose_io.bone_positions.end(),
+			output_io.bone_positions.begin() + i * output_io.bone_stride);
+
+		if (skin_points)
+		{
+			skin_mesh.Skin(pose_io, output_io.points.data() + i * output_io.point_stride, kernel_in);
+		}
+	}
+}
+
+bool
+FlatDataBatchUpdater::Update(const FlatDataInstance * instances_in, size_t instance_count,
+	FlatDataBatchOutput& output_io, FlatDataSkinKernel kernel_in)
+{
+	if ((instance_count > output_io.instance_count)
+		|| (output_io.bone_positions.size() != output_io.instance_count * output_io.bone_stride))
+	{
+		return false;
+	}
+
+	size_t task_count = (instance_count + instances_per_task - 1) / instances_per_task;
+	while (task_poses.size() < task_count)
+	{
+		task_poses.push_back(FlatDataPose());
+		task_poses.back().Init(root_data);
+	}
+
+	for (size_t t = 0; t < task_count; t++)
+	{
+		size_t start_index = t * instances_per_task;
+		size_t end_index = std::min(start_index + instances_per_task, instance_count);
+		FlatDataPose * task_pose = &task_poses[t];
+		update_pool.Submit([this, instances_in, start_index, end_index, task_pose, &output_io, kernel_in]() {
+			UpdateRange(instances_in, start_index, end_index, *task_pose, output_io, kernel_in);
+		});
+	}
+
+	update_pool.Wait();
+	return true;
+}
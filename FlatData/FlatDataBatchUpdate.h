@@ -0,0 +1,69 @@
+#pragma once
+
+#include <vector>
+#include <CreatureFlatData_generated.h>
+#include <FlatDataPose.h>
+#include <FlatDataSkinning.h>
+#include <FlatDataPoseCache.h>
+#include <WorkStealingPool.h>
+
+// One character of a batch, playing clip_index at time
+struct FlatDataInstance
+{
+	int clip_index;
+	float time;
+};
+
+// Results of a batch as structure of arrays: instance i's bone positions start at
+// bone_positions[i * bone_stride] and its skinned points at points[i * point_stride],
+// laid out as in FlatDataPose::bone_positions and FlatDataSkinMesh::Skin
+struct FlatDataBatchOutput
+{
+	FlatDataBatchOutput();
+
+	// Sizes the buffers for instance_count characters of root_in, leaving points
+	// empty when skin_points is false
+	void Init(const CreatureFlatData::rootData * root_in, size_t instance_count_in, bool skin_points);
+
+	size_t instance_count, bone_stride, point_stride;
+	std::vector<float> bone_positions;
+	std::vector<float> points;
+};
+
+// Updates many characters sharing one rootData per call. Instances are split into
+// tasks of instances_per_task for a WorkStealingPool, each task sampling and skinning
+// its run of instances through a pose of its own. Task poses are kept between updates,
+// growing only when a batch needs more tasks than any before it.
+class FlatDataBatchUpdater
+{
+public:
+	// A thread_count of 0 uses one thread per hardware core
+	FlatDataBatchUpdater(const CreatureFlatData::rootData * root_in,
+		int thread_count = 0, int instances_per_task_in = 64);
+
+	// Samples every instance into output_io, and skins it when output_io has points.
+	// output_io must have been Init for this rootData and at least instance_count instances.
+	bool Update(const FlatDataInstance * instances_in, size_t instance_count,
+		FlatDataBatchOutput& output_io, FlatDataSkinKernel kernel_in = GetBestSkinKernel());
+
+	// Reads instances through cache_in, which must be for the same rootData, so instances
+	// at the same clip and quantized time share one evaluation. Instance times snap to the
+	// cache's steps. Skinned outputs need a skinning cache. Null stops using a cache.
+	void SetPoseCache(FlatDataPoseCache * cache_in);
+
+	int GetThreadCount() const;
+
+private:
+	void UpdateRange(const FlatDataInstance * instances_in, size_t start_index, size_t end_index,
+		FlatDataPose& pose_io, FlatDataBatchOutput& output_io, FlatDataSkinKernel kernel_in) const;
+
+	const CreatureFlatData::rootData * root_data;
+	FlatDataPoseSampler sampler;
+	FlatDataSkinMesh skin_mesh;
+	bool has_skin_mesh;
+	size_t instances_per_task;
+	FlatDataPoseCache * pose_cache;
+
+	std::vector<FlatDataPose> task_poses;
+	WorkStealingPool update_pool;
+};
@@ -0,0 +1,477 @@
+#include <iostream>
+#include <cstring>
+#include <algorithm>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include <FlatDataClipLoader.h>
+#include <FlatDataLookup.h>
+#include <FlatDataCompress.h>
+
+// Verification limits, as FlatDataLoader's
+static const size_t verify_max_depth = 64;
+static const size_t verify_max_tables = (size_t)1 << 30;
+
+// "CRFC" and the uint32 size of the directory
+static const size_t container_header_size = 8;
+
+FlatDataClipLoader::FlatDataClipLoader()
+	: file_size(0),
+	verify(false),
+	map_granularity(4096),
+#ifdef _WIN32
+	file_handle(nullptr),
+	mapping_handle(nullptr),
+#else
+	file_fd(-1),
+#endif
+	directory(nullptr),
+	resident_size(0),
+	resident_limit(0)
+{
+	base_chunk.map_data = nullptr;
+	base_chunk.map_size = 0;
+	base_chunk.data = nullptr;
+	base_chunk.size = 0;
+}
+
+FlatDataClipLoader::~FlatDataClipLoader()
+{
+	Close();
+}
+
+bool
+FlatDataClipLoader::Open(const std::string& filename_in, bool verify_in)
+{
+	Close();
+
+	uint8_t header[container_header_size];
+#ifdef _WIN32
+	SYSTEM_INFO system_info;
+	GetSystemInfo(&system_info);
+	map_granularity = (size_t)system_info.dwAllocationGranularity;
+
+	HANDLE read_file = CreateFileA(filename_in.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	LARGE_INTEGER read_size;
+	if ((read_file == INVALID_HANDLE_VALUE) || !GetFileSizeEx(read_file, &read_size))
+	{
+		std::cerr << "Error: Could not read Flat Binary Container: " << filename_in << std::endl;
+		if (read_file != INVALID_HANDLE_VALUE)
+		{
+			CloseHandle(read_file);
+		}
+
+		return false;
+	}
+
+	file_handle = read_file;
+	file_size = (size_t)read_size.QuadPart;
+
+#else
+	map_granularity = (size_t)sysconf(_SC_PAGESIZE);
+
+	file_fd = open(filename_in.c_str(), O_RDONLY);
+	struct stat file_stat;
+	if ((file_fd < 0) || (fstat(file_fd, &file_stat) != 0))
+	{
+		std::cerr << "Error: Could not read Flat Binary Container: " << filename_in << std::endl;
+		Close();
+		return false;
+	}
+
+	file_size = (size_t)file_stat.st_size;
+#endif
+
+	bool header_ok = (file_size > container_header_size) && ReadFileAt(0, header, container_header_size);
+
+	size_t directory_size = header_ok ? (size_t)flatbuffers::ReadScalar<uint32_t>(header + 4) : 0;
+	if (!header_ok || (memcmp(header, "CRFC", 4) != 0)
+		|| (directory_size == 0) || (directory_size > file_size - container_header_size))
+	{
+		std::cerr << "Error: Invalid Flat Binary Container: " << filename_in << std::endl;
+		Close();
+		return false;
+	}
+
+	directory_buffer.resize(directory_size);
+	header_ok = ReadFileAt(container_header_size, directory_buffer.data(), directory_size);
+
+	// The directory is small and read by every lookup, so it is always verified
+	flatbuffers::Verifier verifier(directory_buffer.data(), directory_size, verify_max_depth, verify_max_tables);
+	if (!header_ok || !verifier.VerifyBuffer<CreatureFlatData::clipDirectory>())
+	{
+		std::cerr << "Error: Invalid Flat Binary Container: " << filename_in << std::endl;
+		Close();
+		return false;
+	}
+
+	directory = flatbuffers::GetRoot<CreatureFlatData::clipDirectory>(directory_buffer.data());
+
+#ifdef _WIN32
+	mapping_handle = CreateFileMappingA((HANDLE)file_handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (!mapping_handle)
+	{
+		std::cerr << "Error: Could not map Flat Binary Container: " << filename_in << std::endl;
+		Close();
+		return false;
+	}
+#endif
+
+	filename = filename_in;
+	verify = verify_in;
+	if (!MapChunk(directory->base(), base_chunk))
+	{
+		Close();
+		return false;
+	}
+
+	size_t clip_count = directory->clips() ? directory->clips()->size() : 0;
+	clip_chunks.resize(clip_count);
+	for (auto& cur_chunk : clip_chunks)
+	{
+		cur_chunk.map_data = nullptr;
+		cur_chunk.map_size = 0;
+		cur_chunk.data = nullptr;
+		cur_chunk.size = 0;
+	}
+
+	loaded_places.assign(clip_count, loaded_order.end());
+	return true;
+}
+
+void
+FlatDataClipLoader::Close()
+{
+	EvictAllClips();
+	UnmapChunk(base_chunk);
+	clip_chunks.clear();
+	loaded_places.clear();
+	directory_buffer.clear();
+	directory = nullptr;
+	file_size = 0;
+
+#ifdef _WIN32
+	if (mapping_handle)
+	{
+		CloseHandle((HANDLE)mapping_handle);
+		mapping_handle = nullptr;
+	}
+
+	if (file_handle)
+	{
+		CloseHandle((HANDLE)file_handle);
+		file_handle = nullptr;
+	}
+#else
+	if (file_fd >= 0)
+	{
+		close(file_fd);
+		file_fd = -1;
+	}
+#endif
+}
+
+bool
+FlatDataClipLoader::IsOpen() const
+{
+	return base_chunk.data != nullptr;
+}
+
+const CreatureFlatData::rootData *
+FlatDataClipLoader::GetRootData() const
+{
+	return base_chunk.data ? CreatureFlatData::GetrootData(base_chunk.data) : nullptr;
+}
+
+int
+FlatDataClipLoader::GetClipCount() const
+{
+	return (int)clip_chunks.size();
+}
+
+const char *
+FlatDataClipLoader::GetClipName(int clip_index) const
+{
+	if ((clip_index < 0) || (clip_index >= GetClipCount()))
+	{
+		return nullptr;
+	}
+
+	auto cur_name = directory->clips()->Get(clip_index)->name();
+	return cur_name ? cur_name->c_str() : nullptr;
+}
+
+int
+FlatDataClipLoader::FindClipIndex(const char * name_in) const
+{
+	return directory ? FindSortedName(directory->clips(), directory->clips_by_name(), name_in,
+		[](const CreatureFlatData::clipChunk * chunk) { return chunk->name(); }) : -1;
+}
+
+const CreatureFlatData::animationClip *
+FlatDataClipLoader::GetClip(int clip_index)
+{
+	if ((clip_index < 0) || (clip_index >= GetClipCount()))
+	{
+		return nullptr;
+	}
+
+	MappedChunk& cur_chunk = clip_chunks[clip_index];
+	if (cur_chunk.data)
+	{
+		loaded_order.splice(loaded_order.begin(), loaded_order, loaded_places[clip_index]);
+	}
+	else
+	{
+		auto dir_chunk = directory->clips()->Get(clip_index);
+		if (resident_limit > 0)
+		{
+			while (!loaded_order.empty() && (resident_size + dir_chunk->size() > resident_limit))
+			{
+				EvictClip(loaded_order.back());
+			}
+		}
+
+		if (!MapChunk(dir_chunk, cur_chunk))
+		{
+			return nullptr;
+		}
+
+		loaded_order.push_front(clip_index);
+		loaded_places[clip_index] = loaded_order.begin();
+		resident_size += cur_chunk.size;
+	}
+
+	// A clip chunk holds an animation of just its clip
+	auto animation_data = CreatureFlatData::GetrootData(cur_chunk.data)->dataAnimation();
+	if (!animation_data || !animation_data->clips() || (animation_data->clips()->size() != 1))
+	{
+		return nullptr;
+	}
+
+	return animation_data->clips()->Get(0);
+}
+
+const CreatureFlatData::animationClip *
+FlatDataClipLoader::GetClip(const char * name_in)
+{
+	return GetClip(FindClipIndex(name_in));
+}
+
+bool
+FlatDataClipLoader::IsClipLoaded(int clip_index) const
+{
+	return (clip_index >= 0) && (clip_index < GetClipCount()) && (clip_chunks[clip_index].data != nullptr);
+}
+
+void
+FlatDataClipLoader::EvictClip(int clip_index)
+{
+	if (!IsClipLoaded(clip_index))
+	{
+		return;
+	}
+
+	resident_size -= clip_chunks[clip_index].size;
+	UnmapChunk(clip_chunks[clip_index]);
+	loaded_order.erase(loaded_places[clip_index]);
+	loaded_places[clip_index] = loaded_order.end();
+}
+
+void
+FlatDataClipLoader::EvictAllClips()
+{
+	while (!loaded_order.empty())
+	{
+		EvictClip(loaded_order.back());
+	}
+}
+
+void
+FlatDataClipLoader::SetResidentLimit(size_t limit_in)
+{
+	resident_limit = limit_in;
+	while ((resident_limit > 0) && !loaded_order.empty() && (resident_size > resident_limit))
+	{
+		EvictClip(loaded_order.back());
+	}
+}
+
+size_t
+FlatDataClipLoader::GetResidentSize() const
+{
+	return resident_size;
+}
+
+bool
+FlatDataClipLoader::MapChunk(const CreatureFlatData::clipChunk * chunk_in, MappedChunk& chunk_out) const
+{
+	size_t chunk_offset = chunk_in ? (size_t)chunk_in->offset() : 0;
+	size_t chunk_size = chunk_in ? (size_t)chunk_in->size() : 0;
+	size_t stored_size = (chunk_in && (chunk_in->compressed_size() > 0)) ? (size_t)chunk_in->compressed_size() : chunk_size;
+	if (!chunk_in || (chunk_size == 0) || (chunk_offset > file_size) || (stored_size > file_size - chunk_offset))
+	{
+		std::cerr << "Error: Invalid chunk in Flat Binary Container: " << filename << std::endl;
+		return false;
+	}
+
+	if (chunk_in->compressed_size() > 0)
+	{
+		if (!DecompressChunk(chunk_in, chunk_out))
+		{
+			std::cerr << "Error: Invalid compressed chunk in Flat Binary Container: " << filename << std::endl;
+			UnmapChunk(chunk_out);
+			return false;
+		}
+	}
+	else
+	{
+		// Mappings start on the granularity, so the chunk sits that far into its mapping
+		size_t map_offset = chunk_offset - chunk_offset % map_granularity;
+		size_t map_size = chunk_size + (chunk_offset - map_offset);
+#ifdef _WIN32
+		void * map_data = MapViewOfFile((HANDLE)mapping_handle, FILE_MAP_READ,
+			(DWORD)((uint64_t)map_offset >> 32), (DWORD)(map_offset & 0xffffffff), map_size);
+		if (!map_data)
+#else
+		void * map_data = mmap(nullptr, map_size, PROT_READ, MAP_SHARED, file_fd, (off_t)map_offset);
+		if (map_data == MAP_FAILED)
+#endif
+		{
+			std::cerr << "Error: Could not map Flat Binary Container: " << filename << std::endl;
+			return false;
+		}
+
+		chunk_out.map_data = map_data;
+		chunk_out.map_size = map_size;
+		chunk_out.data = (const uint8_t *)map_data + (chunk_offset - map_offset);
+		chunk_out.size = chunk_size;
+	}
+
+	if (verify)
+	{
+		flatbuffers::Verifier verifier(chunk_out.data, chunk_size, verify_max_depth, verify_max_tables);
+		if (!CreatureFlatData::VerifyrootDataBuffer(verifier))
+		{
+			std::cerr << "Error: Invalid chunk in Flat Binary Container: " << filename << std::endl;
+			UnmapChunk(chunk_out);
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool
+FlatDataClipLoader::DecompressChunk(const CreatureFlatData::clipChunk * chunk_in, MappedChunk& chunk_out) const
+{
+	// Decompressed straight into the buffer the clip is read from, 8 byte aligned for its tables
+	size_t chunk_size = (size_t)chunk_in->size();
+	chunk_out.heap_data.assign((chunk_size + sizeof(uint64_t) - 1) / sizeof(uint64_t), 0);
+	uint8_t * write_data = (uint8_t *)chunk_out.heap_data.data();
+	chunk_out.data = write_data;
+	chunk_out.size = chunk_size;
+
+	std::vector<uint8_t> block_data;
+	size_t read_pos = (size_t)chunk_in->offset();
+	size_t read_end = read_pos + (size_t)chunk_in->compressed_size();
+	for (size_t write_pos = 0; write_pos < chunk_size; write_pos += flatdata_compress_block_size)
+	{
+		uint8_t block_header[flatdata_compress_header_size];
+		size_t block_size;
+		bool is_stored;
+		if ((read_end - read_pos < flatdata_compress_header_size)
+			|| !ReadFileAt(read_pos, block_header, flatdata_compress_header_size))
+		{
+			return false;
+		}
+
+		ReadFlatDataBlockHeader(block_header, block_size, is_stored);
+		read_pos += flatdata_compress_header_size;
+		size_t write_size = std::min(flatdata_compress_block_size, chunk_size - write_pos);
+		if (block_size > read_end - read_pos)
+		{
+			return false;
+		}
+
+		// Stored blocks are read in place, the rest through one block of read buffer
+		if (is_stored)
+		{
+			if ((block_size != write_size) || !ReadFileAt(read_pos, write_data + write_pos, write_size))
+			{
+				return false;
+			}
+		}
+		else
+		{
+			block_data.resize(block_size);
+			if (!ReadFileAt(read_pos, block_data.data(), block_size)
+				|| !DecompressFlatDataBlock(block_data.data(), block_size, false, write_data + write_pos, write_size))
+			{
+				return false;
+			}
+		}
+
+		read_pos += block_size;
+	}
+
+	return read_pos == read_end;
+}
+
+void
+FlatDataClipLoader::UnmapChunk(MappedChunk& chunk_io) const
+{
+	std::vector<uint64_t>().swap(chunk_io.heap_data);
+	if (!chunk_io.map_data)
+	{
+		chunk_io.data = nullptr;
+		chunk_io.size = 0;
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(chunk_io.map_data);
+#else
+	munmap(chunk_io.map_data, chunk_io.map_size);
+#endif
+
+	chunk_io.map_data = nullptr;
+	chunk_io.map_size = 0;
+	chunk_io.data = nullptr;
+	chunk_io.size = 0;
+}
+
+bool
+FlatDataClipLoader::ReadFileAt(size_t offset_in, void * data_out, size_t size_in) const
+{
+#ifdef _WIN32
+	OVERLAPPED read_at = {};
+	read_at.Offset = (DWORD)(offset_in & 0xffffffff);
+	read_at.OffsetHigh = (DWORD)((uint64_t)offset_in >> 32);
+	DWORD read_count = 0;
+	return ReadFile((HANDLE)file_handle, data_out, (DWORD)size_in, &read_count, &read_at)
+		&& (read_count == (DWORD)size_in);
+#else
+	uint8_t * write_data = (uint8_t *)data_out;
+	while (size_in > 0)
+	{
+		ssize_t read_count = pread(file_fd, write_data, size_in, (off_t)offset_in);
+		if (read_count <= 0)
+		{
+			return false;
+		}
+
+		write_data += read_count;
+		offset_in += (size_t)read_count;
+		size_in -= (size_t)read_count;
+	}
+
+	return true;
+#endif
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <list>
+#include <cstddef>
+#include <cstdint>
+#include <CreatureFlatData_generated.h>
+
+// Opens a clip container written by the converter's -split mode and maps its chunks
+// read only on demand, or decompresses them to the heap if they were written with
+// -compress. Open reads the directory and maps the base chunk with the mesh and
+// skeleton. A clip's chunk is mapped the first time GetClip asks for it and stays
+// mapped until it is evicted, explicitly or by the resident limit.
+// Loading and evicting are not thread safe, but the tables of loaded clips can be
+// sampled from many threads, with FlatDataPoseSampler over GetRootData.
+class FlatDataClipLoader
+{
+public:
+	FlatDataClipLoader();
+
+	// Unmaps every chunk and closes the file
+	~FlatDataClipLoader();
+
+	// Opens filename_in, closing any file already open. If verify_in is true the base
+	// chunk and every clip chunk as it is loaded are checked with VerifyrootDataBuffer.
+	bool Open(const std::string& filename_in, bool verify_in = false);
+
+	void Close();
+
+	bool IsOpen() const;
+
+	// rootData of the base chunk, without dataAnimation
+	const CreatureFlatData::rootData * GetRootData() const;
+
+	int GetClipCount() const;
+
+	const char * GetClipName(int clip_index) const;
+
+	// Index of the clip named name_in by binary search of the directory, or -1
+	int FindClipIndex(const char * name_in) const;
+
+	// Returns the clip, mapping its chunk first if it is not loaded, or nullptr if it
+	// can not be loaded. The clip stays valid until it is evicted or the file is closed.
+	const CreatureFlatData::animationClip * GetClip(int clip_index);
+
+	const CreatureFlatData::animationClip * GetClip(const char * name_in);
+
+	bool IsClipLoaded(int clip_index) const;
+
+	// Unmaps a clip, invalidating the tables GetClip returned for it
+	void EvictClip(int clip_index);
+
+	void EvictAllClips();
+
+	// If limit_in is not 0, evicts the least recently asked for clips until the mapped
+	// clip chunks fit in limit_in bytes, and from then on before loading each clip
+	void SetResidentLimit(size_t limit_in);
+
+	// Bytes of clip chunks mapped or decompressed
+	size_t GetResidentSize() const;
+
+private:
+	// Not copyable, the mappings are owned by one loader
+	FlatDataClipLoader(const FlatDataClipLoader&);
+	FlatDataClipLoader& operator=(const FlatDataClipLoader&);
+
+	// A chunk mapped from the file, data pointing into the mapping at the chunk's offset,
+	// or for a compressed chunk into heap_data it was decompressed to
+	struct MappedChunk
+	{
+		void * map_data;
+		size_t map_size;
+		const uint8_t * data;
+		size_t size;
+		std::vector<uint64_t> heap_data;
+	};
+
+	// Maps the pages holding chunk_in, or decompresses it if it is compressed, failing
+	// if it lies outside the file or, when verifying, does not hold a valid rootData
+	bool MapChunk(const CreatureFlatData::clipChunk * chunk_in, MappedChunk& chunk_out) const;
+
+	// Reads a compressed chunk a block at a time, decompressing each into chunk_out
+	bool DecompressChunk(const CreatureFlatData::clipChunk * chunk_in, MappedChunk& chunk_out) const;
+
+	void UnmapChunk(MappedChunk& chunk_io) const;
+
+	// Reads size_in bytes at offset_in of the file
+	bool ReadFileAt(size_t offset_in, void * data_out, size_t size_in) const;
+
+	std::string filename;
+	size_t file_size;
+	bool verify;
+	size_t map_granularity;
+#ifdef _WIN32
+	void * file_handle;
+	void * mapping_handle;
+#else
+	int file_fd;
+#endif
+
+	// The clipDirectory buffer, read into the heap since it is small and always needed
+	std::vector<uint8_t> directory_buffer;
+	const CreatureFlatData::clipDirectory * directory;
+
+	MappedChunk base_chunk;
+	std::vector<MappedChunk> clip_chunks;
+
+	// Loaded clip indices, most recently used first, and each clip's place in it
+	std::list<int> loaded_order;
+	std::vector<std::list<int>::iterator> loaded_places;
+	size_t resident_size, resident_limit;
+};
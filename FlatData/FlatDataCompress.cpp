@@ -0,0 +1,283 @@
+#include <cstring>
+#include <algorithm>
+#include <FlatDataCompress.h>
+
+// Matches are at least this long, and the last bytes of a block are always literals
+static const size_t compress_min_match = 4;
+static const size_t compress_last_literals = 5;
+
+// Hash table of recent positions, indexed by the hash of 4 bytes
+static const int compress_hash_bits = 13;
+
+// Literals scanned without a match before the compressor starts skipping ahead
+static const int compress_skip_shift = 6;
+
+static inline uint32_t
+Read32(const uint8_t * data_in)
+{
+	uint32_t value;
+	memcpy(&value, data_in, sizeof(value));
+	return value;
+}
+
+static inline uint32_t
+HashPosition(uint32_t value_in)
+{
+	return (value_in * 2654435761u) >> (32 - compress_hash_bits);
+}
+
+// Writes the extension bytes of a token length of 15 or more
+static inline void
+WriteLength(std::vector<uint8_t>& data_io, size_t length_in)
+{
+	for (; length_in >= 255; length_in -= 255)
+	{
+		data_io.push_back(255);
+	}
+
+	data_io.push_back((uint8_t)length_in);
+}
+
+static void
+WriteSequence(std::vector<uint8_t>& data_io, const uint8_t * literals_in, size_t literal_count,
+	size_t match_offset, size_t match_length)
+{
+	size_t match_code = (match_length > 0) ? match_length - compress_min_match : 0;
+	data_io.push_back((uint8_t)((std::min(literal_count, (size_t)15) << 4) | std::min(match_code, (size_t)15)));
+	if (literal_count >= 15)
+	{
+		WriteLength(data_io, literal_count - 15);
+	}
+
+	data_io.insert(data_io.end(), literals_in, literals_in + literal_count);
+	if (match_length == 0)
+	{
+		return;
+	}
+
+	data_io.push_back((uint8_t)(match_offset & 0xff));
+	data_io.push_back((uint8_t)(match_offset >> 8));
+	if (match_code >= 15)
+	{
+		WriteLength(data_io, match_code - 15);
+	}
+}
+
+// Greedy single pass match finder over one block, which fits the 16 bit offsets
+static void
+CompressBlock(const uint8_t * data_in, size_t size_in, std::vector<uint8_t>& data_io)
+{
+	size_t anchor = 0;
+	if (size_in > compress_min_match + compress_last_literals)
+	{
+		// Positions are stored plus one, so 0 is an empty entry
+		std::vector<uint32_t> hash_table((size_t)1 << compress_hash_bits, 0);
+		size_t match_limit = size_in - compress_last_literals;
+		size_t pos = 0;
+		while (pos + compress_min_match <= match_limit)
+		{
+			uint32_t cur_value = Read32(data_in + pos);
+			uint32_t& cur_entry = hash_table[HashPosition(cur_value)];
+			size_t candidate = (size_t)cur_entry;
+			cur_entry = (uint32_t)(pos + 1);
+
+			if ((candidate == 0) || (pos - (candidate - 1) > 0xffff) || (Read32(data_in + candidate - 1) != cur_value))
+			{
+				pos += 1 + ((pos - anchor) >> compress_skip_shift);
+				continue;
+			}
+
+			size_t match_pos = candidate - 1;
+			size_t match_length = compress_min_match;
+			while ((pos + match_length < match_limit) && (data_in[match_pos + match_length] == data_in[pos + match_length]))
+			{
+				match_length++;
+			}
+
+			while ((pos > anchor) && (match_pos > 0) && (data_in[pos - 1] == data_in[match_pos - 1]))
+			{
+				pos--;
+				match_pos--;
+				match_length++;
+			}
+
+			WriteSequence(data_io, data_in + anchor, pos - anchor, pos - match_pos, match_length);
+			pos += match_length;
+			anchor = pos;
+
+			if (pos >= 2)
+			{
+				hash_table[HashPosition(Read32(data_in + pos - 2))] = (uint32_t)(pos - 2 + 1);
+			}
+		}
+	}
+
+	WriteSequence(data_io, data_in + anchor, size_in - anchor, 0, 0);
+}
+
+std::vector<uint8_t>
+CompressFlatDataBlocks(const uint8_t * data_in, size_t size_in)
+{
+	std::vector<uint8_t> compressed_data;
+	compressed_data.reserve(size_in / 2 + flatdata_compress_header_size);
+	for (size_t block_start = 0; block_start < size_in; block_start += flatdata_compress_block_size)
+	{
+		size_t block_size = std::min(flatdata_compress_block_size, size_in - block_start);
+		size_t header_pos = compressed_data.size();
+		compressed_data.resize(header_pos + flatdata_compress_header_size);
+		CompressBlock(data_in + block_start, block_size, compressed_data);
+
+		// Blocks that do not shrink are stored instead
+		uint32_t header = (uint32_t)(compressed_data.size() - header_pos - flatdata_compress_header_size);
+		if (header >= block_size)
+		{
+			compressed_data.resize(header_pos + flatdata_compress_header_size);
+			compressed_data.insert(compressed_data.end(), data_in + block_start, data_in + block_start + block_size);
+			header = (uint32_t)block_size | 0x80000000;
+		}
+
+		for (size_t i = 0; i < flatdata_compress_header_size; i++)
+		{
+			compressed_data[header_pos + i] = (uint8_t)(header >> (i * 8));
+		}
+	}
+
+	return compressed_data;
+}
+
+// Reads the extension bytes of a token length of 15, false if they run past read_end
+static inline bool
+ReadLength(const uint8_t *& read_io, const uint8_t * read_end, size_t& length_io)
+{
+	uint8_t cur_byte;
+	do
+	{
+		if (read_io >= read_end)
+		{
+			return false;
+		}
+
+		cur_byte = *read_io++;
+		length_io += cur_byte;
+	} while (cur_byte == 255);
+
+	return true;
+}
+
+bool
+DecompressFlatDataBlock(const uint8_t * block_in, size_t block_size, bool is_stored,
+	uint8_t * data_out, size_t data_size)
+{
+	if (is_stored)
+	{
+		if (block_size != data_size)
+		{
+			return false;
+		}
+
+		memcpy(data_out, block_in, data_size);
+		return true;
+	}
+
+	const uint8_t * read_ptr = block_in;
+	const uint8_t * read_end = block_in + block_size;
+	uint8_t * write_ptr = data_out;
+	uint8_t * write_end = data_out + data_size;
+	while (read_ptr < read_end)
+	{
+		uint8_t token = *read_ptr++;
+		size_t literal_count = token >> 4;
+		if ((literal_count == 15) && !ReadLength(read_ptr, read_end, literal_count))
+		{
+			return false;
+		}
+
+		if ((literal_count > (size_t)(read_end - read_ptr)) || (literal_count > (size_t)(write_end - write_ptr)))
+		{
+			return false;
+		}
+
+		memcpy(write_ptr, read_ptr, literal_count);
+		write_ptr += literal_count;
+		read_ptr += literal_count;
+
+		// The last sequence ends the block after its literals
+		if (read_ptr == read_end)
+		{
+			break;
+		}
+
+		if (read_end - read_ptr < 2)
+		{
+			return false;
+		}
+
+		size_t match_offset = (size_t)read_ptr[0] | ((size_t)read_ptr[1] << 8);
+		read_ptr += 2;
+		size_t match_length = token & 15;
+		if ((match_length == 15) && !ReadLength(read_ptr, read_end, match_length))
+		{
+			return false;
+		}
+
+		match_length += compress_min_match;
+		if ((match_offset == 0) || (match_offset > (size_t)(write_ptr - data_out))
+			|| (match_length > (size_t)(write_end - write_ptr)))
+		{
+			return false;
+		}
+
+		// Matches far enough back copy 8 bytes at a time when there is room to overrun,
+		// closer ones overlap what they write and go a byte at a time
+		const uint8_t * match_ptr = write_ptr - match_offset;
+		uint8_t * match_end = write_ptr + match_length;
+		if ((match_offset >= 8) && ((size_t)(write_end - match_end) >= 8))
+		{
+			for (; write_ptr < match_end; write_ptr += 8, match_ptr += 8)
+			{
+				memcpy(write_ptr, match_ptr, 8);
+			}
+
+			write_ptr = match_end;
+		}
+		else
+		{
+			while (write_ptr < match_end)
+			{
+				*write_ptr++ = *match_ptr++;
+			}
+		}
+	}
+
+	return write_ptr == write_end;
+}
+
+bool
+DecompressFlatDataBlocks(const uint8_t * compressed_in, size_t compressed_size,
+	uint8_t * data_out, size_t data_size)
+{
+	size_t read_pos = 0, write_pos = 0;
+	while (write_pos < data_size)
+	{
+		size_t block_size;
+		bool is_stored;
+		if (compressed_size - read_pos < flatdata_compress_header_size)
+		{
+			return false;
+		}
+
+		ReadFlatDataBlockHeader(compressed_in + read_pos, block_size, is_stored);
+		read_pos += flatdata_compress_header_size;
+		size_t write_size = std::min(flatdata_compress_block_size, data_size - write_pos);
+		if ((block_size > compressed_size - read_pos)
+			|| !DecompressFlatDataBlock(compressed_in + read_pos, block_size, is_stored, data_out + write_pos, write_size))
+		{
+			return false;
+		}
+
+		read_pos += block_size;
+		write_pos += write_size;
+	}
+
+	return read_pos == compressed_size;
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+// Block LZ codec for the clip chunks of a Creature FlatData clip container.
+// Data is cut into blocks of flatdata_compress_block_size bytes, the last one shorter,
+// each compressed on its own so a chunk can be decompressed a block at a time as it is
+// read. A compressed block is a uint32 header, its byte count with the top bit set if
+// the bytes are stored as is, followed by those bytes.
+// Inside a block the format is LZ4 style sequences: a token byte holding the literal
+// count in its high 4 bits and the match length less 4 in its low 4 bits, a value of
+// 15 continuing in further bytes added until one is below 255. Then the literals, a
+// uint16 little endian offset back to the match and the match length bytes. The last
+// sequence of a block has only literals.
+
+static const size_t flatdata_compress_block_size = 65536;
+
+// Size of a compressed block header
+static const size_t flatdata_compress_header_size = 4;
+
+// Compresses size_in bytes of data_in into blocks
+std::vector<uint8_t> CompressFlatDataBlocks(const uint8_t * data_in, size_t size_in);
+
+// Decompresses the contents of one block, block_size bytes after its header, into
+// exactly data_size bytes of data_out. Stored blocks are copied. Returns false if the
+// block is corrupt, without reading or writing outside the buffers.
+bool DecompressFlatDataBlock(const uint8_t * block_in, size_t block_size, bool is_stored,
+	uint8_t * data_out, size_t data_size);
+
+// Decompresses every block of compressed_in into exactly data_size bytes of data_out
+bool DecompressFlatDataBlocks(const uint8_t * compressed_in, size_t compressed_size,
+	uint8_t * data_out, size_t data_size);
+
+// Reads a block header into its byte count and stored flag
+inline void
+ReadFlatDataBlockHeader(const uint8_t * header_in, size_t& block_size_out, bool& is_stored_out)
+{
+	uint32_t header = (uint32_t)header_in[0] | ((uint32_t)header_in[1] << 8)
+		| ((uint32_t)header_in[2] << 16) | ((uint32_t)header_in[3] << 24);
+	block_size_out = (size_t)(header & 0x7fffffff);
+	is_stored_out = (header & 0x80000000) != 0;
+}
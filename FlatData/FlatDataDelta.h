@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstring>
+#include <cstddef>
+#include <cstdint>
+
+// Delta coding of consecutive keyframe rows, written by the converter's -delta mode.
+// Every delta_interval-th row from the first is a key row stored as is, every other
+// row its delta from the row before: the XOR of the bits for floats, the difference
+// modulo 2^16 for quantized values. Neighbouring frames differ little, so the deltas
+// are mostly zero high bytes and compress far better than the absolute rows.
+// Rebuilding a row reads at most delta_interval rows back to its key.
+
+inline void
+MakeDelta(float * row_io, const float * prev_row_in, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		uint32_t cur_bits, prev_bits;
+		memcpy(&cur_bits, row_io + i, sizeof(cur_bits));
+		memcpy(&prev_bits, prev_row_in + i, sizeof(prev_bits));
+		cur_bits ^= prev_bits;
+		memcpy(row_io + i, &cur_bits, sizeof(cur_bits));
+	}
+}
+
+inline void
+MakeDelta(uint16_t * row_io, const uint16_t * prev_row_in, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		row_io[i] = (uint16_t)(row_io[i] - prev_row_in[i]);
+	}
+}
+
+// Applies the delta row delta_in to row_io, turning the previous row into this one
+inline void
+ApplyDelta(float * row_io, const float * delta_in, size_t count)
+{
+	MakeDelta(row_io, delta_in, count);
+}
+
+inline void
+ApplyDelta(uint16_t * row_io, const uint16_t * delta_in, size_t count)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		row_io[i] = (uint16_t)(row_io[i] + delta_in[i]);
+	}
+}
+
+// Delta encodes row_count rows of row_size values in place
+template<typename T>
+inline void
+EncodeDeltaRows(T * rows_io, size_t row_count, size_t row_size, size_t delta_interval)
+{
+	// Last row first, so every delta is taken against the absolute row before it
+	for (size_t r = row_count; r-- > 1;)
+	{
+		if (r % delta_interval != 0)
+		{
+			MakeDelta(rows_io + r * row_size, rows_io + (r - 1) * row_size, row_size);
+		}
+	}
+}
+
+// Rebuilds row row_index into row_out, row_at(r) returning the stored row r
+template<typename T, typename RowAt>
+inline void
+ResolveDeltaRow(RowAt row_at, size_t row_size, size_t row_index, size_t delta_interval, T * row_out)
+{
+	size_t key_index = row_index - row_index % delta_interval;
+	memcpy(row_out, row_at(key_index), row_size * sizeof(T));
+	for (size_t r = key_index + 1; r <= row_index; r++)
+	{
+		ApplyDelta(row_out, row_at(r), row_size);
+	}
+}
+
+// Rebuilds the rows sample_index and next_index, which is sample_index or the row after
+// it, into start_out and end_out, walking back to the key row only once
+template<typename T, typename RowAt>
+inline void
+ResolveDeltaRows(RowAt row_at, size_t row_size, size_t sample_index, size_t next_index,
+	size_t delta_interval, T * start_out, T * end_out)
+{
+	ResolveDeltaRow(row_at, row_size, sample_index, delta_interval, start_out);
+	if ((next_index == sample_index) || (next_index % delta_interval != 0))
+	{
+		memcpy(end_out, start_out, row_size * sizeof(T));
+		if (next_index != sample_index)
+		{
+			ApplyDelta(end_out, row_at(next_index), row_size);
+		}
+	}
+	else
+	{
+		memcpy(end_out, row_at(next_index), row_size * sizeof(T));
+	}
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <cstring>
+#include <CreatureFlatData_generated.h>
+
+// Decodes count quantized displacements of region_index against the clip's range,
+// false if the list has no range for the region
+inline bool
+DequantizeDisplacements(const uint16_t * quantized_in,
+	size_t count,
+	const flatbuffers::Vector<float> * range_min_in,
+	const flatbuffers::Vector<float> * range_extent_in,
+	int quantize_bits,
+	int region_index,
+	float * values_out)
+{
+	if (!range_min_in || !range_extent_in || (region_index < 0)
+		|| ((flatbuffers::uoffset_t)region_index >= range_min_in->size())
+		|| ((flatbuffers::uoffset_t)region_index >= range_extent_in->size()))
+	{
+		return false;
+	}
+
+	float range_min = range_min_in->Get(region_index);
+	float step = range_extent_in->Get(region_index) / (float)((1 << quantize_bits) - 1);
+	for (size_t i = 0; i < count; i++)
+	{
+		values_out[i] = range_min + (float)quantized_in[i] * step;
+	}
+
+	return true;
+}
+
+// Returns true if the (start, count) pairs of runs_in each lie inside count values and
+// together read no more values than sparse_in, float or quantized, holds. Files can pass
+// VerifyrootDataBuffer with runs that do neither, so they are checked before any run is read.
+template<typename T>
+inline bool
+CheckDisplacementRuns(const flatbuffers::Vector<int> * runs_in,
+	const flatbuffers::Vector<T> * sparse_in,
+	size_t count)
+{
+	size_t sparse_size = sparse_in->size();
+	size_t read_count = 0;
+	for (flatbuffers::uoffset_t i = 0; i + 1 < runs_in->size(); i += 2)
+	{
+		int run_start = runs_in->Get(i);
+		int run_count = runs_in->Get(i + 1);
+		if ((run_start < 0) || (run_count < 0) || ((size_t)run_start > count)
+			|| ((size_t)run_count > count - (size_t)run_start)
+			|| ((size_t)run_count > sparse_size - read_count))
+		{
+			return false;
+		}
+
+		read_count += (size_t)run_count;
+	}
+
+	return true;
+}
+
+// Decodes one displacements vector of an animationMesh sample, whichever form it was
+// written in: dense floats, sparse non zero runs, quantized against the clip's range,
+// or the non zero runs alone quantized.
+// values_out must hold count floats, the region's point count * 2.
+// Values past the end of a shorter stored vector are zeroed. Returns false if the sample
+// stores no displacements of this kind or its sparse runs are out of range.
+inline bool
+DecodeDisplacements(const flatbuffers::Vector<float> * dense_in,
+	const flatbuffers::Vector<int> * runs_in,
+	const flatbuffers::Vector<float> * sparse_in,
+	const flatbuffers::Vector<uint16_t> * quantized_in,
+	const flatbuffers::Vector<float> * range_min_in,
+	const flatbuffers::Vector<float> * range_extent_in,
+	int quantize_bits,
+	int region_index,
+	float * values_out,
+	size_t count)
+{
+	if (dense_in)
+	{
+		size_t copy_count = dense_in->size() < count ? dense_in->size() : count;
+		memcpy(values_out, dense_in->data(), copy_count * sizeof(float));
+		memset(values_out + copy_count, 0, (count - copy_count) * sizeof(float));
+		return true;
+	}
+
+	if (runs_in && sparse_in)
+	{
+		if (!CheckDisplacementRuns(runs_in, sparse_in, count))
+		{
+			return false;
+		}
+
+		memset(values_out, 0, count * sizeof(float));
+
+		const float * read_values = sparse_in->data();
+		for (flatbuffers::uoffset_t i = 0; i + 1 < runs_in->size(); i += 2)
+		{
+			size_t run_start = (size_t)runs_in->Get(i);
+			size_t run_count = (size_t)runs_in->Get(i + 1);
+			memcpy(values_out + run_start, read_values, run_count * sizeof(float));
+			read_values += run_count;
+		}
+
+		return true;
+	}
+
+	if (runs_in && quantized_in)
+	{
+		if (!CheckDisplacementRuns(runs_in, quantized_in, count))
+		{
+			return false;
+		}
+
+		// The values between the runs are exactly zero, not the range's nearest step to it
+		memset(values_out, 0, count * sizeof(float));
+
+		const uint16_t * read_values = quantized_in->data();
+		for (flatbuffers::uoffset_t i = 0; i + 1 < runs_in->size(); i += 2)
+		{
+			size_t run_start = (size_t)runs_in->Get(i);
+			size_t run_count = (size_t)runs_in->Get(i + 1);
+			if (!DequantizeDisplacements(read_values, run_count, range_min_in, range_extent_in,
+				quantize_bits, region_index, values_out + run_start))
+			{
+				return false;
+			}
+
+			read_values += run_count;
+		}
+
+		return true;
+	}
+
+	if (quantized_in)
+	{
+		size_t read_count = quantized_in->size() < count ? quantized_in->size() : count;
+		if (!DequantizeDisplacements(quantized_in->data(), read_count, range_min_in, range_extent_in,
+			quantize_bits, region_index, values_out))
+		{
+			return false;
+		}
+
+		memset(values_out + read_count, 0, (count - read_count) * sizeof(float));
+		return true;
+	}
+
+	return false;
+}
+
+// Decode the displacements of one sample of list_in. Delta encoded mesh lists store
+// deltas from the previous sample in their _q vectors, which only FlatDataPoseSampler
+// rebuilds, walking up from the key row, so they return false for those lists.
+inline bool
+DecodeLocalDisplacements(const CreatureFlatData::animationMesh * mesh_in,
+	const CreatureFlatData::animationMeshList * list_in,
+	float * values_out,
+	size_t count)
+{
+	if (list_in->delta_interval() > 0)
+	{
+		return false;
+	}
+
+	return DecodeDisplacements(mesh_in->local_displacements(),
+		mesh_in->local_displacements_runs(),
+		mesh_in->local_displacements_sparse(),
+		mesh_in->local_displacements_q(),
+		list_in->local_range_min(),
+		list_in->local_range_extent(),
+		list_in->quantize_bits(),
+		mesh_in->region_index(),
+		values_out,
+		count);
+}
+
+inline bool
+DecodePostDisplacements(const CreatureFlatData::animationMesh * mesh_in,
+	const CreatureFlatData::animationMeshList * list_in,
+	float * values_out,
+	size_t count)
+{
+	if (list_in->delta_interval() > 0)
+	{
+		return false;
+	}
+
+	return DecodeDisplacements(mesh_in->post_displacements(),
+		mesh_in->post_displacements_runs(),
+		mesh_in->post_displacements_sparse(),
+		mesh_in->post_displacements_q(),
+		list_in->post_range_min(),
+		list_in->post_range_extent(),
+		list_in->quantize_bits(),
+		mesh_in->region_index(),
+		values_out,
+		count);
+}
@@ -0,0 +1,159 @@
+#include <iostream>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+#include <FlatDataLoader.h>
+
+// Verification limits. Large characters hold millions of sample tables,
+// well over the Verifier's default of one million.
+static const size_t verify_max_depth = 64;
+static const size_t verify_max_tables = (size_t)1 << 30;
+
+FlatDataLoader::FlatDataLoader()
+	: data(nullptr),
+	data_size(0)
+#ifdef _WIN32
+	, file_handle(nullptr),
+	mapping_handle(nullptr)
+#endif
+{
+}
+
+FlatDataLoader::~FlatDataLoader()
+{
+	Close();
+}
+
+bool
+FlatDataLoader::Open(const std::string& filename_in, bool verify_in)
+{
+	Close();
+
+#ifdef _WIN32
+	HANDLE read_file = CreateFileA(filename_in.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL,
+		OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+	if (read_file == INVALID_HANDLE_VALUE)
+	{
+		std::cerr << "Error: Could not read Flat Binary File: " << filename_in << std::endl;
+		return false;
+	}
+
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(read_file, &file_size) || (file_size.QuadPart == 0))
+	{
+		std::cerr << "Error: Could not read Flat Binary File: " << filename_in << std::endl;
+		CloseHandle(read_file);
+		return false;
+	}
+
+	HANDLE read_mapping = CreateFileMappingA(read_file, NULL, PAGE_READONLY, 0, 0, NULL);
+	void * map_data = read_mapping ? MapViewOfFile(read_mapping, FILE_MAP_READ, 0, 0, 0) : NULL;
+	if (!map_data)
+	{
+		std::cerr << "Error: Could not map Flat Binary File: " << filename_in << std::endl;
+		if (read_mapping)
+		{
+			CloseHandle(read_mapping);
+		}
+
+		CloseHandle(read_file);
+		return false;
+	}
+
+	file_handle = read_file;
+	mapping_handle = read_mapping;
+	data = (const uint8_t *)map_data;
+	data_size = (size_t)file_size.QuadPart;
+#else
+	int read_fd = open(filename_in.c_str(), O_RDONLY);
+	if (read_fd < 0)
+	{
+		std::cerr << "Error: Could not read Flat Binary File: " << filename_in << std::endl;
+		return false;
+	}
+
+	struct stat file_stat;
+	if ((fstat(read_fd, &file_stat) != 0) || (file_stat.st_size == 0))
+	{
+		std::cerr << "Error: Could not read Flat Binary File: " << filename_in << std::endl;
+		close(read_fd);
+		return false;
+	}
+
+	// The mapping keeps the file referenced, so the descriptor is not needed past here
+	void * map_data = mmap(nullptr, (size_t)file_stat.st_size, PROT_READ, MAP_SHARED, read_fd, 0);
+	close(read_fd);
+	if (map_data == MAP_FAILED)
+	{
+		std::cerr << "Error: Could not map Flat Binary File: " << filename_in << std::endl;
+		return false;
+	}
+
+	data = (const uint8_t *)map_data;
+	data_size = (size_t)file_stat.st_size;
+#endif
+
+	if (verify_in)
+	{
+		flatbuffers::Verifier verifier(data, data_size, verify_max_depth, verify_max_tables);
+		if (!CreatureFlatData::VerifyrootDataBuffer(verifier))
+		{
+			std::cerr << "Error: Invalid Flat Binary File: " << filename_in << std::endl;
+			Close();
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+FlatDataLoader::Close()
+{
+	if (!data)
+	{
+		return;
+	}
+
+#ifdef _WIN32
+	UnmapViewOfFile(data);
+	CloseHandle((HANDLE)mapping_handle);
+	CloseHandle((HANDLE)file_handle);
+	mapping_handle = nullptr;
+	file_handle = nullptr;
+#else
+	munmap((void *)data, data_size);
+#endif
+
+	data = nullptr;
+	data_size = 0;
+}
+
+bool
+FlatDataLoader::IsOpen() const
+{
+	return data != nullptr;
+}
+
+const CreatureFlatData::rootData *
+FlatDataLoader::GetRootData() const
+{
+	return data ? CreatureFlatData::GetrootData(data) : nullptr;
+}
+
+const uint8_t *
+FlatDataLoader::GetData() const
+{
+	return data;
+}
+
+size_t
+FlatDataLoader::GetSize() const
+{
+	return data_size;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <string>
+#include <cstddef>
+#include <cstdint>
+#include <CreatureFlatData_generated.h>
+
+// Maps a Creature FlatData Binary file read only and exposes its rootData straight
+// from the mapping, without copying the file into the heap. Processes loading the
+// same file share its pages in the page cache. The rootData and every table read
+// from it stay valid until the file is closed or the loader is destroyed.
+class FlatDataLoader
+{
+public:
+	FlatDataLoader();
+
+	// Unmaps the file
+	~FlatDataLoader();
+
+	// Maps filename_in, closing any file already open. If verify_in is true the
+	// buffer is checked with VerifyrootDataBuffer first, and the load fails if the
+	// file is truncated or corrupt. Files from untrusted sources should be verified.
+	bool Open(const std::string& filename_in, bool verify_in = false);
+
+	void Close();
+
+	bool IsOpen() const;
+
+	const CreatureFlatData::rootData * GetRootData() const;
+
+	const uint8_t * GetData() const;
+
+	size_t GetSize() const;
+
+private:
+	// Not copyable, the mapping is owned by one loader
+	FlatDataLoader(const FlatDataLoader&);
+	FlatDataLoader& operator=(const FlatDataLoader&);
+
+	const uint8_t * data;
+	size_t data_size;
+#ifdef _WIN32
+	void * file_handle;
+	void * mapping_handle;
+#endif
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include <cstring>
+#include <CreatureFlatData_generated.h>
+
+// Finds named tables of a Creature FlatData file by binary search of the _by_name
+// vectors written from format version 2. Files without them are scanned instead.
+// Each function returns the index of the first table with the name, or -1.
+
+// Scans tables_in in order, name_of returning the name of a table
+template<typename T, typename NameOf>
+inline int
+ScanNames(const flatbuffers::Vector<flatbuffers::Offset<T> > * tables_in,
+	const char * name_in,
+	NameOf name_of)
+{
+	for (flatbuffers::uoffset_t i = 0; i < tables_in->size(); i++)
+	{
+		auto cur_name = name_of(tables_in->Get(i));
+		if (cur_name && (strcmp(cur_name->c_str(), name_in) == 0))
+		{
+			return (int)i;
+		}
+	}
+
+	return -1;
+}
+
+// Searches tables_in through sorted_in, name_of returning the name of a table.
+// Files can pass VerifyrootDataBuffer with sorted_in indices past the end of tables_in,
+// so the search falls back to a scan when it meets one.
+template<typename T, typename NameOf>
+inline int
+FindSortedName(const flatbuffers::Vector<flatbuffers::Offset<T> > * tables_in,
+	const flatbuffers::Vector<int32_t> * sorted_in,
+	const char * name_in,
+	NameOf name_of)
+{
+	if (!tables_in || !name_in)
+	{
+		return -1;
+	}
+
+	if (!sorted_in || (sorted_in->size() != tables_in->size()))
+	{
+		return ScanNames(tables_in, name_in, name_of);
+	}
+
+	auto is_valid = [tables_in](int32_t index) {
+		return (index >= 0) && ((flatbuffers::uoffset_t)index < tables_in->size());
+	};
+
+	// Lower bound, so the first of several equal names is found
+	flatbuffers::uoffset_t low = 0, high = sorted_in->size();
+	while (low < high)
+	{
+		flatbuffers::uoffset_t mid = low + (high - low) / 2;
+		int32_t mid_index = sorted_in->Get(mid);
+		if (!is_valid(mid_index))
+		{
+			return ScanNames(tables_in, name_in, name_of);
+		}
+
+		auto mid_name = name_of(tables_in->Get(mid_index));
+		if (mid_name && (strcmp(mid_name->c_str(), name_in) < 0))
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	if (low < sorted_in->size())
+	{
+		int found_index = sorted_in->Get(low);
+		if (!is_valid(found_index))
+		{
+			return ScanNames(tables_in, name_in, name_of);
+		}
+
+		auto found_name = name_of(tables_in->Get(found_index));
+		if (found_name && (strcmp(found_name->c_str(), name_in) == 0))
+		{
+			return found_index;
+		}
+	}
+
+	return -1;
+}
+
+// Index into skeleton.bones
+inline int
+FindBoneIndex(const CreatureFlatData::skeleton * skeleton_in, const char * name_in)
+{
+	return skeleton_in ? FindSortedName(skeleton_in->bones(), skeleton_in->bones_by_name(), name_in,
+		[](const CreatureFlatData::skeletonBone * bone) { return bone->name(); }) : -1;
+}
+
+// Index into mesh.regions
+inline int
+FindRegionIndex(const CreatureFlatData::mesh * mesh_in, const char * name_in)
+{
+	return mesh_in ? FindSortedName(mesh_in->regions(), mesh_in->regions_by_name(), name_in,
+		[](const CreatureFlatData::meshRegion * region) { return region->name(); }) : -1;
+}
+
+// Index into animation.clips
+inline int
+FindClipIndex(const CreatureFlatData::animation * animation_in, const char * name_in)
+{
+	return animation_in ? FindSortedName(animation_in->clips(), animation_in->clips_by_name(), name_in,
+		[](const CreatureFlatData::animationClip * clip) { return clip->name(); }) : -1;
+}
+
+// Index into uvSwapItemHolder.meshes
+inline int
+FindUVSwapItemMeshIndex(const CreatureFlatData::uvSwapItemHolder * holder_in, const char * name_in)
+{
+	return holder_in ? FindSortedName(holder_in->meshes(), holder_in->meshes_by_name(), name_in,
+		[](const CreatureFlatData::uvSwapItemMesh * item_mesh) { return item_mesh->name(); }) : -1;
+}
+
+// Index into anchorPointsHolder.anchorPoints of the anchor point of a clip
+inline int
+FindAnchorPointIndex(const CreatureFlatData::anchorPointsHolder * holder_in, const char * clip_name_in)
+{
+	return holder_in ? FindSortedName(holder_in->anchorPoints(), holder_in->anchorPoints_by_clip_name(), clip_name_in,
+		[](const CreatureFlatData::anchorPointData * anchor_point) { return anchor_point->anim_clip_name(); }) : -1;
+}
+
+// Returns the clip named name_in, or nullptr
+inline const CreatureFlatData::animationClip *
+FindClip(const CreatureFlatData::rootData * root_in, const char * name_in)
+{
+	auto animation_data = root_in ? root_in->dataAnimation() : nullptr;
+	int clip_index = FindClipIndex(animation_data, name_in);
+	return (clip_index >= 0) ? animation_data->clips()->Get(clip_index) : nullptr;
+}
@@ -0,0 +1,1135 @@
+#include <cstring>
+#include <algorithm>
+#include <FlatDataPose.h>
+#include <FlatDataDisplacements.h>
+#include <FlatDataDelta.h>
+#include <FlatDataLookup.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define FLATDATA_POSE_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+// Finds the samples bracketing time_in among count sample times, and how far
+// between them it lies. Times outside the samples clamp to the first or last one.
+template<typename TimeAt>
+static void
+FindSampleBracket(size_t count, float time_in, TimeAt time_at,
+	size_t& index_out, size_t& next_out, float& alpha_out)
+{
+	// First sample after time_in
+	size_t low = 0, high = count;
+	while (low < high)
+	{
+		size_t mid = low + (high - low) / 2;
+		if ((float)time_at(mid) <= time_in)
+		{
+			low = mid + 1;
+		}
+		else
+		{
+			high = mid;
+		}
+	}
+
+	index_out = (low > 0) ? low - 1 : 0;
+	next_out = index_out;
+	alpha_out = 0.0f;
+
+	if ((low > 0) && (low < count))
+	{
+		float start_time = (float)time_at(index_out);
+		float end_time = (float)time_at(low);
+		next_out = low;
+		alpha_out = (end_time > start_time) ? (time_in - start_time) / (end_time - start_time) : 0.0f;
+	}
+}
+
+static inline void
+LerpValues(float * values_io, const float * target_in, size_t count, float alpha)
+{
+	for (size_t i = 0; i < count; i++)
+	{
+		values_io[i] += (target_in[i] - values_io[i]) * alpha;
+	}
+}
+
+// Calls run_fn(first_channel, channel_count) for each run of consecutive bones an
+// animationBonesTrack animates, covering the whole row when it has no animated_bones mask
+template<typename RunFn>
+static void
+ForEachAnimatedRun(const CreatureFlatData::animationBonesTrack * track_in, size_t bone_count, RunFn run_fn)
+{
+	auto animated_bones = track_in->animated_bones();
+	if (!animated_bones || (animated_bones->size() < bone_count))
+	{
+		run_fn((size_t)0, bone_count * 4);
+		return;
+	}
+
+	size_t b = 0;
+	while (b < bone_count)
+	{
+		if (!animated_bones->Get((flatbuffers::uoffset_t)b))
+		{
+			b++;
+			continue;
+		}
+
+		size_t run_start = b;
+		while ((b < bone_count) && animated_bones->Get((flatbuffers::uoffset_t)b))
+		{
+			b++;
+		}
+
+		run_fn(run_start * 4, (b - run_start) * 4);
+	}
+}
+
+// values_io[i] += start_weight * start_in[i] + end_weight * end_in[i]
+static inline void
+AccumulateRows(float * values_io, const float * start_in, const float * end_in, size_t count,
+	float start_weight, float end_weight)
+{
+	size_t i = 0;
+#if defined(FLATDATA_POSE_HAS_SSE2)
+	__m128 start_scale = _mm_set1_ps(start_weight), end_scale = _mm_set1_ps(end_weight);
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 sum = _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(start_in + i), start_scale),
+			_mm_mul_ps(_mm_loadu_ps(end_in + i), end_scale));
+		_mm_storeu_ps(values_io + i, _mm_add_ps(_mm_loadu_ps(values_io + i), sum));
+	}
+#endif
+
+	for (; i < count; i++)
+	{
+		values_io[i] += start_weight * start_in[i] + end_weight * end_in[i];
+	}
+}
+
+// values_io[i] += weight_in * values_in[i]
+static inline void
+AccumulateScaled(float * values_io, const float * values_in, size_t count, float weight_in)
+{
+	size_t i = 0;
+#if defined(FLATDATA_POSE_HAS_SSE2)
+	__m128 scale = _mm_set1_ps(weight_in);
+	for (; i + 4 <= count; i += 4)
+	{
+		_mm_storeu_ps(values_io + i, _mm_add_ps(_mm_loadu_ps(values_io + i), _mm_mul_ps(_mm_loadu_ps(values_in + i), scale)));
+	}
+#endif
+
+	for (; i < count; i++)
+	{
+		values_io[i] += weight_in * values_in[i];
+	}
+}
+
+// values_io[i] += (start_weight * start_in[i] + end_weight * end_in[i]) * scale_in[i] + offset_in[i] * offset_weight,
+// the quantized form of AccumulateRows with a per value scale and offset
+static inline void
+AccumulateRowsQ(float * values_io, const uint16_t * start_in, const uint16_t * end_in, size_t count,
+	float start_weight, float end_weight, const float * scale_in, const float * offset_in, float offset_weight)
+{
+	size_t i = 0;
+#if defined(FLATDATA_POSE_HAS_SSE2)
+	__m128 start_scale = _mm_set1_ps(start_weight), end_scale = _mm_set1_ps(end_weight);
+	__m128 offset_scale = _mm_set1_ps(offset_weight);
+	__m128i zero = _mm_setzero_si128();
+	for (; i + 4 <= count; i += 4)
+	{
+		__m128 start_q = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(start_in + i)), zero));
+		__m128 end_q = _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)(end_in + i)), zero));
+		__m128 q = _mm_add_ps(_mm_mul_ps(start_q, start_scale), _mm_mul_ps(end_q, end_scale));
+		__m128 sum = _mm_add_ps(_mm_mul_ps(q, _mm_loadu_ps(scale_in + i)),
+			_mm_mul_ps(_mm_loadu_ps(offset_in + i), offset_scale));
+		_mm_storeu_ps(values_io + i, _mm_add_ps(_mm_loadu_ps(values_io + i), sum));
+	}
+#endif
+
+	for (; i < count; i++)
+	{
+		float q = start_weight * (float)start_in[i] + end_weight * (float)end_in[i];
+		values_io[i] += q * scale_in[i] + offset_in[i] * offset_weight;
+	}
+}
+
+// Adds weight_in times one displacements vector of an animationMesh sample to values_io,
+// reading whichever form DecodeDisplacements reads without decoding it to a buffer first
+static bool
+AccumulateDisplacements(const flatbuffers::Vector<float> * dense_in,
+	const flatbuffers::Vector<int> * runs_in,
+	const flatbuffers::Vector<float> * sparse_in,
+	const flatbuffers::Vector<uint16_t> * quantized_in,
+	const flatbuffers::Vector<float> * range_min_in,
+	const flatbuffers::Vector<float> * range_extent_in,
+	int quantize_bits,
+	int region_index,
+	float weight_in,
+	float * values_io,
+	size_t count)
+{
+	if (dense_in)
+	{
+		size_t read_count = std::min((size_t)dense_in->size(), count);
+		AccumulateScaled(values_io, dense_in->data(), read_count, weight_in);
+		return true;
+	}
+
+	if (runs_in && sparse_in)
+	{
+		if (!CheckDisplacementRuns(runs_in, sparse_in, count))
+		{
+			return false;
+		}
+
+		const float * read_values = sparse_in->data();
+		for (flatbuffers::uoffset_t i = 0; i + 1 < runs_in->size(); i += 2)
+		{
+			size_t run_start = (size_t)runs_in->Get(i);
+			size_t run_count = (size_t)runs_in->Get(i + 1);
+			AccumulateScaled(values_io + run_start, read_values, run_count, weight_in);
+			read_values += run_count;
+		}
+
+		return true;
+	}
+
+	if (quantized_in && range_min_in && range_extent_in && (region_index >= 0)
+		&& ((flatbuffers::uoffset_t)region_index < range_min_in->size())
+		&& ((flatbuffers::uoffset_t)region_index < range_extent_in->size()))
+	{
+		float offset = weight_in * range_min_in->Get(region_index);
+		float step = weight_in * range_extent_in->Get(region_index) / (float)((1 << quantize_bits) - 1);
+		const uint16_t * read_values = quantized_in->data();
+		if (runs_in)
+		{
+			// Only the non zero runs are quantized, the values between them add nothing
+			if (!CheckDisplacementRuns(runs_in, quantized_in, count))
+			{
+				return false;
+			}
+
+			for (flatbuffers::uoffset_t i = 0; i + 1 < runs_in->size(); i += 2)
+			{
+				size_t run_start = (size_t)runs_in->Get(i);
+				size_t run_count = (size_t)runs_in->Get(i + 1);
+				for (size_t k = 0; k < run_count; k++)
+				{
+					values_io[run_start + k] += offset + (float)read_values[k] * step;
+				}
+
+				read_values += run_count;
+			}
+
+			return true;
+		}
+
+		size_t read_count = std::min((size_t)quantized_in->size(), count);
+		for (size_t i = 0; i < read_count; i++)
+		{
+			values_io[i] += offset + (float)read_values[i] * step;
+		}
+
+		return true;
+	}
+
+	return false;
+}
+
+static inline void
+ReadUVSwap(const CreatureFlatData::animationUVSwap * uv_swap_in, FlatDataUVSwap& uv_swap_out)
+{
+	const flatbuffers::Vector<float> * read_vecs[3] = {
+		uv_swap_in->local_offset(), uv_swap_in->global_offset(), uv_swap_in->scale()
+	};
+	float * write_vecs[3] = {
+		uv_swap_out.local_offset, uv_swap_out.global_offset, uv_swap_out.scale
+	};
+
+	for (int i = 0; i < 3; i++)
+	{
+		if (read_vecs[i] && (read_vecs[i]->size() >= 2))
+		{
+			write_vecs[i][0] = read_vecs[i]->Get(0);
+			write_vecs[i][1] = read_vecs[i]->Get(1);
+		}
+	}
+
+	uv_swap_out.enabled = uv_swap_in->enabled();
+}
+
+// Points start_row_out and end_row_out at the rows sample_index and next_index of a track,
+// rebuilding them into delta_rows_out, room for two rows, if the track is delta encoded
+template<typename T>
+static void
+GetTrackRows(const T * rows_in, size_t row_size, size_t sample_index, size_t next_index,
+	int delta_interval, T * delta_rows_out, const T *& start_row_out, const T *& end_row_out)
+{
+	if (delta_interval <= 0)
+	{
+		start_row_out = rows_in + sample_index * row_size;
+		end_row_out = rows_in + next_index * row_size;
+		return;
+	}
+
+	ResolveDeltaRows([rows_in, row_size](size_t r) { return rows_in + r * row_size; },
+		row_size, sample_index, next_index, (size_t)delta_interval, delta_rows_out, delta_rows_out + row_size);
+	start_row_out = delta_rows_out;
+	end_row_out = delta_rows_out + row_size;
+}
+
+// ----------- Pose ----------------------
+
+FlatDataPose::FlatDataPose()
+{
+}
+
+void
+FlatDataPose::Init(const CreatureFlatData::rootData * root_in)
+{
+	auto skeleton_data = root_in->dataSkeleton();
+	auto mesh_data = root_in->dataMesh();
+	size_t bone_count = (skeleton_data && skeleton_data->bones()) ? skeleton_data->bones()->size() : 0;
+	size_t region_count = (mesh_data && mesh_data->regions()) ? mesh_data->regions()->size() : 0;
+	size_t point_count = (mesh_data && mesh_data->points()) ? mesh_data->points()->size() / 2 : 0;
+
+	size_t max_region_count = 0;
+	for (size_t i = 0; i < region_count; i++)
+	{
+		auto cur_region = mesh_data->regions()->Get((flatbuffers::uoffset_t)i);
+		max_region_count = std::max(max_region_count,
+			(size_t)std::max(cur_region->end_pt_index() - cur_region->start_pt_index() + 1, 0));
+	}
+
+	bone_positions.assign(bone_count * 4, 0.0f);
+	local_displacements.assign(point_count * 2, 0.0f);
+	post_displacements.assign(point_count * 2, 0.0f);
+	region_use_dq.assign(region_count, 0);
+	region_use_local_displacements.assign(region_count, 0);
+	region_use_post_displacements.assign(region_count, 0);
+	region_opacities.assign(region_count, 100.0f);
+	region_uv_swaps.resize(region_count);
+	scratch.assign(max_region_count * 2, 0.0f);
+	delta_rows.assign(bone_count * 4 * 2, 0.0f);
+	delta_rows_q.assign(bone_count * 4 * 2, 0);
+	delta_displacements_q.assign(point_count * 2 * 4, 0);
+	bone_transforms.assign(bone_count * 4, 0.0f);
+	bone_dual_quats.assign(bone_count * 4, 0.0f);
+}
+
+// ----------- Sampler ----------------------
+
+FlatDataPoseSampler::FlatDataPoseSampler(const CreatureFlatData::rootData * root_in)
+	: root_data(root_in),
+	bone_count(0)
+{
+	auto skeleton_data = root_data->dataSkeleton();
+	if (skeleton_data && skeleton_data->bones())
+	{
+		bone_count = (int)skeleton_data->bones()->size();
+	}
+
+	auto mesh_data = root_data->dataMesh();
+	if (mesh_data && mesh_data->regions())
+	{
+		size_t point_count = mesh_data->points() ? mesh_data->points()->size() / 2 : 0;
+		for (flatbuffers::uoffset_t i = 0; i < mesh_data->regions()->size(); i++)
+		{
+			// Regions reaching past the mesh points are clamped so sampling stays in the pose buffers
+			auto cur_region = mesh_data->regions()->Get(i);
+			int region_start = std::max(cur_region->start_pt_index(), 0);
+			int region_end = std::min(cur_region->end_pt_index(), (int)point_count - 1);
+			region_starts.push_back(region_start);
+			region_counts.push_back(std::max(region_end - region_start + 1, 0));
+		}
+	}
+}
+
+int
+FlatDataPoseSampler::GetClipCount() const
+{
+	auto animation_data = root_data->dataAnimation();
+	return (animation_data && animation_data->clips()) ? (int)animation_data->clips()->size() : 0;
+}
+
+bool
+FlatDataPoseSampler::GetClipTimeRange(int clip_index, int& start_time_out, int& end_time_out) const
+{
+	if ((clip_index < 0) || (clip_index >= GetClipCount()))
+	{
+		return false;
+	}
+
+	return GetClipTimeRange(root_data->dataAnimation()->clips()->Get(clip_index), start_time_out, end_time_out);
+}
+
+bool
+FlatDataPoseSampler::GetClipTimeRange(const CreatureFlatData::animationClip * clip_in,
+	int& start_time_out, int& end_time_out) const
+{
+	auto bones_track = clip_in->bonesTrack();
+	if (bones_track && bones_track->times() && (bones_track->times()->size() > 0))
+	{
+		start_time_out = bones_track->times()->Get(0);
+		end_time_out = bones_track->times()->Get(bones_track->times()->size() - 1);
+		return true;
+	}
+
+	auto bones_list = clip_in->bones();
+	if (bones_list && bones_list->timeSamples() && (bones_list->timeSamples()->size() > 0))
+	{
+		auto time_samples = bones_list->timeSamples();
+		start_time_out = time_samples->Get(0)->time();
+		end_time_out = time_samples->Get(time_samples->size() - 1)->time();
+		return true;
+	}
+
+	return false;
+}
+
+int
+FlatDataPoseSampler::GetBoneIndex(const CreatureFlatData::animationBone * bone_in) const
+{
+	int bone_index = bone_in->bone_index();
+	if (bone_index < 0)
+	{
+		auto bone_name = bone_in->name();
+		bone_index = bone_name ? FindBoneIndex(root_data->dataSkeleton(), bone_name->c_str()) : -1;
+	}
+
+	return (bone_index < bone_count) ? bone_index : -1;
+}
+
+int
+FlatDataPoseSampler::GetRegionIndex(int region_index, const flatbuffers::String * name_in) const
+{
+	if (region_index < 0)
+	{
+		region_index = name_in ? FindRegionIndex(root_data->dataMesh(), name_in->c_str()) : -1;
+	}
+
+	return (region_index < (int)region_starts.size()) ? region_index : -1;
+}
+
+void
+FlatDataPoseSampler::ResetRegionState(FlatDataPose& pose_io) const
+{
+	// Region state is reset every sample, so regions missing from the clip read as unanimated
+	std::fill(pose_io.region_use_dq.begin(), pose_io.region_use_dq.end(), 0);
+	std::fill(pose_io.region_use_local_displacements.begin(), pose_io.region_use_local_displacements.end(), 0);
+	std::fill(pose_io.region_use_post_displacements.begin(), pose_io.region_use_post_displacements.end(), 0);
+	std::fill(pose_io.region_opacities.begin(), pose_io.region_opacities.end(), 100.0f);
+	for (auto& cur_uv_swap : pose_io.region_uv_swaps)
+	{
+		cur_uv_swap.local_offset[0] = cur_uv_swap.local_offset[1] = 0.0f;
+		cur_uv_swap.global_offset[0] = cur_uv_swap.global_offset[1] = 0.0f;
+		cur_uv_swap.scale[0] = cur_uv_swap.scale[1] = 1.0f;
+		cur_uv_swap.enabled = false;
+	}
+}
+
+bool
+FlatDataPoseSampler::Sample(int clip_index, float time_in, FlatDataPose& pose_io) const
+{
+	if ((clip_index < 0) || (clip_index >= GetClipCount()))
+	{
+		return false;
+	}
+
+	return Sample(root_data->dataAnimation()->clips()->Get(clip_index), time_in, pose_io);
+}
+
+bool
+FlatDataPoseSampler::Sample(const CreatureFlatData::animationClip * clip_in, float time_in, FlatDataPose& pose_io) const
+{
+	if (!clip_in
+		|| (pose_io.bone_positions.size() != (size_t)bone_count * 4)
+		|| (pose_io.region_opacities.size() != region_starts.size()))
+	{
+		return false;
+	}
+
+	ResetRegionState(pose_io);
+
+	if (clip_in->bonesTrack())
+	{
+		SampleBonesTrack(clip_in->bonesTrack(), time_in, pose_io);
+	}
+	else if (clip_in->bones())
+	{
+		SampleBonesList(clip_in->bones(), time_in, pose_io);
+	}
+
+	if (clip_in->meshes())
+	{
+		SampleMeshes(clip_in->meshes(), time_in, pose_io);
+	}
+
+	if (clip_in->uvSwaps())
+	{
+		SampleUVSwaps(clip_in->uvSwaps(), time_in, pose_io);
+	}
+
+	if (clip_in->meshOpacities())
+	{
+		SampleOpacities(clip_in->meshOpacities(), time_in, pose_io);
+	}
+
+	return true;
+}
+
+void
+FlatDataPoseSampler::SampleBonesTrack(const CreatureFlatData::animationBonesTrack * track_in,
+	float time_in, FlatDataPose& pose_io) const
+{
+	auto track_times = track_in->times();
+	size_t row_size = (size_t)track_in->bone_count() * 4;
+	if (!track_times || (track_times->size() == 0) || (row_size != pose_io.bone_positions.size()))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(track_times->size(), time_in,
+		[track_times](size_t i) { return track_times->Get((flatbuffers::uoffset_t)i); },
+		sample_index, next_index, alpha);
+
+	float * write_positions = pose_io.bone_positions.data();
+	auto positions = track_in->positions();
+	auto positions_q = track_in->positions_q();
+
+	if (positions && (positions->size() >= (next_index + 1) * row_size))
+	{
+		const float * start_row, * end_row;
+		GetTrackRows(positions->data(), row_size, sample_index, next_index, track_in->delta_interval(),
+			pose_io.delta_rows.data(), start_row, end_row);
+		ForEachAnimatedRun(track_in, row_size / 4, [&](size_t first_channel, size_t channel_count)
+		{
+			for (size_t c = first_channel; c < first_channel + channel_count; c++)
+			{
+				write_positions[c] = start_row[c] + (end_row[c] - start_row[c]) * alpha;
+			}
+		});
+	}
+	else if (positions_q && track_in->range_min() && track_in->range_extent()
+		&& (positions_q->size() >= (next_index + 1) * row_size)
+		&& (track_in->range_min()->size() >= row_size)
+		&& (track_in->range_extent()->size() >= row_size))
+	{
+		// Interpolating the quantized values then scaling once matches decoding both rows first
+		const uint16_t * start_row, * end_row;
+		GetTrackRows(positions_q->data(), row_size, sample_index, next_index, track_in->delta_interval(),
+			pose_io.delta_rows_q.data(), start_row, end_row);
+		const float * range_min = track_in->range_min()->data();
+		const float * range_extent = track_in->range_extent()->data();
+		float inv_max_q = 1.0f / (float)((1 << track_in->quantize_bits()) - 1);
+		ForEachAnimatedRun(track_in, row_size / 4, [&](size_t first_channel, size_t channel_count)
+		{
+			for (size_t c = first_channel; c < first_channel + channel_count; c++)
+			{
+				float q = (float)start_row[c] + ((float)end_row[c] - (float)start_row[c]) * alpha;
+				write_positions[c] = range_min[c] + q * range_extent[c] * inv_max_q;
+			}
+		});
+	}
+}
+
+void
+FlatDataPoseSampler::SampleBonesList(const CreatureFlatData::animationBonesList * list_in,
+	float time_in, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	if (!time_samples || (time_samples->size() == 0))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(time_samples->size(), time_in,
+		[time_samples](size_t i) { return time_samples->Get((flatbuffers::uoffset_t)i)->time(); },
+		sample_index, next_index, alpha);
+
+	float * write_positions = pose_io.bone_positions.data();
+	for (int pass = 0; pass < ((alpha > 0.0f) ? 2 : 1); pass++)
+	{
+		// The first pass writes the earlier sample, the second blends the later one in
+		auto sample_bones = time_samples->Get((flatbuffers::uoffset_t)(pass == 0 ? sample_index : next_index))->bones();
+		if (!sample_bones)
+		{
+			continue;
+		}
+
+		float blend = (pass == 0) ? 1.0f : alpha;
+		for (flatbuffers::uoffset_t i = 0; i < sample_bones->size(); i++)
+		{
+			auto cur_bone = sample_bones->Get(i);
+			int bone_index = GetBoneIndex(cur_bone);
+			auto start_pt = cur_bone->start_pt();
+			auto end_pt = cur_bone->end_pt();
+			if ((bone_index < 0) || !start_pt || !end_pt || (start_pt->size() < 2) || (end_pt->size() < 2))
+			{
+				continue;
+			}
+
+			float read_values[4] = { start_pt->Get(0), start_pt->Get(1), end_pt->Get(0), end_pt->Get(1) };
+			LerpValues(write_positions + bone_index * 4, read_values, 4, blend);
+		}
+	}
+}
+
+void
+FlatDataPoseSampler::SampleMeshes(const CreatureFlatData::animationMeshList * list_in,
+	float time_in, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	if (!time_samples || (time_samples->size() == 0))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(time_samples->size(), time_in,
+		[time_samples](size_t i) { return time_samples->Get((flatbuffers::uoffset_t)i)->time(); },
+		sample_index, next_index, alpha);
+
+	if (list_in->delta_interval() > 0)
+	{
+		SampleDeltaMeshes(list_in, sample_index, next_index, alpha, false, 1.0f, true, pose_io);
+		return;
+	}
+
+	for (int pass = 0; pass < ((alpha > 0.0f) ? 2 : 1); pass++)
+	{
+		auto sample_meshes = time_samples->Get((flatbuffers::uoffset_t)(pass == 0 ? sample_index : next_index))->meshes();
+		if (!sample_meshes)
+		{
+			continue;
+		}
+
+		for (flatbuffers::uoffset_t i = 0; i < sample_meshes->size(); i++)
+		{
+			auto cur_mesh = sample_meshes->Get(i);
+			int region_index = GetRegionIndex(cur_mesh->region_index(), cur_mesh->name());
+			if (region_index < 0)
+			{
+				continue;
+			}
+
+			size_t write_start = (size_t)region_starts[region_index] * 2;
+			size_t write_count = (size_t)region_counts[region_index] * 2;
+			float * local_values = pose_io.local_displacements.data() + write_start;
+			float * post_values = pose_io.post_displacements.data() + write_start;
+
+			if (pass == 0)
+			{
+				// Flags hold the earlier sample, like the uv swaps
+				pose_io.region_use_dq[region_index] = cur_mesh->use_dq() ? 1 : 0;
+				pose_io.region_use_local_displacements[region_index] = cur_mesh->use_local_displacements() ? 1 : 0;
+				pose_io.region_use_post_displacements[region_index] = cur_mesh->use_post_displacements() ? 1 : 0;
+
+				DecodeLocalDisplacements(cur_mesh, list_in, local_values, write_count);
+				DecodePostDisplacements(cur_mesh, list_in, post_values, write_count);
+			}
+			else
+			{
+				float * scratch_values = pose_io.scratch.data();
+				if (DecodeLocalDisplacements(cur_mesh, list_in, scratch_values, write_count))
+				{
+					LerpValues(local_values, scratch_values, write_count, alpha);
+				}
+
+				if (DecodePostDisplacements(cur_mesh, list_in, scratch_values, write_count))
+				{
+					LerpValues(post_values, scratch_values, write_count, alpha);
+				}
+			}
+		}
+	}
+}
+
+void
+FlatDataPoseSampler::SampleUVSwaps(const CreatureFlatData::animationUVSwapList * list_in,
+	float time_in, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	if (!time_samples || (time_samples->size() == 0))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(time_samples->size(), time_in,
+		[time_samples](size_t i) { return time_samples->Get((flatbuffers::uoffset_t)i)->time(); },
+		sample_index, next_index, alpha);
+
+	auto sample_uv_swaps = time_samples->Get((flatbuffers::uoffset_t)sample_index)->uvSwaps();
+	if (!sample_uv_swaps)
+	{
+		return;
+	}
+
+	for (flatbuffers::uoffset_t i = 0; i < sample_uv_swaps->size(); i++)
+	{
+		auto cur_uv_swap = sample_uv_swaps->Get(i);
+		int region_index = GetRegionIndex(cur_uv_swap->region_index(), cur_uv_swap->name());
+		if (region_index >= 0)
+		{
+			ReadUVSwap(cur_uv_swap, pose_io.region_uv_swaps[region_index]);
+		}
+	}
+}
+
+void
+FlatDataPoseSampler::SampleOpacities(const CreatureFlatData::animationMeshOpacityList * list_in,
+	float time_in, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	if (!time_samples || (time_samples->size() == 0))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(time_samples->size(), time_in,
+		[time_samples](size_t i) { return time_samples->Get((flatbuffers::uoffset_t)i)->time(); },
+		sample_index, next_index, alpha);
+
+	for (int pass = 0; pass < ((alpha > 0.0f) ? 2 : 1); pass++)
+	{
+		auto sample_opacities = time_samples->Get((flatbuffers::uoffset_t)(pass == 0 ? sample_index : next_index))->meshOpacities();
+		if (!sample_opacities)
+		{
+			continue;
+		}
+
+		float blend = (pass == 0) ? 1.0f : alpha;
+		for (flatbuffers::uoffset_t i = 0; i < sample_opacities->size(); i++)
+		{
+			auto cur_opacity = sample_opacities->Get(i);
+			int region_index = GetRegionIndex(cur_opacity->region_index(), cur_opacity->name());
+			if (region_index >= 0)
+			{
+				float read_opacity = cur_opacity->opacity();
+				LerpValues(&pose_io.region_opacities[region_index], &read_opacity, 1, blend);
+			}
+		}
+	}
+}
+
+// ----------- Blending ----------------------
+
+bool
+FlatDataPoseSampler::SampleBlend(const FlatDataClipBlend * clips_in, int clip_count, FlatDataPose& pose_io) const
+{
+	if ((pose_io.bone_positions.size() != (size_t)bone_count * 4)
+		|| (pose_io.region_opacities.size() != region_starts.size()))
+	{
+		return false;
+	}
+
+	float total_weight = 0.0f;
+	int heaviest_index = -1;
+	for (int i = 0; i < clip_count; i++)
+	{
+		if ((clips_in[i].clip_index < 0) || (clips_in[i].clip_index >= GetClipCount()))
+		{
+			return false;
+		}
+
+		total_weight += std::max(clips_in[i].weight, 0.0f);
+		if ((heaviest_index < 0) || (clips_in[i].weight > clips_in[heaviest_index].weight))
+		{
+			heaviest_index = i;
+		}
+	}
+
+	if (total_weight <= 0.0f)
+	{
+		return false;
+	}
+
+	// Every clip adds into the pose, so the blended values start from zero
+	ResetRegionState(pose_io);
+	std::fill(pose_io.bone_positions.begin(), pose_io.bone_positions.end(), 0.0f);
+	std::fill(pose_io.local_displacements.begin(), pose_io.local_displacements.end(), 0.0f);
+	std::fill(pose_io.post_displacements.begin(), pose_io.post_displacements.end(), 0.0f);
+
+	for (int i = 0; i < clip_count; i++)
+	{
+		float cur_weight = std::max(clips_in[i].weight, 0.0f) / total_weight;
+		if ((cur_weight <= 0.0f) && (i != heaviest_index))
+		{
+			continue;
+		}
+
+		float cur_time = clips_in[i].time;
+		auto cur_clip = root_data->dataAnimation()->clips()->Get(clips_in[i].clip_index);
+		if (cur_clip->bonesTrack())
+		{
+			BlendBonesTrack(cur_clip->bonesTrack(), cur_time, cur_weight, pose_io);
+		}
+		else if (cur_clip->bones())
+		{
+			BlendBonesList(cur_clip->bones(), cur_time, cur_weight, pose_io);
+		}
+
+		if (cur_clip->meshes())
+		{
+			BlendMeshes(cur_clip->meshes(), cur_time, cur_weight, i == heaviest_index, pose_io);
+		}
+
+		if (cur_clip->meshOpacities())
+		{
+			BlendOpacities(cur_clip->meshOpacities(), cur_time, cur_weight, pose_io);
+		}
+
+		if ((i == heaviest_index) && cur_clip->uvSwaps())
+		{
+			SampleUVSwaps(cur_clip->uvSwaps(), cur_time, pose_io);
+		}
+	}
+
+	return true;
+}
+
+void
+FlatDataPoseSampler::BlendBonesTrack(const CreatureFlatData::animationBonesTrack * track_in,
+	float time_in, float weight_in, FlatDataPose& pose_io) const
+{
+	auto track_times = track_in->times();
+	size_t row_size = (size_t)track_in->bone_count() * 4;
+	if (!track_times || (track_times->size() == 0) || (row_size != pose_io.bone_positions.size()))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(track_times->size(), time_in,
+		[track_times](size_t i) { return track_times->Get((flatbuffers::uoffset_t)i); },
+		sample_index, next_index, alpha);
+
+	float * write_positions = pose_io.bone_positions.data();
+	float start_weight = weight_in * (1.0f - alpha), end_weight = weight_in * alpha;
+	auto positions = track_in->positions();
+	auto positions_q = track_in->positions_q();
+
+	if (positions && (positions->size() >= (next_index + 1) * row_size))
+	{
+		const float * start_row, * end_row;
+		GetTrackRows(positions->data(), row_size, sample_index, next_index, track_in->delta_interval(),
+			pose_io.delta_rows.data(), start_row, end_row);
+		ForEachAnimatedRun(track_in, row_size / 4, [&](size_t first_channel, size_t channel_count)
+		{
+			AccumulateRows(write_positions + first_channel, start_row + first_channel, end_row + first_channel,
+				channel_count, start_weight, end_weight);
+		});
+	}
+	else if (positions_q && track_in->range_min() && track_in->range_extent()
+		&& (positions_q->size() >= (next_index + 1) * row_size)
+		&& (track_in->range_min()->size() >= row_size)
+		&& (track_in->range_extent()->size() >= row_size))
+	{
+		// The range extents are stored unscaled, so the 1 / max_q scale folds into the row weights
+		float inv_max_q = 1.0f / (float)((1 << track_in->quantize_bits()) - 1);
+		const uint16_t * start_row, * end_row;
+		GetTrackRows(positions_q->data(), row_size, sample_index, next_index, track_in->delta_interval(),
+			pose_io.delta_rows_q.data(), start_row, end_row);
+		const float * range_min = track_in->range_min()->data();
+		const float * range_extent = track_in->range_extent()->data();
+		ForEachAnimatedRun(track_in, row_size / 4, [&](size_t first_channel, size_t channel_count)
+		{
+			AccumulateRowsQ(write_positions + first_channel, start_row + first_channel, end_row + first_channel,
+				channel_count, start_weight * inv_max_q, end_weight * inv_max_q,
+				range_extent + first_channel, range_min + first_channel, weight_in);
+		});
+	}
+}
+
+void
+FlatDataPoseSampler::BlendBonesList(const CreatureFlatData::animationBonesList * list_in,
+	float time_in, float weight_in, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	if (!time_samples || (time_samples->size() == 0))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(time_samples->size(), time_in,
+		[time_samples](size_t i) { return time_samples->Get((flatbuffers::uoffset_t)i)->time(); },
+		sample_index, next_index, alpha);
+
+	float * write_positions = pose_io.bone_positions.data();
+	for (int pass = 0; pass < ((alpha > 0.0f) ? 2 : 1); pass++)
+	{
+		auto sample_bones = time_samples->Get((flatbuffers::uoffset_t)(pass == 0 ? sample_index : next_index))->bones();
+		if (!sample_bones)
+		{
+			continue;
+		}
+
+		float blend = weight_in * ((pass == 0) ? 1.0f - alpha : alpha);
+		for (flatbuffers::uoffset_t i = 0; i < sample_bones->size(); i++)
+		{
+			auto cur_bone = sample_bones->Get(i);
+			int bone_index = GetBoneIndex(cur_bone);
+			auto start_pt = cur_bone->start_pt();
+			auto end_pt = cur_bone->end_pt();
+			if ((bone_index < 0) || !start_pt || !end_pt || (start_pt->size() < 2) || (end_pt->size() < 2))
+			{
+				continue;
+			}
+
+			float * write_bone = write_positions + bone_index * 4;
+			write_bone[0] += blend * start_pt->Get(0);
+			write_bone[1] += blend * start_pt->Get(1);
+			write_bone[2] += blend * end_pt->Get(0);
+			write_bone[3] += blend * end_pt->Get(1);
+		}
+	}
+}
+
+void
+FlatDataPoseSampler::BlendMeshes(const CreatureFlatData::animationMeshList * list_in,
+	float time_in, float weight_in, bool set_flags, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	if (!time_samples || (time_samples->size() == 0))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(time_samples->size(), time_in,
+		[time_samples](size_t i) { return time_samples->Get((flatbuffers::uoffset_t)i)->time(); },
+		sample_index, next_index, alpha);
+
+	if (list_in->delta_interval() > 0)
+	{
+		SampleDeltaMeshes(list_in, sample_index, next_index, alpha, true, weight_in, set_flags, pose_io);
+		return;
+	}
+
+	for (int pass = 0; pass < ((alpha > 0.0f) ? 2 : 1); pass++)
+	{
+		auto sample_meshes = time_samples->Get((flatbuffers::uoffset_t)(pass == 0 ? sample_index : next_index))->meshes();
+		if (!sample_meshes)
+		{
+			continue;
+		}
+
+		float blend = weight_in * ((pass == 0) ? 1.0f - alpha : alpha);
+		for (flatbuffers::uoffset_t i = 0; i < sample_meshes->size(); i++)
+		{
+			auto cur_mesh = sample_meshes->Get(i);
+			int region_index = GetRegionIndex(cur_mesh->region_index(), cur_mesh->name());
+			if (region_index < 0)
+			{
+				continue;
+			}
+
+			if (set_flags && (pass == 0))
+			{
+				pose_io.region_use_dq[region_index] = cur_mesh->use_dq() ? 1 : 0;
+				pose_io.region_use_local_displacements[region_index] = cur_mesh->use_local_displacements() ? 1 : 0;
+				pose_io.region_use_post_displacements[region_index] = cur_mesh->use_post_displacements() ? 1 : 0;
+			}
+
+			size_t write_start = (size_t)region_starts[region_index] * 2;
+			size_t write_count = (size_t)region_counts[region_index] * 2;
+			AccumulateDisplacements(cur_mesh->local_displacements(), cur_mesh->local_displacements_runs(),
+				cur_mesh->local_displacements_sparse(), cur_mesh->local_displacements_q(),
+				list_in->local_range_min(), list_in->local_range_extent(), list_in->quantize_bits(),
+				cur_mesh->region_index(), blend, pose_io.local_displacements.data() + write_start, write_count);
+			AccumulateDisplacements(cur_mesh->post_displacements(), cur_mesh->post_displacements_runs(),
+				cur_mesh->post_displacements_sparse(), cur_mesh->post_displacements_q(),
+				list_in->post_range_min(), list_in->post_range_extent(), list_in->quantize_bits(),
+				cur_mesh->region_index(), blend, pose_io.post_displacements.data() + write_start, write_count);
+		}
+	}
+}
+
+void
+FlatDataPoseSampler::BlendOpacities(const CreatureFlatData::animationMeshOpacityList * list_in,
+	float time_in, float weight_in, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	if (!time_samples || (time_samples->size() == 0))
+	{
+		return;
+	}
+
+	size_t sample_index, next_index;
+	float alpha;
+	FindSampleBracket(time_samples->size(), time_in,
+		[time_samples](size_t i) { return time_samples->Get((flatbuffers::uoffset_t)i)->time(); },
+		sample_index, next_index, alpha);
+
+	// Opacities start at the unanimated 100, so each sample adds its difference from that
+	for (int pass = 0; pass < ((alpha > 0.0f) ? 2 : 1); pass++)
+	{
+		auto sample_opacities = time_samples->Get((flatbuffers::uoffset_t)(pass == 0 ? sample_index : next_index))->meshOpacities();
+		if (!sample_opacities)
+		{
+			continue;
+		}
+
+		float blend = weight_in * ((pass == 0) ? 1.0f - alpha : alpha);
+		for (flatbuffers::uoffset_t i = 0; i < sample_opacities->size(); i++)
+		{
+			auto cur_opacity = sample_opacities->Get(i);
+			int region_index = GetRegionIndex(cur_opacity->region_index(), cur_opacity->name());
+			if (region_index >= 0)
+			{
+				pose_io.region_opacities[region_index] += blend * (cur_opacity->opacity() - 100.0f);
+			}
+		}
+	}
+}
+
+void
+FlatDataPoseSampler::SampleDeltaMeshes(const CreatureFlatData::animationMeshList * list_in,
+	size_t sample_index, size_t next_index, float alpha,
+	bool blend_in, float weight_in, bool set_flags, FlatDataPose& pose_io) const
+{
+	auto time_samples = list_in->timeSamples();
+	auto sample_meshes = time_samples->Get((flatbuffers::uoffset_t)sample_index)->meshes();
+	size_t point_values = pose_io.local_displacements.size();
+	if (!sample_meshes || (pose_io.delta_displacements_q.size() < point_values * 4))
+	{
+		return;
+	}
+
+	if (alpha <= 0.0f)
+	{
+		next_index = sample_index;
+	}
+
+	// Rebuilds the quantized displacements of both samples a row at a time, from the key
+	// row up, into the local start, local end, post start and post end quarters of the
+	// scratch, each laid out like the pose's displacements
+	size_t delta_interval = (size_t)list_in->delta_interval();
+	uint16_t * rebuilt_q = pose_io.delta_displacements_q.data();
+	for (size_t r = sample_index - sample_index % delta_interval; r <= next_index; r++)
+	{
+		auto row_meshes = time_samples->Get((flatbuffers::uoffset_t)r)->meshes();
+		if (!row_meshes)
+		{
+			return;
+		}
+
+		bool is_key = (r % delta_interval == 0);
+		bool is_end = (r > sample_index);
+		for (flatbuffers::uoffset_t i = 0; i < row_meshes->size(); i++)
+		{
+			auto cur_mesh = row_meshes->Get(i);
+			int region_index = GetRegionIndex(cur_mesh->region_index(), cur_mesh->name());
+			if (region_index < 0)
+			{
+				continue;
+			}
+
+			size_t write_start = (size_t)region_starts[region_index] * 2;
+			size_t write_count = (size_t)region_counts[region_index] * 2;
+			for (int pass = 0; pass < 2; pass++)
+			{
+				auto read_row = (pass == 0) ? cur_mesh->local_displacements_q() : cur_mesh->post_displacements_q();
+				if (!read_row)
+				{
+					continue;
+				}
+
+				size_t read_count = std::min((size_t)read_row->size(), write_count);
+				uint16_t * start_q = rebuilt_q + pass * 2 * point_values + write_start;
+				uint16_t * write_q = is_end ? start_q + point_values : start_q;
+				if (is_key)
+				{
+					memcpy(write_q, read_row->data(), read_count * sizeof(uint16_t));
+				}
+				else
+				{
+					if (is_end)
+					{
+						memcpy(write_q, start_q, read_count * sizeof(uint16_t));
+					}
+
+					ApplyDelta(write_q, read_row->data(), read_count);
+				}
+			}
+		}
+	}
+
+	float * scratch_values = pose_io.scratch.data();
+	for (flatbuffers::uoffset_t i = 0; i < sample_meshes->size(); i++)
+	{
+		auto cur_mesh = sample_meshes->Get(i);
+		int region_index = GetRegionIndex(cur_mesh->region_index(), cur_mesh->name());
+		if (region_index < 0)
+		{
+			continue;
+		}
+
+		if (set_flags)
+		{
+			pose_io.region_use_dq[region_index] = cur_mesh->use_dq() ? 1 : 0;
+			pose_io.region_use_local_displacements[region_index] = cur_mesh->use_local_displacements() ? 1 : 0;
+			pose_io.region_use_post_displacements[region_index] = cur_mesh->use_post_displacements() ? 1 : 0;
+		}
+
+		size_t write_start = (size_t)region_starts[region_index] * 2;
+		size_t write_count = (size_t)region_counts[region_index] * 2;
+		for (int pass = 0; pass < 2; pass++)
+		{
+			auto read_row = (pass == 0) ? cur_mesh->local_displacements_q() : cur_mesh->post_displacements_q();
+			if (!read_row)
+			{
+				continue;
+			}
+
+			auto range_min = (pass == 0) ? list_in->local_range_min() : list_in->post_range_min();
+			auto range_extent = (pass == 0) ? list_in->local_range_extent() : list_in->post_range_extent();
+			float * write_values = ((pass == 0) ? pose_io.local_displacements.data() : pose_io.post_displacements.data()) + write_start;
+			const uint16_t * start_q = rebuilt_q + pass * 2 * point_values + write_start;
+			const uint16_t * end_q = start_q + point_values;
+			size_t read_count = std::min((size_t)read_row->size(), write_count);
+			float * decode_values = blend_in ? scratch_values : write_values;
+
+			if (!DequantizeDisplacements(start_q, read_count, range_min, range_extent, list_in->quantize_bits(),
+				region_index, decode_values))
+			{
+				continue;
+			}
+
+			if (blend_in)
+			{
+				AccumulateScaled(write_values, scratch_values, read_count, weight_in * (1.0f - alpha));
+			}
+
+			if (next_index != sample_index)
+			{
+				DequantizeDisplacements(end_q, read_count, range_min, range_extent, list_in->quantize_bits(),
+					region_index, scratch_values);
+				if (blend_in)
+				{
+					AccumulateScaled(write_values, scratch_values, read_count, weight_in * alpha);
+				}
+				else
+				{
+					LerpValues(write_values, scratch_values, read_count, alpha);
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,151 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <CreatureFlatData_generated.h>
+
+// UV swap state of a mesh region
+struct FlatDataUVSwap
+{
+	float local_offset[2];
+	float global_offset[2];
+	float scale[2];
+	bool enabled;
+};
+
+// A sampled pose of one character, sized once for its rootData by Init and then
+// filled by FlatDataPoseSampler::Sample without allocating
+struct FlatDataPose
+{
+	FlatDataPose();
+
+	// Sizes every buffer for root_in
+	void Init(const CreatureFlatData::rootData * root_in);
+
+	// bone count x (start_pt x, y, end_pt x, y), ordered by skeleton.bones index
+	std::vector<float> bone_positions;
+
+	// mesh point count x 2 each, a region's displacements starting at its start_pt_index * 2.
+	// Only meaningful for regions whose use flag below is set.
+	std::vector<float> local_displacements;
+	std::vector<float> post_displacements;
+
+	// Per mesh.regions index
+	std::vector<uint8_t> region_use_dq;
+	std::vector<uint8_t> region_use_local_displacements;
+	std::vector<uint8_t> region_use_post_displacements;
+	std::vector<float> region_opacities;
+	std::vector<FlatDataUVSwap> region_uv_swaps;
+
+	// Decoding space for one region's displacements, the largest region's point count x 2
+	std::vector<float> scratch;
+
+	// Space to rebuild the two bracketing rows of a delta encoded bones track
+	std::vector<float> delta_rows;
+	std::vector<uint16_t> delta_rows_q;
+
+	// Space to rebuild the quantized local and post displacements of the two bracketing
+	// samples of a delta encoded mesh list, mesh point count x 2 x 4
+	std::vector<uint16_t> delta_displacements_q;
+
+	// bone count x (cos, sin, tx, ty), the rigid rest to posed transform of each bone
+	// filled in by FlatDataSkinMesh: x' = cos * x - sin * y + tx, y' = sin * x + cos * y + ty
+	std::vector<float> bone_transforms;
+
+	// bone count x (real w, real z, dual x, dual y), the same transforms as the nonzero
+	// terms of unit dual quaternions rotating about z, filled in by FlatDataSkinMesh
+	std::vector<float> bone_dual_quats;
+};
+
+// One clip of a blend, playing clip_index at time and weighted against the other clips
+struct FlatDataClipBlend
+{
+	int clip_index;
+	float time;
+	float weight;
+};
+
+// Evaluates the clips of a Creature FlatData file at fractional times. The time samples
+// bracketing a time are found by binary search and interpolated linearly: bone positions,
+// displacements and opacities blend, uv swaps hold the earlier sample. Reads every
+// layout the converter writes: name or index keyed samples, bone lists or dense bone
+// tracks, dense, sparse or quantized displacements, and delta encoded rows, which are
+// rebuilt from their key row so sampling any time reads at most delta_interval rows.
+// Sample only reads root_in and pose_io, so one sampler can serve many threads.
+class FlatDataPoseSampler
+{
+public:
+	FlatDataPoseSampler(const CreatureFlatData::rootData * root_in);
+
+	int GetClipCount() const;
+
+	// First and last sample times of a clip, false if it has no samples
+	bool GetClipTimeRange(int clip_index, int& start_time_out, int& end_time_out) const;
+
+	bool GetClipTimeRange(const CreatureFlatData::animationClip * clip_in,
+		int& start_time_out, int& end_time_out) const;
+
+	// Samples the clip at time_in into pose_io, which must have been Init for this rootData.
+	// Times outside the clip clamp to its first or last sample. Bones the clip does not
+	// animate keep the values already in pose_io.
+	bool Sample(int clip_index, float time_in, FlatDataPose& pose_io) const;
+
+	// Samples a clip from outside rootData, such as one loaded by FlatDataClipLoader,
+	// whose samples reference the bones and regions of this sampler's rootData
+	bool Sample(const CreatureFlatData::animationClip * clip_in, float time_in, FlatDataPose& pose_io) const;
+
+	// Samples clip_count weighted clips into pose_io in one pass, adding each clip's two
+	// bracketing samples straight into the pose instead of sampling a pose per clip and
+	// mixing them. Weights are normalized to sum to 1. Bones and displacements a clip does
+	// not animate add nothing from it. Region flags and uv swaps come from the heaviest clip.
+	bool SampleBlend(const FlatDataClipBlend * clips_in, int clip_count, FlatDataPose& pose_io) const;
+
+private:
+	// Clears the region flags, opacities and uv swaps before a sample
+	void ResetRegionState(FlatDataPose& pose_io) const;
+
+	void SampleBonesTrack(const CreatureFlatData::animationBonesTrack * track_in,
+		float time_in, FlatDataPose& pose_io) const;
+
+	void SampleBonesList(const CreatureFlatData::animationBonesList * list_in,
+		float time_in, FlatDataPose& pose_io) const;
+
+	void SampleMeshes(const CreatureFlatData::animationMeshList * list_in,
+		float time_in, FlatDataPose& pose_io) const;
+
+	void SampleUVSwaps(const CreatureFlatData::animationUVSwapList * list_in,
+		float time_in, FlatDataPose& pose_io) const;
+
+	void SampleOpacities(const CreatureFlatData::animationMeshOpacityList * list_in,
+		float time_in, FlatDataPose& pose_io) const;
+
+	// Blend passes add weight_in times the clip sampled at time_in to pose_io
+	void BlendBonesTrack(const CreatureFlatData::animationBonesTrack * track_in,
+		float time_in, float weight_in, FlatDataPose& pose_io) const;
+
+	void BlendBonesList(const CreatureFlatData::animationBonesList * list_in,
+		float time_in, float weight_in, FlatDataPose& pose_io) const;
+
+	void BlendMeshes(const CreatureFlatData::animationMeshList * list_in,
+		float time_in, float weight_in, bool set_flags, FlatDataPose& pose_io) const;
+
+	void BlendOpacities(const CreatureFlatData::animationMeshOpacityList * list_in,
+		float time_in, float weight_in, FlatDataPose& pose_io) const;
+
+	// Samples a delta encoded mesh list between the bracketing samples sample_index and
+	// next_index into pose_io, or with blend_in adds weight_in times the sample
+	void SampleDeltaMeshes(const CreatureFlatData::animationMeshList * list_in,
+		size_t sample_index, size_t next_index, float alpha,
+		bool blend_in, float weight_in, bool set_flags, FlatDataPose& pose_io) const;
+
+	// Index a sample refers to, looking its name up for samples keyed by name
+	int GetBoneIndex(const CreatureFlatData::animationBone * bone_in) const;
+
+	int GetRegionIndex(int region_index, const flatbuffers::String * name_in) const;
+
+	const CreatureFlatData::rootData * root_data;
+	int bone_count;
+
+	// Start point and point count of each mesh region
+	std::vector<int> region_starts, region_counts;
+};
@@ -0,0 +1,176 @@
+#include <cmath>
+#include <algorithm>
+#include <iostream>
+#include <FlatDataPoseCache.h>
+
+FlatDataPoseCache::FlatDataPoseCache(const CreatureFlatData::rootData * root_in, size_t memory_limit_bytes_in,
+	int steps_per_frame_in, bool skin_points_in)
+	: root_data(root_in),
+	sampler(root_in),
+	skin_points(false),
+	steps_per_frame(std::max(steps_per_frame_in, 1)),
+	memory_limit_bytes(memory_limit_bytes_in),
+	memory_used(0),
+	hit_count(0),
+	miss_count(0),
+	eviction_count(0)
+{
+	skin_points = skin_points_in && skin_mesh.Init(root_in);
+}
+
+uint64_t
+FlatDataPoseCache::MakeKey(int clip_index, int time_step)
+{
+	return ((uint64_t)(uint32_t)clip_index << 32) | (uint64_t)(uint32_t)time_step;
+}
+
+size_t
+FlatDataPoseCache::GetEntryBytes(const FlatDataCachedPose& pose_in) const
+{
+	// Map node, list node and shared pointer control block are counted as a flat overhead
+	return sizeof(FlatDataCachedPose) + 64
+		+ (pose_in.bone_positions.capacity() + pose_in.points.capacity()) * sizeof(float);
+}
+
+float
+FlatDataPoseCache::QuantizeTime(float time_in) const
+{
+	return std::floor(time_in * (float)steps_per_frame + 0.5f) / (float)steps_per_frame;
+}
+
+std::shared_ptr<const FlatDataCachedPose>
+FlatDataPoseCache::Get(int clip_index, float time_in)
+{
+	if ((clip_index < 0) || (clip_index >= sampler.GetClipCount()))
+	{
+		return nullptr;
+	}
+
+	int time_step = (int)std::floor(time_in * (float)steps_per_frame + 0.5f);
+	uint64_t cur_key = MakeKey(clip_index, time_step);
+
+	std::unique_ptr<FlatDataPose> sample_pose;
+	{
+		std::lock_guard<std::mutex> cache_guard(cache_lock);
+		auto find_itr = entries.find(cur_key);
+		if (find_itr != entries.end())
+		{
+			use_order.splice(use_order.begin(), use_order, find_itr->second.use_itr);
+			hit_count++;
+			return find_itr->second.pose;
+		}
+
+		if (!free_poses.empty())
+		{
+			sample_pose = std::move(free_poses.back());
+			free_poses.pop_back();
+		}
+	}
+
+	// Sampled outside the lock so one miss does not hold up every other thread's hits
+	miss_count++;
+	if (!sample_pose)
+	{
+		sample_pose.reset(new FlatDataPose());
+		sample_pose->Init(root_data);
+	}
+
+	std::shared_ptr<FlatDataCachedPose> new_pose(new FlatDataCachedPose());
+	new_pose->clip_index = clip_index;
+	new_pose->time = (float)time_step / (float)steps_per_frame;
+
+	std::fill(sample_pose->bone_positions.begin(), sample_pose->bone_positions.end(), 0.0f);
+	sampler.Sample(clip_index, new_pose->time, *sample_pose);
+	new_pose->bone_positions = sample_pose->bone_positions;
+	if (skin_points)
+	{
+		new_pose->points.assign(skin_mesh.GetPointCount() * 2, 0.0f);
+		skin_mesh.Skin(*sample_pose, new_pose->points.data());
+	}
+
+	size_t entry_bytes = GetEntryBytes(*new_pose);
+
+	std::lock_guard<std::mutex> cache_guard(cache_lock);
+	free_poses.push_back(std::move(sample_pose));
+
+	// Another thread may have filled the same key while this one sampled
+	auto find_itr = entries.find(cur_key);
+	if (find_itr != entries.end())
+	{
+		return find_itr->second.pose;
+	}
+
+	// Entries larger than the whole cache are handed out without being kept
+	if (entry_bytes > memory_limit_bytes)
+	{
+		return new_pose;
+	}
+
+	while (!use_order.empty() && (memory_used + entry_bytes > memory_limit_bytes))
+	{
+		auto evict_itr = entries.find(use_order.back());
+		memory_used -= GetEntryBytes(*evict_itr->second.pose);
+		entries.erase(evict_itr);
+		use_order.pop_back();
+		eviction_count++;
+	}
+
+	use_order.push_front(cur_key);
+	CacheEntry& new_entry = entries[cur_key];
+	new_entry.pose = new_pose;
+	new_entry.use_itr = use_order.begin();
+	memory_used += entry_bytes;
+
+	return new_pose;
+}
+
+bool
+FlatDataPoseCache::IsSkinning() const
+{
+	return skin_points;
+}
+
+void
+FlatDataPoseCache::Clear()
+{
+	std::lock_guard<std::mutex> cache_guard(cache_lock);
+	entries.clear();
+	use_order.clear();
+	memory_used = 0;
+}
+
+int
+FlatDataPoseCache::GetHitCount() const
+{
+	return hit_count;
+}
+
+int
+FlatDataPoseCache::GetMissCount() const
+{
+	return miss_count;
+}
+
+size_t
+FlatDataPoseCache::GetMemoryUsed() const
+{
+	std::lock_guard<std::mutex> cache_guard(cache_lock);
+	return memory_used;
+}
+
+void
+FlatDataPoseCache::PrintStats() const
+{
+	size_t entry_count = 0, cur_memory_used = 0;
+	{
+		std::lock_guard<std::mutex> cache_guard(cache_lock);
+		entry_count = entries.size();
+		cur_memory_used = memory_used;
+	}
+
+	int lookup_count = hit_count + miss_count;
+	std::cout << "Pose cache: " << hit_count << " hits, " << miss_count << " misses ("
+		<< (lookup_count > 0 ? 100 * (long long)hit_count / lookup_count : 0) << "% hit rate), "
+		<< eviction_count << " evictions, " << entry_count << " entries using "
+		<< cur_memory_used / 1024 << " of " << memory_limit_bytes / 1024 << " KB" << std::endl;
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <list>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <atomic>
+#include <cstdint>
+#include <unordered_map>
+#include <CreatureFlatData_generated.h>
+#include <FlatDataPose.h>
+#include <FlatDataSkinning.h>
+
+// A cached evaluation of one clip at one quantized time. points is empty unless the
+// cache skins, otherwise laid out as FlatDataSkinMesh::Skin writes them.
+struct FlatDataCachedPose
+{
+	int clip_index;
+	float time;
+	std::vector<float> bone_positions;
+	std::vector<float> points;
+};
+
+// A least recently used cache of sampled, and optionally skinned, poses keyed by
+// (clip index, time quantized to steps_per_frame steps per frame), for crowds playing
+// the same clips at the same frames. Entries are shared read only: Get hands out
+// shared pointers, so evicting an entry never invalidates a caller still reading it.
+// The bytes held by entries stay under memory_limit_bytes. Safe to share between threads.
+class FlatDataPoseCache
+{
+public:
+	FlatDataPoseCache(const CreatureFlatData::rootData * root_in, size_t memory_limit_bytes_in,
+		int steps_per_frame_in = 1, bool skin_points_in = false);
+
+	// Returns the pose of clip_index at time_in rounded to the nearest step, sampling
+	// and skinning it on a miss. Returns null for clips the rootData does not have.
+	std::shared_ptr<const FlatDataCachedPose> Get(int clip_index, float time_in);
+
+	// The time an entry for time_in is sampled at
+	float QuantizeTime(float time_in) const;
+
+	// Whether entries carry skinned points
+	bool IsSkinning() const;
+
+	void Clear();
+
+	int GetHitCount() const;
+
+	int GetMissCount() const;
+
+	size_t GetMemoryUsed() const;
+
+	void PrintStats() const;
+
+private:
+	struct CacheEntry
+	{
+		std::shared_ptr<const FlatDataCachedPose> pose;
+		std::list<uint64_t>::iterator use_itr;
+	};
+
+	static uint64_t MakeKey(int clip_index, int time_step);
+
+	size_t GetEntryBytes(const FlatDataCachedPose& pose_in) const;
+
+	const CreatureFlatData::rootData * root_data;
+	FlatDataPoseSampler sampler;
+	FlatDataSkinMesh skin_mesh;
+	bool skin_points;
+	int steps_per_frame;
+	size_t memory_limit_bytes;
+
+	// Everything below is guarded by cache_lock. use_order lists keys most recently used first.
+	mutable std::mutex cache_lock;
+	std::unordered_map<uint64_t, CacheEntry> entries;
+	std::list<uint64_t> use_order;
+	size_t memory_used;
+
+	// Sampling space reused across misses, one per thread missing at once
+	std::vector<std::unique_ptr<FlatDataPose> > free_poses;
+
+	std::atomic<int> hit_count, miss_count, eviction_count;
+};
@@ -0,0 +1,780 @@
+#include <cmath>
+#include <algorithm>
+#include <FlatDataSkinning.h>
+#include <FlatDataLookup.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define FLATDATA_SKIN_HAS_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#if defined(__AVX2__)
+#define FLATDATA_SKIN_HAS_AVX2 1
+#include <immintrin.h>
+
+// -mavx2 alone does not enable FMA, -march=haswell and /arch:AVX2 do
+#if defined(__FMA__) || defined(_MSC_VER)
+#define FLATDATA_SKIN_FMADD(a, b, c) _mm256_fmadd_ps(a, b, c)
+#else
+#define FLATDATA_SKIN_FMADD(a, b, c) _mm256_add_ps(_mm256_mul_ps(a, b), c)
+#endif
+#endif
+
+FlatDataSkinKernel
+GetBestSkinKernel()
+{
+#if defined(FLATDATA_SKIN_HAS_AVX2)
+	return FLATDATA_SKIN_AVX2;
+#elif defined(FLATDATA_SKIN_HAS_SSE2)
+	return FLATDATA_SKIN_SSE2;
+#else
+	return FLATDATA_SKIN_SCALAR;
+#endif
+}
+
+const char *
+GetSkinKernelName(FlatDataSkinKernel kernel_in)
+{
+	switch (kernel_in)
+	{
+	case FLATDATA_SKIN_SSE2:
+		return "sse2";
+	case FLATDATA_SKIN_AVX2:
+		return "avx2";
+	default:
+		return "scalar";
+	}
+}
+
+// ----------- Kernels ----------------------
+// Each kernel skins points [start_pt, end_pt). Influence offsets index bone_transforms
+// and bone_dual_quats alike, both being 4 floats per bone.
+//
+// Dual quaternion kernels blend (real w, real z, dual x, dual y) per point, flipping the
+// sign of influences on the other hemisphere from the heaviest one, then normalize by the
+// squared real length and expand the result back to a rotation and translation:
+// cos = (w^2 - z^2) / n, sin = 2wz / n, tx = 2(xw - yz) / n, ty = 2(xz + yw) / n.
+// Points without influences have n = 0 and, as in linear blending, skin to the origin.
+
+static const float dual_quat_min_norm = 1e-20f;
+
+static void
+SkinLinearBlendScalar(int start_pt, int end_pt, int point_count,
+	const float * rest_x, const float * rest_y,
+	const int * influence_offsets, const float * influence_weights,
+	const float * bone_transforms,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out)
+{
+	for (int i = start_pt; i < end_pt; i++)
+	{
+		float px = rest_x[i], py = rest_y[i];
+		if (local_displacements)
+		{
+			px += local_displacements[i * 2];
+			py += local_displacements[i * 2 + 1];
+		}
+
+		float acc_x = 0.0f, acc_y = 0.0f;
+		for (int k = 0; k < FlatDataSkinMesh::max_influences; k++)
+		{
+			const float * cur_transform = bone_transforms + influence_offsets[k * point_count + i];
+			float cur_weight = influence_weights[k * point_count + i];
+			acc_x += cur_weight * (cur_transform[0] * px - cur_transform[1] * py + cur_transform[2]);
+			acc_y += cur_weight * (cur_transform[1] * px + cur_transform[0] * py + cur_transform[3]);
+		}
+
+		if (post_displacements)
+		{
+			acc_x += post_displacements[i * 2];
+			acc_y += post_displacements[i * 2 + 1];
+		}
+
+		points_out[i * 2] = acc_x;
+		points_out[i * 2 + 1] = acc_y;
+	}
+}
+
+static void
+SkinDualQuatScalar(int start_pt, int end_pt, int point_count,
+	const float * rest_x, const float * rest_y,
+	const int * influence_offsets, const float * influence_weights,
+	const float * bone_dual_quats,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out)
+{
+	for (int i = start_pt; i < end_pt; i++)
+	{
+		float px = rest_x[i], py = rest_y[i];
+		if (local_displacements)
+		{
+			px += local_displacements[i * 2];
+			py += local_displacements[i * 2 + 1];
+		}
+
+		const float * pivot_quat = bone_dual_quats + influence_offsets[i];
+		float acc_w = 0.0f, acc_z = 0.0f, acc_x = 0.0f, acc_y = 0.0f;
+		for (int k = 0; k < FlatDataSkinMesh::max_influences; k++)
+		{
+			const float * cur_quat = bone_dual_quats + influence_offsets[k * point_count + i];
+			float cur_weight = influence_weights[k * point_count + i];
+			if (cur_quat[0] * pivot_quat[0] + cur_quat[1] * pivot_quat[1] < 0.0f)
+			{
+				cur_weight = -cur_weight;
+			}
+
+			acc_w += cur_weight * cur_quat[0];
+			acc_z += cur_weight * cur_quat[1];
+			acc_x += cur_weight * cur_quat[2];
+			acc_y += cur_weight * cur_quat[3];
+		}
+
+		float norm = acc_w * acc_w + acc_z * acc_z;
+		float inv_norm = (norm >= dual_quat_min_norm) ? 1.0f / norm : 0.0f;
+		float cos_angle = (acc_w * acc_w - acc_z * acc_z) * inv_norm;
+		float sin_angle = 2.0f * acc_w * acc_z * inv_norm;
+		float trans_x = 2.0f * (acc_x * acc_w - acc_y * acc_z) * inv_norm;
+		float trans_y = 2.0f * (acc_x * acc_z + acc_y * acc_w) * inv_norm;
+
+		float skin_x = cos_angle * px - sin_angle * py + trans_x;
+		float skin_y = sin_angle * px + cos_angle * py + trans_y;
+		if (post_displacements)
+		{
+			skin_x += post_displacements[i * 2];
+			skin_y += post_displacements[i * 2 + 1];
+		}
+
+		points_out[i * 2] = skin_x;
+		points_out[i * 2 + 1] = skin_y;
+	}
+}
+
+#if defined(FLATDATA_SKIN_HAS_SSE2)
+// Loads the 4 float rows of the bones of points i to i + 3 and transposes them, so
+// row_0 holds element 0 of all four. There is no gather before AVX2.
+static inline void
+LoadBoneRowsSSE2(const float * bone_rows, const int * cur_offsets,
+	__m128& row_0, __m128& row_1, __m128& row_2, __m128& row_3)
+{
+	row_0 = _mm_loadu_ps(bone_rows + cur_offsets[0]);
+	row_1 = _mm_loadu_ps(bone_rows + cur_offsets[1]);
+	row_2 = _mm_loadu_ps(bone_rows + cur_offsets[2]);
+	row_3 = _mm_loadu_ps(bone_rows + cur_offsets[3]);
+	_MM_TRANSPOSE4_PS(row_0, row_1, row_2, row_3);
+}
+
+static int
+SkinLinearBlendSSE2(int start_pt, int end_pt, int point_count,
+	const float * rest_x, const float * rest_y,
+	const int * influence_offsets, const float * influence_weights,
+	const float * bone_transforms,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out)
+{
+	int i = start_pt;
+	for (; i + 4 <= end_pt; i += 4)
+	{
+		__m128 px = _mm_loadu_ps(rest_x + i);
+		__m128 py = _mm_loadu_ps(rest_y + i);
+		if (local_displacements)
+		{
+			__m128 d0 = _mm_loadu_ps(local_displacements + i * 2);
+			__m128 d1 = _mm_loadu_ps(local_displacements + i * 2 + 4);
+			px = _mm_add_ps(px, _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(2, 0, 2, 0)));
+			py = _mm_add_ps(py, _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+
+		__m128 acc_x = _mm_setzero_ps(), acc_y = _mm_setzero_ps();
+		for (int k = 0; k < FlatDataSkinMesh::max_influences; k++)
+		{
+			__m128 t_cos, t_sin, t_x, t_y;
+			LoadBoneRowsSSE2(bone_transforms, influence_offsets + k * point_count + i, t_cos, t_sin, t_x, t_y);
+
+			__m128 cur_weight = _mm_loadu_ps(influence_weights + k * point_count + i);
+			__m128 skin_x = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(t_cos, px), _mm_mul_ps(t_sin, py)), t_x);
+			__m128 skin_y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(t_sin, px), _mm_mul_ps(t_cos, py)), t_y);
+			acc_x = _mm_add_ps(acc_x, _mm_mul_ps(cur_weight, skin_x));
+			acc_y = _mm_add_ps(acc_y, _mm_mul_ps(cur_weight, skin_y));
+		}
+
+		__m128 out_lo = _mm_unpacklo_ps(acc_x, acc_y);
+		__m128 out_hi = _mm_unpackhi_ps(acc_x, acc_y);
+		if (post_displacements)
+		{
+			out_lo = _mm_add_ps(out_lo, _mm_loadu_ps(post_displacements + i * 2));
+			out_hi = _mm_add_ps(out_hi, _mm_loadu_ps(post_displacements + i * 2 + 4));
+		}
+
+		_mm_storeu_ps(points_out + i * 2, out_lo);
+		_mm_storeu_ps(points_out + i * 2 + 4, out_hi);
+	}
+
+	return i;
+}
+
+static int
+SkinDualQuatSSE2(int start_pt, int end_pt, int point_count,
+	const float * rest_x, const float * rest_y,
+	const int * influence_offsets, const float * influence_weights,
+	const float * bone_dual_quats,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out)
+{
+	const __m128 sign_mask = _mm_set1_ps(-0.0f);
+	const __m128 two = _mm_set1_ps(2.0f);
+	const __m128 min_norm = _mm_set1_ps(dual_quat_min_norm);
+	int i = start_pt;
+	for (; i + 4 <= end_pt; i += 4)
+	{
+		__m128 px = _mm_loadu_ps(rest_x + i);
+		__m128 py = _mm_loadu_ps(rest_y + i);
+		if (local_displacements)
+		{
+			__m128 d0 = _mm_loadu_ps(local_displacements + i * 2);
+			__m128 d1 = _mm_loadu_ps(local_displacements + i * 2 + 4);
+			px = _mm_add_ps(px, _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(2, 0, 2, 0)));
+			py = _mm_add_ps(py, _mm_shuffle_ps(d0, d1, _MM_SHUFFLE(3, 1, 3, 1)));
+		}
+
+		__m128 pivot_w, pivot_z, pivot_x, pivot_y;
+		LoadBoneRowsSSE2(bone_dual_quats, influence_offsets + i, pivot_w, pivot_z, pivot_x, pivot_y);
+		__m128 pivot_weight = _mm_loadu_ps(influence_weights + i);
+		__m128 acc_w = _mm_mul_ps(pivot_weight, pivot_w);
+		__m128 acc_z = _mm_mul_ps(pivot_weight, pivot_z);
+		__m128 acc_x = _mm_mul_ps(pivot_weight, pivot_x);
+		__m128 acc_y = _mm_mul_ps(pivot_weight, pivot_y);
+		for (int k = 1; k < FlatDataSkinMesh::max_influences; k++)
+		{
+			__m128 q_w, q_z, q_x, q_y;
+			LoadBoneRowsSSE2(bone_dual_quats, influence_offsets + k * point_count + i, q_w, q_z, q_x, q_y);
+
+			// Moves the sign of the dot with the pivot onto the weight
+			__m128 pivot_dot = _mm_add_ps(_mm_mul_ps(q_w, pivot_w), _mm_mul_ps(q_z, pivot_z));
+			__m128 cur_weight = _mm_xor_ps(_mm_loadu_ps(influence_weights + k * point_count + i),
+				_mm_and_ps(pivot_dot, sign_mask));
+			acc_w = _mm_add_ps(acc_w, _mm_mul_ps(cur_weight, q_w));
+			acc_z = _mm_add_ps(acc_z, _mm_mul_ps(cur_weight, q_z));
+			acc_x = _mm_add_ps(acc_x, _mm_mul_ps(cur_weight, q_x));
+			acc_y = _mm_add_ps(acc_y, _mm_mul_ps(cur_weight, q_y));
+		}
+
+		__m128 norm = _mm_add_ps(_mm_mul_ps(acc_w, acc_w), _mm_mul_ps(acc_z, acc_z));
+		__m128 has_norm = _mm_cmpge_ps(norm, min_norm);
+		__m128 inv_norm = _mm_and_ps(_mm_div_ps(_mm_set1_ps(1.0f), _mm_max_ps(norm, min_norm)), has_norm);
+		__m128 two_inv_norm = _mm_mul_ps(two, inv_norm);
+		__m128 cos_angle = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(acc_w, acc_w), _mm_mul_ps(acc_z, acc_z)), inv_norm);
+		__m128 sin_angle = _mm_mul_ps(_mm_mul_ps(acc_w, acc_z), two_inv_norm);
+		__m128 trans_x = _mm_mul_ps(_mm_sub_ps(_mm_mul_ps(acc_x, acc_w), _mm_mul_ps(acc_y, acc_z)), two_inv_norm);
+		__m128 trans_y = _mm_mul_ps(_mm_add_ps(_mm_mul_ps(acc_x, acc_z), _mm_mul_ps(acc_y, acc_w)), two_inv_norm);
+
+		__m128 skin_x = _mm_add_ps(_mm_sub_ps(_mm_mul_ps(cos_angle, px), _mm_mul_ps(sin_angle, py)), trans_x);
+		__m128 skin_y = _mm_add_ps(_mm_add_ps(_mm_mul_ps(sin_angle, px), _mm_mul_ps(cos_angle, py)), trans_y);
+
+		__m128 out_lo = _mm_unpacklo_ps(skin_x, skin_y);
+		__m128 out_hi = _mm_unpackhi_ps(skin_x, skin_y);
+		if (post_displacements)
+		{
+			out_lo = _mm_add_ps(out_lo, _mm_loadu_ps(post_displacements + i * 2));
+			out_hi = _mm_add_ps(out_hi, _mm_loadu_ps(post_displacements + i * 2 + 4));
+		}
+
+		_mm_storeu_ps(points_out + i * 2, out_lo);
+		_mm_storeu_ps(points_out + i * 2 + 4, out_hi);
+	}
+
+	return i;
+}
+#endif
+
+#if defined(FLATDATA_SKIN_HAS_AVX2)
+// Loads the 4 float rows of the bones of points i to i + 7 and transposes them.
+// Gathers are microcoded and slow on many cores, so the rows of points j and j + 4
+// are loaded into the two lanes of one register instead.
+static inline void
+LoadBoneRowsAVX2(const float * bone_rows, const int * cur_offsets,
+	__m256& row_0, __m256& row_1, __m256& row_2, __m256& row_3)
+{
+	__m256 rows[4];
+	for (int j = 0; j < 4; j++)
+	{
+		rows[j] = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(bone_rows + cur_offsets[j])),
+			_mm_loadu_ps(bone_rows + cur_offsets[j + 4]), 1);
+	}
+
+	__m256 rows_01_lo = _mm256_unpacklo_ps(rows[0], rows[1]);
+	__m256 rows_23_lo = _mm256_unpacklo_ps(rows[2], rows[3]);
+	__m256 rows_01_hi = _mm256_unpackhi_ps(rows[0], rows[1]);
+	__m256 rows_23_hi = _mm256_unpackhi_ps(rows[2], rows[3]);
+	row_0 = _mm256_shuffle_ps(rows_01_lo, rows_23_lo, _MM_SHUFFLE(1, 0, 1, 0));
+	row_1 = _mm256_shuffle_ps(rows_01_lo, rows_23_lo, _MM_SHUFFLE(3, 2, 3, 2));
+	row_2 = _mm256_shuffle_ps(rows_01_hi, rows_23_hi, _MM_SHUFFLE(1, 0, 1, 0));
+	row_3 = _mm256_shuffle_ps(rows_01_hi, rows_23_hi, _MM_SHUFFLE(3, 2, 3, 2));
+}
+
+// Deinterleaves 8 x, y pairs into x and y registers
+static inline void
+LoadPairsAVX2(const float * pairs_in, __m256& x_out, __m256& y_out)
+{
+	__m256 d0 = _mm256_loadu_ps(pairs_in);
+	__m256 d1 = _mm256_loadu_ps(pairs_in + 8);
+	__m256 t0 = _mm256_permute2f128_ps(d0, d1, 0x20);
+	__m256 t1 = _mm256_permute2f128_ps(d0, d1, 0x31);
+	x_out = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(2, 0, 2, 0));
+	y_out = _mm256_shuffle_ps(t0, t1, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+// Interleaves x and y back into 8 pairs, adding post displacements when given
+static inline void
+StorePairsAVX2(__m256 x_in, __m256 y_in, const float * post_displacements, float * pairs_out)
+{
+	__m256 pair_lo = _mm256_unpacklo_ps(x_in, y_in);
+	__m256 pair_hi = _mm256_unpackhi_ps(x_in, y_in);
+	__m256 out_0 = _mm256_permute2f128_ps(pair_lo, pair_hi, 0x20);
+	__m256 out_1 = _mm256_permute2f128_ps(pair_lo, pair_hi, 0x31);
+	if (post_displacements)
+	{
+		out_0 = _mm256_add_ps(out_0, _mm256_loadu_ps(post_displacements));
+		out_1 = _mm256_add_ps(out_1, _mm256_loadu_ps(post_displacements + 8));
+	}
+
+	_mm256_storeu_ps(pairs_out, out_0);
+	_mm256_storeu_ps(pairs_out + 8, out_1);
+}
+
+static int
+SkinLinearBlendAVX2(int start_pt, int end_pt, int point_count,
+	const float * rest_x, const float * rest_y,
+	const int * influence_offsets, const float * influence_weights,
+	const float * bone_transforms,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out)
+{
+	int i = start_pt;
+	for (; i + 8 <= end_pt; i += 8)
+	{
+		__m256 px = _mm256_loadu_ps(rest_x + i);
+		__m256 py = _mm256_loadu_ps(rest_y + i);
+		if (local_displacements)
+		{
+			__m256 local_x, local_y;
+			LoadPairsAVX2(local_displacements + i * 2, local_x, local_y);
+			px = _mm256_add_ps(px, local_x);
+			py = _mm256_add_ps(py, local_y);
+		}
+
+		__m256 acc_x = _mm256_setzero_ps(), acc_y = _mm256_setzero_ps();
+		for (int k = 0; k < FlatDataSkinMesh::max_influences; k++)
+		{
+			__m256 t_cos, t_sin, t_x, t_y;
+			LoadBoneRowsAVX2(bone_transforms, influence_offsets + k * point_count + i, t_cos, t_sin, t_x, t_y);
+
+			__m256 cur_weight = _mm256_loadu_ps(influence_weights + k * point_count + i);
+			__m256 skin_x = FLATDATA_SKIN_FMADD(t_cos, px, _mm256_sub_ps(t_x, _mm256_mul_ps(t_sin, py)));
+			__m256 skin_y = FLATDATA_SKIN_FMADD(t_sin, px, FLATDATA_SKIN_FMADD(t_cos, py, t_y));
+			acc_x = FLATDATA_SKIN_FMADD(cur_weight, skin_x, acc_x);
+			acc_y = FLATDATA_SKIN_FMADD(cur_weight, skin_y, acc_y);
+		}
+
+		StorePairsAVX2(acc_x, acc_y, post_displacements ? post_displacements + i * 2 : nullptr, points_out + i * 2);
+	}
+
+	return i;
+}
+
+static int
+SkinDualQuatAVX2(int start_pt, int end_pt, int point_count,
+	const float * rest_x, const float * rest_y,
+	const int * influence_offsets, const float * influence_weights,
+	const float * bone_dual_quats,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out)
+{
+	const __m256 sign_mask = _mm256_set1_ps(-0.0f);
+	const __m256 two = _mm256_set1_ps(2.0f);
+	const __m256 min_norm = _mm256_set1_ps(dual_quat_min_norm);
+	int i = start_pt;
+	for (; i + 8 <= end_pt; i += 8)
+	{
+		__m256 px = _mm256_loadu_ps(rest_x + i);
+		__m256 py = _mm256_loadu_ps(rest_y + i);
+		if (local_displacements)
+		{
+			__m256 local_x, local_y;
+			LoadPairsAVX2(local_displacements + i * 2, local_x, local_y);
+			px = _mm256_add_ps(px, local_x);
+			py = _mm256_add_ps(py, local_y);
+		}
+
+		__m256 pivot_w, pivot_z, pivot_x, pivot_y;
+		LoadBoneRowsAVX2(bone_dual_quats, influence_offsets + i, pivot_w, pivot_z, pivot_x, pivot_y);
+		__m256 pivot_weight = _mm256_loadu_ps(influence_weights + i);
+		__m256 acc_w = _mm256_mul_ps(pivot_weight, pivot_w);
+		__m256 acc_z = _mm256_mul_ps(pivot_weight, pivot_z);
+		__m256 acc_x = _mm256_mul_ps(pivot_weight, pivot_x);
+		__m256 acc_y = _mm256_mul_ps(pivot_weight, pivot_y);
+		for (int k = 1; k < FlatDataSkinMesh::max_influences; k++)
+		{
+			__m256 q_w, q_z, q_x, q_y;
+			LoadBoneRowsAVX2(bone_dual_quats, influence_offsets + k * point_count + i, q_w, q_z, q_x, q_y);
+
+			// Moves the sign of the dot with the pivot onto the weight
+			__m256 pivot_dot = FLATDATA_SKIN_FMADD(q_w, pivot_w, _mm256_mul_ps(q_z, pivot_z));
+			__m256 cur_weight = _mm256_xor_ps(_mm256_loadu_ps(influence_weights + k * point_count + i),
+				_mm256_and_ps(pivot_dot, sign_mask));
+			acc_w = FLATDATA_SKIN_FMADD(cur_weight, q_w, acc_w);
+			acc_z = FLATDATA_SKIN_FMADD(cur_weight, q_z, acc_z);
+			acc_x = FLATDATA_SKIN_FMADD(cur_weight, q_x, acc_x);
+			acc_y = FLATDATA_SKIN_FMADD(cur_weight, q_y, acc_y);
+		}
+
+		__m256 norm = FLATDATA_SKIN_FMADD(acc_w, acc_w, _mm256_mul_ps(acc_z, acc_z));
+		__m256 has_norm = _mm256_cmp_ps(norm, min_norm, _CMP_GE_OQ);
+		__m256 inv_norm = _mm256_and_ps(_mm256_div_ps(_mm256_set1_ps(1.0f), _mm256_max_ps(norm, min_norm)), has_norm);
+		__m256 two_inv_norm = _mm256_mul_ps(two, inv_norm);
+		__m256 cos_angle = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(acc_w, acc_w), _mm256_mul_ps(acc_z, acc_z)), inv_norm);
+		__m256 sin_angle = _mm256_mul_ps(_mm256_mul_ps(acc_w, acc_z), two_inv_norm);
+		__m256 trans_x = _mm256_mul_ps(_mm256_sub_ps(_mm256_mul_ps(acc_x, acc_w), _mm256_mul_ps(acc_y, acc_z)), two_inv_norm);
+		__m256 trans_y = _mm256_mul_ps(FLATDATA_SKIN_FMADD(acc_x, acc_z, _mm256_mul_ps(acc_y, acc_w)), two_inv_norm);
+
+		__m256 skin_x = FLATDATA_SKIN_FMADD(cos_angle, px, _mm256_sub_ps(trans_x, _mm256_mul_ps(sin_angle, py)));
+		__m256 skin_y = FLATDATA_SKIN_FMADD(sin_angle, px, FLATDATA_SKIN_FMADD(cos_angle, py, trans_y));
+		StorePairsAVX2(skin_x, skin_y, post_displacements ? post_displacements + i * 2 : nullptr, points_out + i * 2);
+	}
+
+	return i;
+}
+#endif
+
+// ----------- Skin Mesh ----------------------
+
+FlatDataSkinMesh::FlatDataSkinMesh()
+	: point_count(0),
+	bone_count(0),
+	truncated_count(0)
+{
+}
+
+bool
+FlatDataSkinMesh::Init(const CreatureFlatData::rootData * root_in)
+{
+	auto mesh_data = root_in->dataMesh();
+	auto skeleton_data = root_in->dataSkeleton();
+	if (!mesh_data || !mesh_data->points() || !mesh_data->regions()
+		|| !skeleton_data || !skeleton_data->bones() || (skeleton_data->bones()->size() == 0))
+	{
+		return false;
+	}
+
+	point_count = (int)(mesh_data->points()->size() / 2);
+	bone_count = (int)skeleton_data->bones()->size();
+	truncated_count = 0;
+
+	rest_x.resize(point_count);
+	rest_y.resize(point_count);
+	for (int i = 0; i < point_count; i++)
+	{
+		rest_x[i] = mesh_data->points()->Get(i * 2);
+		rest_y[i] = mesh_data->points()->Get(i * 2 + 1);
+	}
+
+	// Rest bones in world space: restParentMat is a column major 4x4 applied to the local points
+	rest_bones.assign(bone_count * 4, 0.0f);
+	for (int b = 0; b < bone_count; b++)
+	{
+		auto cur_bone = skeleton_data->bones()->Get(b);
+		auto parent_mat = cur_bone->restParentMat();
+		auto local_start = cur_bone->localRestStartPt();
+		auto local_end = cur_bone->localRestEndPt();
+		float world_pts[4] = { 0.0f, 0.0f, 1.0f, 0.0f };
+
+		const flatbuffers::Vector<float> * local_pts[2] = { local_start, local_end };
+		for (int p = 0; p < 2; p++)
+		{
+			if (!local_pts[p] || (local_pts[p]->size() < 2))
+			{
+				continue;
+			}
+
+			float lx = local_pts[p]->Get(0), ly = local_pts[p]->Get(1);
+			if (parent_mat && (parent_mat->size() >= 16))
+			{
+				world_pts[p * 2] = parent_mat->Get(0) * lx + parent_mat->Get(4) * ly + parent_mat->Get(12);
+				world_pts[p * 2 + 1] = parent_mat->Get(1) * lx + parent_mat->Get(5) * ly + parent_mat->Get(13);
+			}
+			else
+			{
+				world_pts[p * 2] = lx;
+				world_pts[p * 2 + 1] = ly;
+			}
+		}
+
+		float dir_x = world_pts[2] - world_pts[0], dir_y = world_pts[3] - world_pts[1];
+		float dir_length = std::sqrt(dir_x * dir_x + dir_y * dir_y);
+		rest_bones[b * 4] = world_pts[0];
+		rest_bones[b * 4 + 1] = world_pts[1];
+		rest_bones[b * 4 + 2] = (dir_length > 0.0f) ? dir_x / dir_length : 1.0f;
+		rest_bones[b * 4 + 3] = (dir_length > 0.0f) ? dir_y / dir_length : 0.0f;
+	}
+
+	// Keep the heaviest influences of each point. Unused slots point at bone 0 with no
+	// weight so kernels never branch. Kept weights are rescaled to the point's total.
+	influence_offsets.assign(max_influences * point_count, 0);
+	influence_weights.assign(max_influences * point_count, 0.0f);
+	std::vector<float> total_weights(point_count, 0.0f);
+	std::vector<int> influence_counts(point_count, 0);
+
+	region_starts.clear();
+	region_counts.clear();
+	for (flatbuffers::uoffset_t r = 0; r < mesh_data->regions()->size(); r++)
+	{
+		auto cur_region = mesh_data->regions()->Get(r);
+		int region_start = std::max(cur_region->start_pt_index(), 0);
+		int region_end = std::min(cur_region->end_pt_index(), point_count - 1);
+		int region_count = std::max(region_end - region_start + 1, 0);
+		region_starts.push_back(region_start);
+		region_counts.push_back(region_count);
+
+		auto region_weights = cur_region->weights();
+		if (!region_weights)
+		{
+			continue;
+		}
+
+		for (flatbuffers::uoffset_t w = 0; w < region_weights->size(); w++)
+		{
+			auto cur_weights = region_weights->Get(w);
+			int bone_index = cur_weights->name() ?
+				FindBoneIndex(skeleton_data, cur_weights->name()->c_str()) : -1;
+			auto weight_values = cur_weights->weights();
+			if ((bone_index < 0) || !weight_values)
+			{
+				continue;
+			}
+
+			int weight_count = std::min((int)weight_values->size(), region_count);
+			for (int k = 0; k < weight_count; k++)
+			{
+				float cur_weight = weight_values->Get(k);
+				int pt_index = region_start + k;
+				if (cur_weight <= 0.0f)
+				{
+					continue;
+				}
+
+				total_weights[pt_index] += cur_weight;
+				influence_counts[pt_index]++;
+
+				// Insert into the point's influences, kept sorted heaviest first
+				int insert_at = std::min(influence_counts[pt_index], (int)max_influences) - 1;
+				if ((influence_counts[pt_index] > max_influences)
+					&& (cur_weight <= influence_weights[(max_influences - 1) * point_count + pt_index]))
+				{
+					continue;
+				}
+
+				while ((insert_at > 0) && (influence_weights[(insert_at - 1) * point_count + pt_index] < cur_weight))
+				{
+					influence_weights[insert_at * point_count + pt_index] = influence_weights[(insert_at - 1) * point_count + pt_index];
+					influence_offsets[insert_at * point_count + pt_index] = influence_offsets[(insert_at - 1) * point_count + pt_index];
+					insert_at--;
+				}
+
+				influence_weights[insert_at * point_count + pt_index] = cur_weight;
+				influence_offsets[insert_at * point_count + pt_index] = bone_index * 4;
+			}
+		}
+	}
+
+	for (int i = 0; i < point_count; i++)
+	{
+		if (influence_counts[i] <= max_influences)
+		{
+			continue;
+		}
+
+		truncated_count++;
+		float kept_weight = 0.0f;
+		for (int k = 0; k < max_influences; k++)
+		{
+			kept_weight += influence_weights[k * point_count + i];
+		}
+
+		for (int k = 0; k < max_influences; k++)
+		{
+			influence_weights[k * point_count + i] *= total_weights[i] / kept_weight;
+		}
+	}
+
+	return true;
+}
+
+int
+FlatDataSkinMesh::GetPointCount() const
+{
+	return point_count;
+}
+
+int
+FlatDataSkinMesh::GetTruncatedPointCount() const
+{
+	return truncated_count;
+}
+
+void
+FlatDataSkinMesh::ComputeBoneTransforms(FlatDataPose& pose_io) const
+{
+	const float * posed_bones = pose_io.bone_positions.data();
+	float * write_transforms = pose_io.bone_transforms.data();
+	float * write_dual_quats = pose_io.bone_dual_quats.data();
+	for (int b = 0; b < bone_count; b++)
+	{
+		const float * rest_bone = &rest_bones[b * 4];
+		const float * posed_bone = posed_bones + b * 4;
+		float dir_x = posed_bone[2] - posed_bone[0], dir_y = posed_bone[3] - posed_bone[1];
+		float dir_length = std::sqrt(dir_x * dir_x + dir_y * dir_y);
+
+		// Rotation taking the rest direction onto the posed one
+		float cos_angle = 1.0f, sin_angle = 0.0f;
+		if (dir_length > 0.0f)
+		{
+			dir_x /= dir_length;
+			dir_y /= dir_length;
+			cos_angle = rest_bone[2] * dir_x + rest_bone[3] * dir_y;
+			sin_angle = rest_bone[2] * dir_y - rest_bone[3] * dir_x;
+		}
+
+		float * cur_transform = write_transforms + b * 4;
+		cur_transform[0] = cos_angle;
+		cur_transform[1] = sin_angle;
+		cur_transform[2] = posed_bone[0] - (cos_angle * rest_bone[0] - sin_angle * rest_bone[1]);
+		cur_transform[3] = posed_bone[1] - (sin_angle * rest_bone[0] + cos_angle * rest_bone[1]);
+
+		// Half angle rotation w + zk, and dual part t q / 2 for the translation t
+		float half_cos = std::sqrt(std::max(0.5f * (1.0f + cos_angle), 0.0f));
+		float half_sin = std::sqrt(std::max(0.5f * (1.0f - cos_angle), 0.0f));
+		half_sin = (sin_angle < 0.0f) ? -half_sin : half_sin;
+		float * cur_quat = write_dual_quats + b * 4;
+		cur_quat[0] = half_cos;
+		cur_quat[1] = half_sin;
+		cur_quat[2] = 0.5f * (cur_transform[2] * half_cos + cur_transform[3] * half_sin);
+		cur_quat[3] = 0.5f * (cur_transform[3] * half_cos - cur_transform[2] * half_sin);
+	}
+}
+
+void
+FlatDataSkinMesh::SkinLinearBlendRange(const FlatDataPose& pose_in, int start_pt, int count,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out, FlatDataSkinKernel kernel_in) const
+{
+	int end_pt = start_pt + count;
+	int next_pt = start_pt;
+
+#if defined(FLATDATA_SKIN_HAS_AVX2)
+	if (kernel_in == FLATDATA_SKIN_AVX2)
+	{
+		next_pt = SkinLinearBlendAVX2(next_pt, end_pt, point_count, rest_x.data(), rest_y.data(),
+			influence_offsets.data(), influence_weights.data(), pose_in.bone_transforms.data(),
+			local_displacements, post_displacements, points_out);
+	}
+#endif
+
+#if defined(FLATDATA_SKIN_HAS_SSE2)
+	if ((kernel_in == FLATDATA_SKIN_SSE2) || (kernel_in == FLATDATA_SKIN_AVX2))
+	{
+		next_pt = SkinLinearBlendSSE2(next_pt, end_pt, point_count, rest_x.data(), rest_y.data(),
+			influence_offsets.data(), influence_weights.data(), pose_in.bone_transforms.data(),
+			local_displacements, post_displacements, points_out);
+	}
+#endif
+
+	SkinLinearBlendScalar(next_pt, end_pt, point_count, rest_x.data(), rest_y.data(),
+		influence_offsets.data(), influence_weights.data(), pose_in.bone_transforms.data(),
+		local_displacements, post_displacements, points_out);
+}
+
+void
+FlatDataSkinMesh::SkinDualQuatRange(const FlatDataPose& pose_in, int start_pt, int count,
+	const float * local_displacements, const float * post_displacements,
+	float * points_out, FlatDataSkinKernel kernel_in) const
+{
+	int end_pt = start_pt + count;
+	int next_pt = start_pt;
+
+#if defined(FLATDATA_SKIN_HAS_AVX2)
+	if (kernel_in == FLATDATA_SKIN_AVX2)
+	{
+		next_pt = SkinDualQuatAVX2(next_pt, end_pt, point_count, rest_x.data(), rest_y.data(),
+			influence_offsets.data(), influence_weights.data(), pose_in.bone_dual_quats.data(),
+			local_displacements, post_displacements, points_out);
+	}
+#endif
+
+#if defined(FLATDATA_SKIN_HAS_SSE2)
+	if ((kernel_in == FLATDATA_SKIN_SSE2) || (kernel_in == FLATDATA_SKIN_AVX2))
+	{
+		next_pt = SkinDualQuatSSE2(next_pt, end_pt, point_count, rest_x.data(), rest_y.data(),
+			influence_offsets.data(), influence_weights.data(), pose_in.bone_dual_quats.data(),
+			local_displacements, post_displacements, points_out);
+	}
+#endif
+
+	SkinDualQuatScalar(next_pt, end_pt, point_count, rest_x.data(), rest_y.data(),
+		influence_offsets.data(), influence_weights.data(), pose_in.bone_dual_quats.data(),
+		local_displacements, post_displacements, points_out);
+}
+
+void
+FlatDataSkinMesh::Skin(FlatDataPose& pose_io, float * points_out,
+	FlatDataSkinKernel kernel_in) const
+{
+	SkinRegions(pose_io, points_out, kernel_in, SKIN_AUTHORED);
+}
+
+void
+FlatDataSkinMesh::SkinLinearBlend(FlatDataPose& pose_io, float * points_out,
+	FlatDataSkinKernel kernel_in) const
+{
+	SkinRegions(pose_io, points_out, kernel_in, SKIN_LINEAR_BLEND);
+}
+
+void
+FlatDataSkinMesh::SkinDualQuat(FlatDataPose& pose_io, float * points_out,
+	FlatDataSkinKernel kernel_in) const
+{
+	SkinRegions(pose_io, points_out, kernel_in, SKIN_DUAL_QUAT);
+}
+
+void
+FlatDataSkinMesh::SkinRegions(FlatDataPose& pose_io, float * points_out,
+	FlatDataSkinKernel kernel_in, SkinMethod method_in) const
+{
+	if ((pose_io.bone_transforms.size() != (size_t)bone_count * 4)
+		|| (pose_io.bone_dual_quats.size() != (size_t)bone_count * 4)
+		|| (pose_io.local_displacements.size() != (size_t)point_count * 2))
+	{
+		return;
+	}
+
+	ComputeBoneTransforms(pose_io);
+
+	for (size_t r = 0; r < region_starts.size(); r++)
+	{
+		const float * local_displacements = pose_io.region_use_local_displacements[r] ?
+			pose_io.local_displacements.data() : nullptr;
+		const float * post_displacements = pose_io.region_use_post_displacements[r] ?
+			pose_io.post_displacements.data() : nullptr;
+
+		bool use_dual_quat = (method_in == SKIN_DUAL_QUAT)
+			|| ((method_in == SKIN_AUTHORED) && pose_io.region_use_dq[r]);
+		if (use_dual_quat)
+		{
+			SkinDualQuatRange(pose_io, region_starts[r], region_counts[r],
+				local_displacements, post_displacements, points_out, kernel_in);
+		}
+		else
+		{
+			SkinLinearBlendRange(pose_io, region_starts[r], region_counts[r],
+				local_displacements, post_displacements, points_out, kernel_in);
+		}
+	}
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <vector>
+#include <CreatureFlatData_generated.h>
+#include <FlatDataPose.h>
+
+// Skinning kernels. Requesting a kernel that was not compiled in (SSE2 needs
+// an x86 SSE2 target, AVX2 building with -mavx2 or /arch:AVX2) uses the best
+// one that was.
+enum FlatDataSkinKernel
+{
+	FLATDATA_SKIN_SCALAR,
+	FLATDATA_SKIN_SSE2,
+	FLATDATA_SKIN_AVX2
+};
+
+// Returns the fastest kernel compiled in
+FlatDataSkinKernel GetBestSkinKernel();
+
+// Returns the name of a kernel
+const char * GetSkinKernelName(FlatDataSkinKernel kernel_in);
+
+// Deforms the points of a Creature mesh by a sampled pose. Init reorganizes the per bone
+// weight arrays of mesh.regions into the max_influences heaviest influences of each point,
+// stored as structure of arrays so a kernel reads a run of points with wide loads.
+// Each bone moves points rigidly from its rest pose to its posed start and end points.
+// Regions blend their bones linearly, or as dual quaternions when the pose sets
+// region_use_dq, which keeps joints from collapsing under large rotations.
+// Local displacements are added to the rest points before skinning and post
+// displacements to the skinned points, for the regions whose pose flags ask for them.
+// Skin only reads the mesh, so one FlatDataSkinMesh can serve many threads.
+class FlatDataSkinMesh
+{
+public:
+	static const int max_influences = 4;
+
+	FlatDataSkinMesh();
+
+	bool Init(const CreatureFlatData::rootData * root_in);
+
+	int GetPointCount() const;
+
+	// Fills pose_io.bone_transforms and bone_dual_quats from the posed bone positions
+	void ComputeBoneTransforms(FlatDataPose& pose_io) const;
+
+	// Computes the bone transforms, then writes every deformed point to
+	// points_out as x, y pairs in mesh.points order, each region skinned as authored
+	void Skin(FlatDataPose& pose_io, float * points_out,
+		FlatDataSkinKernel kernel_in = GetBestSkinKernel()) const;
+
+	// As Skin, with every region blended linearly
+	void SkinLinearBlend(FlatDataPose& pose_io, float * points_out,
+		FlatDataSkinKernel kernel_in = GetBestSkinKernel()) const;
+
+	// As Skin, with every region blended as dual quaternions
+	void SkinDualQuat(FlatDataPose& pose_io, float * points_out,
+		FlatDataSkinKernel kernel_in = GetBestSkinKernel()) const;
+
+	// Skins the points [start_pt, start_pt + count) with the transforms already in pose_in
+	void SkinLinearBlendRange(const FlatDataPose& pose_in, int start_pt, int count,
+		const float * local_displacements, const float * post_displacements,
+		float * points_out, FlatDataSkinKernel kernel_in) const;
+
+	void SkinDualQuatRange(const FlatDataPose& pose_in, int start_pt, int count,
+		const float * local_displacements, const float * post_displacements,
+		float * points_out, FlatDataSkinKernel kernel_in) const;
+
+	// Points whose influences past max_influences were dropped when the layout was built
+	int GetTruncatedPointCount() const;
+
+private:
+	enum SkinMethod
+	{
+		SKIN_AUTHORED,
+		SKIN_LINEAR_BLEND,
+		SKIN_DUAL_QUAT
+	};
+
+	void SkinRegions(FlatDataPose& pose_io, float * points_out,
+		FlatDataSkinKernel kernel_in, SkinMethod method_in) const;
+
+	int point_count, bone_count, truncated_count;
+
+	// Rest points as structure of arrays
+	std::vector<float> rest_x, rest_y;
+
+	// max_influences rows of point_count, influence k of point i at [k * point_count + i]
+	std::vector<int> influence_offsets;
+	std::vector<float> influence_weights;
+
+	// Rest start point and unit direction of each bone
+	std::vector<float> rest_bones;
+
+	// Start point and point count of each mesh region
+	std::vector<int> region_starts, region_counts;
+};
@@ -0,0 +1,1347 @@
+#include <iostream>
+#include <fstream>
+#include <cstdio>
+#include <cstdlib>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+#include <FlatDataWriter.h>
+#include <FlatDataCompress.h>
+#include <FlatDataDelta.h>
+
+static std::vector<float>
+GetFloatArray(rapidjson::Value& array_in)
+{
+	std::vector<float> ret_array(array_in.Size());
+	for (int i = 0; i < array_in.Size(); i++)
+	{
+		ret_array[i] = (float)array_in[i].GetDouble();
+	}
+
+	return ret_array;
+}
+
+static std::vector<int>
+GetIntArray(rapidjson::Value& array_in)
+{
+	std::vector<int> ret_array(array_in.Size());
+	for (int i = 0; i < array_in.Size(); i++)
+	{
+		ret_array[i] = (int)array_in[i].GetInt();
+	}
+
+	return ret_array;
+}
+
+// Finds the min and extent of count values spaced stride apart
+static void
+GetRange(const float * values_in, size_t count, size_t stride,
+	float& min_out, float& extent_out)
+{
+	if (count == 0)
+	{
+		min_out = 0.0f;
+		extent_out = 0.0f;
+		return;
+	}
+
+	float min_val = values_in[0], max_val = values_in[0];
+	for (size_t i = 1; i < count; i++)
+	{
+		float cur_val = values_in[i * stride];
+		min_val = std::min(min_val, cur_val);
+		max_val = std::max(max_val, cur_val);
+	}
+
+	min_out = min_val;
+	extent_out = max_val - min_val;
+}
+
+FlatDataWriter::FlatDataWriter(flatbuffers::FlatBufferBuilder& fbb_in,
+	const ConvertFlatDataOptions& options_in)
+	: fbb(fbb_in),
+	format_version(options_in.format_version),
+	dense_bone_tracks(options_in.dense_bone_tracks || (options_in.quantize_bits > 0) || (options_in.delta_interval > 0)),
+	quantize_bits(options_in.quantize_bits),
+	delta_interval(options_in.delta_interval),
+	sparse_displacements(options_in.sparse_displacements && (options_in.format_version >= 2)),
+	warned_missing_index(false),
+	warned_missing_track_bone(false),
+	dense_displacements_count(0),
+	sparse_displacements_count(0),
+	quantized_value_count(0),
+	bones_max_error(0.0f),
+	local_displacements_max_error(0.0f),
+	post_displacements_max_error(0.0f)
+{
+}
+
+FlatDataWriter::FlatDataWriter(flatbuffers::FlatBufferBuilder& fbb_in,
+	const ConvertFlatDataOptions& options_in,
+	const FlatDataWriter& indices_writer)
+	: FlatDataWriter(fbb_in, options_in)
+{
+	bone_indices = indices_writer.bone_indices;
+	region_indices = indices_writer.region_indices;
+}
+
+std::vector<uint16_t>
+FlatDataWriter::Quantize(const std::vector<float>& values_in,
+	float min_in, float extent_in, float& max_error_io)
+{
+	std::vector<uint16_t> ret_values(values_in.size(), 0);
+	quantized_value_count += values_in.size();
+	if (extent_in <= 0.0f)
+	{
+		// A constant range decodes every value to min_in
+		for (size_t i = 0; i < values_in.size(); i++)
+		{
+			max_error_io = std::max(max_error_io, std::fabs(values_in[i] - min_in));
+		}
+
+		return ret_values;
+	}
+
+	float max_q = (float)((1 << quantize_bits) - 1);
+	float step = extent_in / max_q;
+	for (size_t i = 0; i < values_in.size(); i++)
+	{
+		float q = std::floor((values_in[i] - min_in) / extent_in * max_q + 0.5f);
+		q = std::min(std::max(q, 0.0f), max_q);
+
+		ret_values[i] = (uint16_t)q;
+		max_error_io = std::max(max_error_io, std::fabs(min_in + q * step - values_in[i]));
+	}
+
+	return ret_values;
+}
+
+void
+FlatDataWriter::MergeStats(const FlatDataWriter& other_writer)
+{
+	bones_max_error = std::max(bones_max_error, other_writer.bones_max_error);
+	local_displacements_max_error = std::max(local_displacements_max_error, other_writer.local_displacements_max_error);
+	post_displacements_max_error = std::max(post_displacements_max_error, other_writer.post_displacements_max_error);
+	dense_displacements_count += other_writer.dense_displacements_count;
+	sparse_displacements_count += other_writer.sparse_displacements_count;
+	quantized_value_count += other_writer.quantized_value_count;
+}
+
+void
+FlatDataWriter::PrintSparseReport() const
+{
+	if (sparse_displacements_count == 0)
+	{
+		return;
+	}
+
+	std::cout << "Wrote " << sparse_displacements_count << " of "
+		<< (sparse_displacements_count + dense_displacements_count) << " displacement vectors sparse" << std::endl;
+}
+
+void
+FlatDataWriter::PrintQuantizeReport() const
+{
+	if (quantized_value_count == 0)
+	{
+		return;
+	}
+
+	std::cout << "Quantized to " << quantize_bits << " bits with max error of: bones " << bones_max_error
+		<< ", local displacements " << local_displacements_max_error
+		<< ", post displacements " << post_displacements_max_error << std::endl;
+}
+
+int
+FlatDataWriter::GetSampleIndex(const std::unordered_map<std::string, int>& indices_in, const char * name)
+{
+	if (format_version < 2)
+	{
+		return -1;
+	}
+
+	auto index_itr = indices_in.find(name);
+	if (index_itr == indices_in.end())
+	{
+		// Bone or region was not written before its samples, keep its name instead
+		if (!warned_missing_index)
+		{
+			std::cerr << "Warning: No skeleton bone or mesh region written for: " << name
+				<< ", animation samples will reference it by name" << std::endl;
+			warned_missing_index = true;
+		}
+
+		return -1;
+	}
+
+	return index_itr->second;
+}
+
+flatbuffers::Offset<flatbuffers::String>
+FlatDataWriter::CreateSharedString(const char * str)
+{
+	std::string key(str);
+	auto cache_itr = string_cache.find(key);
+	if (cache_itr != string_cache.end())
+	{
+		return cache_itr->second;
+	}
+
+	auto write_str = fbb.CreateString(key);
+	string_cache[key] = write_str;
+
+	return write_str;
+}
+
+flatbuffers::Offset<flatbuffers::Vector<int>>
+FlatDataWriter::WriteSortedNames(const std::vector<std::string>& names_in)
+{
+	if (format_version < 2)
+	{
+		return 0;
+	}
+
+	std::vector<int> sorted_indices(names_in.size());
+	for (size_t i = 0; i < names_in.size(); i++)
+	{
+		sorted_indices[i] = (int)i;
+	}
+
+	// std::string compares as unsigned bytes, the same order as strcmp at runtime.
+	// Stable so equal names keep the order they were written in.
+	std::stable_sort(sorted_indices.begin(), sorted_indices.end(), [&](int a, int b) {
+		return names_in[a] < names_in[b];
+	});
+
+	return fbb.CreateVector(sorted_indices);
+}
+
+// ----------- Mesh ----------------------
+
+flatbuffers::Offset<CreatureFlatData::meshRegion>
+FlatDataWriter::WriteMeshRegion(const char * region_name, rapidjson::Value& region_obj)
+{
+	// Bone Weights
+	auto& read_bone_weights = region_obj["weights"];
+	std::vector<flatbuffers::Offset<CreatureFlatData::meshRegionBone> > bone_weights_list;
+
+	for (rapidjson::Value::MemberIterator w_itr = read_bone_weights.MemberBegin();
+	w_itr != read_bone_weights.MemberEnd();
+		++w_itr)
+	{
+		CreatureFlatData::meshRegionBoneBuilder flat_mesh_region_bone(fbb);
+		auto write_name = CreateSharedString(w_itr->name.GetString());
+
+		auto& bone_weights = w_itr->value;
+		auto write_weights = fbb.CreateVector(GetFloatArray(bone_weights));
+
+		flat_mesh_region_bone.add_name(write_name);
+		flat_mesh_region_bone.add_weights(write_weights);
+
+		bone_weights_list.push_back(flat_mesh_region_bone.Finish());
+	}
+
+	CreatureFlatData::meshRegionBuilder flat_mesh_region(fbb);
+	auto write_mesh_region_name = CreateSharedString(region_name);
+	auto write_mesh_region_weights_list = fbb.CreateVector(bone_weights_list);
+
+	flat_mesh_region.add_name(write_mesh_region_name);
+	flat_mesh_region.add_start_pt_index(region_obj["start_pt_index"].GetInt());
+	flat_mesh_region.add_end_pt_index(region_obj["end_pt_index"].GetInt());
+	flat_mesh_region.add_start_index(region_obj["start_index"].GetInt());
+	flat_mesh_region.add_end_index(region_obj["end_index"].GetInt());
+	flat_mesh_region.add_id(region_obj["id"].GetInt());
+	flat_mesh_region.add_weights(write_mesh_region_weights_list);
+
+	int region_index = (int)region_indices.size();
+	region_indices[region_name] = region_index;
+	region_names.push_back(region_name);
+
+	return flat_mesh_region.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::mesh>
+FlatDataWriter::WriteMesh(rapidjson::Value& points_obj,
+	rapidjson::Value& uvs_obj,
+	rapidjson::Value& indices_obj,
+	const std::vector<flatbuffers::Offset<CreatureFlatData::meshRegion> >& regions)
+{
+	auto write_read_mesh_points = fbb.CreateVector(GetFloatArray(points_obj));
+	auto write_read_indices = fbb.CreateVector(GetIntArray(indices_obj));
+	auto write_read_uv_points = fbb.CreateVector(GetFloatArray(uvs_obj));
+	auto write_mesh_region_list = fbb.CreateVector(regions);
+	auto write_regions_by_name = WriteSortedNames(region_names);
+
+	CreatureFlatData::meshBuilder flat_mesh(fbb);
+
+	flat_mesh.add_points(write_read_mesh_points);
+	flat_mesh.add_indices(write_read_indices);
+	flat_mesh.add_uvs(write_read_uv_points);
+	flat_mesh.add_regions(write_mesh_region_list);
+	flat_mesh.add_regions_by_name(write_regions_by_name);
+
+	return flat_mesh.Finish();
+}
+
+// ----------- Skeleton -------------------
+
+flatbuffers::Offset<CreatureFlatData::skeletonBone>
+FlatDataWriter::WriteSkeletonBone(const char * bone_name, rapidjson::Value& bone_obj)
+{
+	CreatureFlatData::skeletonBoneBuilder flat_skeleton_bone(fbb);
+
+	auto write_bone_name = CreateSharedString(bone_name);
+	auto write_restParentMat = fbb.CreateVector(GetFloatArray(bone_obj["restParentMat"]));
+	auto write_localRestStartPt = fbb.CreateVector(GetFloatArray(bone_obj["localRestStartPt"]));
+	auto write_localRestEndPt = fbb.CreateVector(GetFloatArray(bone_obj["localRestEndPt"]));
+	auto write_children = fbb.CreateVector(GetIntArray(bone_obj["children"]));
+
+	flat_skeleton_bone.add_name(write_bone_name);
+	flat_skeleton_bone.add_id(bone_obj["id"].GetInt());
+	flat_skeleton_bone.add_restParentMat(write_restParentMat);
+	flat_skeleton_bone.add_localRestStartPt(write_localRestStartPt);
+	flat_skeleton_bone.add_localRestEndPt(write_localRestEndPt);
+	flat_skeleton_bone.add_children(write_children);
+
+	int bone_index = (int)bone_indices.size();
+	bone_indices[bone_name] = bone_index;
+	bone_names.push_back(bone_name);
+
+	return flat_skeleton_bone.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::skeleton>
+FlatDataWriter::WriteSkeleton(const std::vector<flatbuffers::Offset<CreatureFlatData::skeletonBone> >& bones)
+{
+	auto write_skeleton_bone_list = fbb.CreateVector(bones);
+	auto write_bones_by_name = WriteSortedNames(bone_names);
+	CreatureFlatData::skeletonBuilder flat_skeleton(fbb);
+
+	flat_skeleton.add_bones(write_skeleton_bone_list);
+	flat_skeleton.add_bones_by_name(write_bones_by_name);
+	return flat_skeleton.Finish();
+}
+
+// ----------- Animation Bones -----------------
+
+flatbuffers::Offset<CreatureFlatData::animationBone>
+FlatDataWriter::WriteAnimationBone(const char * bone_name, rapidjson::Value& bone_obj)
+{
+	CreatureFlatData::animationBoneBuilder flat_animation_bone(fbb);
+
+	int bone_index = GetSampleIndex(bone_indices, bone_name);
+	flatbuffers::Offset<flatbuffers::String> write_bone_name;
+	if (bone_index < 0)
+	{
+		write_bone_name = CreateSharedString(bone_name);
+	}
+
+	auto write_bone_start_pt = fbb.CreateVector(GetFloatArray(bone_obj["start_pt"]));
+	auto write_bone_end_pt = fbb.CreateVector(GetFloatArray(bone_obj["end_pt"]));
+
+	if (bone_index < 0)
+	{
+		flat_animation_bone.add_name(write_bone_name);
+	}
+	else
+	{
+		flat_animation_bone.add_bone_index(bone_index);
+	}
+
+	flat_animation_bone.add_start_pt(write_bone_start_pt);
+	flat_animation_bone.add_end_pt(write_bone_end_pt);
+
+	return flat_animation_bone.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationBonesTimeSample>
+FlatDataWriter::WriteAnimationBonesTimeSample(int cur_time,
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationBone> >& bones)
+{
+	auto write_animation_bone_list = fbb.CreateVector(bones);
+
+	CreatureFlatData::animationBonesTimeSampleBuilder flat_animation_bone_time_sample(fbb);
+	flat_animation_bone_time_sample.add_time(cur_time);
+	flat_animation_bone_time_sample.add_bones(write_animation_bone_list);
+
+	return flat_animation_bone_time_sample.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationBonesList>
+FlatDataWriter::WriteAnimationBonesList(
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationBonesTimeSample> >& samples)
+{
+	auto write_animation_bone_sample_list = fbb.CreateVector(samples);
+	CreatureFlatData::animationBonesListBuilder flat_animation_bone_list(fbb);
+	flat_animation_bone_list.add_timeSamples(write_animation_bone_sample_list);
+	return flat_animation_bone_list.Finish();
+}
+
+// ----------- Animation Bones Track -----------------
+
+bool
+FlatDataWriter::UseBonesTrack() const
+{
+	return dense_bone_tracks && (format_version >= 2) && !bone_indices.empty();
+}
+
+void
+FlatDataWriter::BeginBonesTrackTimeSample(int cur_time)
+{
+	size_t row_size = bone_indices.size() * 4;
+	size_t row_start = track_positions.size();
+
+	track_times.push_back(cur_time);
+	if (row_start == 0)
+	{
+		track_positions.resize(row_size, 0.0f);
+		track_animated.assign(bone_indices.size(), 0);
+	}
+	else
+	{
+		// Copied after resizing, inserting a range of the vector into itself is undefined
+		track_positions.resize(row_start + row_size);
+		std::copy_n(track_positions.data() + row_start - row_size, row_size, track_positions.data() + row_start);
+	}
+}
+
+// Reads the x, y of the point member name_in of obj_in into point_out,
+// false if it is missing or not an array starting with two numbers
+static bool
+GetPointMember(const rapidjson::Value& obj_in, const char * name_in, float * point_out)
+{
+	if (!obj_in.IsObject())
+	{
+		return false;
+	}
+
+	auto point_itr = obj_in.FindMember(name_in);
+	if ((point_itr == obj_in.MemberEnd()) || !point_itr->value.IsArray() || (point_itr->value.Size() < 2)
+		|| !point_itr->value[0].IsNumber() || !point_itr->value[1].IsNumber())
+	{
+		return false;
+	}
+
+	point_out[0] = (float)point_itr->value[0].GetDouble();
+	point_out[1] = (float)point_itr->value[1].GetDouble();
+	return true;
+}
+
+void
+FlatDataWriter::AddBonesTrackBone(const char * bone_name, rapidjson::Value& bone_obj)
+{
+	auto index_itr = bone_indices.find(bone_name);
+	if (index_itr == bone_indices.end())
+	{
+		// A track row only has room for the skeleton's bones
+		if (!warned_missing_track_bone)
+		{
+			std::cerr << "Warning: No skeleton bone written for: " << bone_name
+				<< ", its animation samples are left out of the dense bones track" << std::endl;
+			warned_missing_track_bone = true;
+		}
+
+		return;
+	}
+
+	float read_values[4];
+	if (track_times.empty() || !GetPointMember(bone_obj, "start_pt", read_values)
+		|| !GetPointMember(bone_obj, "end_pt", read_values + 2))
+	{
+		return;
+	}
+
+	size_t row_size = bone_indices.size() * 4;
+	size_t bone_index = (size_t)index_itr->second;
+	size_t last_frame = track_times.size() - 1;
+	std::copy_n(read_values, 4, &track_positions[last_frame * row_size + bone_index * 4]);
+	if (!track_animated[bone_index])
+	{
+		// Frames before the bone's first sample have nothing better to hold than its first values
+		for (size_t f = 0; f < last_frame; f++)
+		{
+			std::copy_n(read_values, 4, &track_positions[f * row_size + bone_index * 4]);
+		}
+
+		track_animated[bone_index] = 1;
+	}
+}
+
+flatbuffers::Offset<CreatureFlatData::animationBonesTrack>
+FlatDataWriter::WriteBonesTrack()
+{
+	auto write_times = fbb.CreateVector(track_times);
+	flatbuffers::Offset<flatbuffers::Vector<uint8_t>> write_animated_bones;
+	if (std::find(track_animated.begin(), track_animated.end(), 0) != track_animated.end())
+	{
+		write_animated_bones = fbb.CreateVector(track_animated);
+	}
+
+	flatbuffers::Offset<flatbuffers::Vector<float>> write_positions, write_range_min, write_range_extent;
+	flatbuffers::Offset<flatbuffers::Vector<uint16_t>> write_positions_q;
+
+	if (quantize_bits > 0)
+	{
+		// One range per channel of a frame row
+		size_t row_size = bone_indices.size() * 4;
+		std::vector<float> range_min(row_size), range_extent(row_size);
+		std::vector<uint16_t> positions_q(track_positions.size());
+		std::vector<float> channel_values(track_times.size());
+
+		for (size_t c = 0; c < row_size; c++)
+		{
+			GetRange(track_positions.data() + c, track_times.size(), row_size, range_min[c], range_extent[c]);
+
+			for (size_t f = 0; f < track_times.size(); f++)
+			{
+				channel_values[f] = track_positions[f * row_size + c];
+			}
+
+			auto channel_q = Quantize(channel_values, range_min[c], range_extent[c], bones_max_error);
+			for (size_t f = 0; f < track_times.size(); f++)
+			{
+				positions_q[f * row_size + c] = channel_q[f];
+			}
+		}
+
+		write_positions_q = fbb.CreateVector(positions_q);
+		write_range_min = fbb.CreateVector(range_min);
+		write_range_extent = fbb.CreateVector(range_extent);
+	}
+	else
+	{
+		// Only float tracks are delta encoded. The modular deltas of quantized rows are
+		// no smaller and compress worse than the quantized values themselves.
+		if (delta_interval > 0)
+		{
+			EncodeDeltaRows(track_positions.data(), track_times.size(), bone_indices.size() * 4, (size_t)delta_interval);
+		}
+
+		write_positions = fbb.CreateVector(track_positions);
+	}
+
+	CreatureFlatData::animationBonesTrackBuilder flat_animation_bones_track(fbb);
+	flat_animation_bones_track.add_times(write_times);
+	flat_animation_bones_track.add_bone_count((int)bone_indices.size());
+
+	if (quantize_bits > 0)
+	{
+		flat_animation_bones_track.add_positions_q(write_positions_q);
+		flat_animation_bones_track.add_range_min(write_range_min);
+		flat_animation_bones_track.add_range_extent(write_range_extent);
+		flat_animation_bones_track.add_quantize_bits(quantize_bits);
+	}
+	else
+	{
+		flat_animation_bones_track.add_positions(write_positions);
+		if (delta_interval > 0)
+		{
+			flat_animation_bones_track.add_delta_interval(delta_interval);
+		}
+	}
+
+	// Left out when every bone is animated
+	flat_animation_bones_track.add_animated_bones(write_animated_bones);
+
+	track_times.clear();
+	track_positions.clear();
+	track_animated.clear();
+
+	return flat_animation_bones_track.Finish();
+}
+
+// ----------- Animation Meshes -----------------
+
+// Splits values_in into the (start, count) pairs of its non zero runs and their packed values
+static void
+FindDisplacementRuns(const std::vector<float>& values_in, std::vector<int>& runs_out, std::vector<float>& packed_out)
+{
+	for (size_t i = 0; i < values_in.size(); i++)
+	{
+		if (values_in[i] == 0.0f)
+		{
+			continue;
+		}
+
+		if (runs_out.empty() || ((size_t)(runs_out[runs_out.size() - 2] + runs_out.back()) != i))
+		{
+			runs_out.push_back((int)i);
+			runs_out.push_back(0);
+		}
+
+		runs_out.back()++;
+		packed_out.push_back(values_in[i]);
+	}
+}
+
+void
+FlatDataWriter::WriteDisplacements(const std::vector<float>& values_in,
+	flatbuffers::Offset<flatbuffers::Vector<float>>& dense_out,
+	flatbuffers::Offset<flatbuffers::Vector<int>>& runs_out,
+	flatbuffers::Offset<flatbuffers::Vector<float>>& sparse_out)
+{
+	if (sparse_displacements)
+	{
+		std::vector<int> runs;
+		std::vector<float> sparse_values;
+		FindDisplacementRuns(values_in, runs, sparse_values);
+
+		// The sparse form needs one more length prefix than the dense one
+		size_t sparse_size = (runs.size() + sparse_values.size() + 1) * sizeof(float);
+		if (sparse_size < values_in.size() * sizeof(float))
+		{
+			runs_out = fbb.CreateVector(runs);
+			sparse_out = fbb.CreateVector(sparse_values);
+			sparse_displacements_count++;
+			return;
+		}
+	}
+
+	dense_out = fbb.CreateVector(values_in);
+	dense_displacements_count++;
+}
+
+void
+FlatDataWriter::WriteQuantizedDisplacements(const std::vector<float>& values_in,
+	float min_in, float extent_in, float& max_error_io,
+	flatbuffers::Offset<flatbuffers::Vector<int>>& runs_out,
+	flatbuffers::Offset<flatbuffers::Vector<uint16_t>>& quantized_out)
+{
+	if (sparse_displacements)
+	{
+		// The runs are found on the float values, so the zeros between them decode exactly
+		// instead of to the nearest step of the range
+		std::vector<int> runs;
+		std::vector<float> sparse_values;
+		FindDisplacementRuns(values_in, runs, sparse_values);
+
+		size_t sparse_size = (runs.size() + 1) * sizeof(int) + sparse_values.size() * sizeof(uint16_t);
+		if (sparse_size < values_in.size() * sizeof(uint16_t))
+		{
+			runs_out = fbb.CreateVector(runs);
+			quantized_out = fbb.CreateVector(Quantize(sparse_values, min_in, extent_in, max_error_io));
+			sparse_displacements_count++;
+			return;
+		}
+	}
+
+	quantized_out = fbb.CreateVector(Quantize(values_in, min_in, extent_in, max_error_io));
+	dense_displacements_count++;
+}
+
+bool
+FlatDataWriter::UseMeshTrack() const
+{
+	return (quantize_bits > 0) && (format_version >= 2) && !region_indices.empty();
+}
+
+void
+FlatDataWriter::BeginMeshTrackTimeSample(int cur_time)
+{
+	mesh_track_times.push_back(cur_time);
+	mesh_track_samples.push_back(std::vector<MeshTrackSample>());
+}
+
+void
+FlatDataWriter::AddMeshTrackSample(const char * mesh_name, rapidjson::Value& mesh_obj)
+{
+	if (mesh_track_samples.empty())
+	{
+		return;
+	}
+
+	MeshTrackSample new_sample;
+	new_sample.name = mesh_name;
+	new_sample.region_index = GetSampleIndex(region_indices, mesh_name);
+	new_sample.use_dq = mesh_obj["use_dq"].GetBool();
+	new_sample.use_local_displacements = mesh_obj["use_local_displacements"].GetBool();
+	new_sample.use_post_displacements = mesh_obj["use_post_displacements"].GetBool();
+	new_sample.has_local_displacements = mesh_obj.HasMember("local_displacements");
+	new_sample.has_post_displacements = mesh_obj.HasMember("post_displacements");
+
+	if (new_sample.has_local_displacements)
+	{
+		new_sample.local_displacements = GetFloatArray(mesh_obj["local_displacements"]);
+	}
+
+	if (new_sample.has_post_displacements)
+	{
+		new_sample.post_displacements = GetFloatArray(mesh_obj["post_displacements"]);
+	}
+
+	mesh_track_samples.back().push_back(new_sample);
+}
+
+flatbuffers::Offset<CreatureFlatData::animationMeshList>
+FlatDataWriter::WriteMeshTrack()
+{
+	// Per region ranges over the whole clip
+	size_t region_count = region_indices.size();
+	std::vector<float> local_min(region_count, 0.0f), local_max(region_count, 0.0f);
+	std::vector<float> post_min(region_count, 0.0f), post_max(region_count, 0.0f);
+	std::vector<bool> local_set(region_count, false), post_set(region_count, false);
+
+	for (auto& cur_samples : mesh_track_samples)
+	{
+		for (auto& cur_sample : cur_samples)
+		{
+			if (cur_sample.region_index < 0)
+			{
+				continue;
+			}
+
+			int r = cur_sample.region_index;
+			for (float cur_val : cur_sample.local_displacements)
+			{
+				local_min[r] = local_set[r] ? std::min(local_min[r], cur_val) : cur_val;
+				local_max[r] = local_set[r] ? std::max(local_max[r], cur_val) : cur_val;
+				local_set[r] = true;
+			}
+
+			for (float cur_val : cur_sample.post_displacements)
+			{
+				post_min[r] = post_set[r] ? std::min(post_min[r], cur_val) : cur_val;
+				post_max[r] = post_set[r] ? std::max(post_max[r], cur_val) : cur_val;
+				post_set[r] = true;
+			}
+		}
+	}
+
+	std::vector<float> local_extent(region_count), post_extent(region_count);
+	for (size_t r = 0; r < region_count; r++)
+	{
+		local_extent[r] = local_max[r] - local_min[r];
+		post_extent[r] = post_max[r] - post_min[r];
+	}
+
+	std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshTimeSample> > samples;
+	for (size_t f = 0; f < mesh_track_times.size(); f++)
+	{
+		std::vector<flatbuffers::Offset<CreatureFlatData::animationMesh> > meshes;
+		for (size_t m = 0; m < mesh_track_samples[f].size(); m++)
+		{
+			auto& cur_sample = mesh_track_samples[f][m];
+			int r = cur_sample.region_index;
+			flatbuffers::Offset<flatbuffers::String> write_mesh_name;
+			flatbuffers::Offset<flatbuffers::Vector<float>> write_local_displacements, write_post_displacements;
+			flatbuffers::Offset<flatbuffers::Vector<int>> write_local_runs, write_post_runs;
+			flatbuffers::Offset<flatbuffers::Vector<float>> write_local_sparse, write_post_sparse;
+			flatbuffers::Offset<flatbuffers::Vector<uint16_t>> write_local_displacements_q, write_post_displacements_q;
+
+			if (r < 0)
+			{
+				// Not indexed, so there is no range to decode with
+				write_mesh_name = CreateSharedString(cur_sample.name.c_str());
+				if (cur_sample.has_local_displacements)
+				{
+					WriteDisplacements(cur_sample.local_displacements,
+						write_local_displacements, write_local_runs, write_local_sparse);
+				}
+
+				if (cur_sample.has_post_displacements)
+				{
+					WriteDisplacements(cur_sample.post_displacements,
+						write_post_displacements, write_post_runs, write_post_sparse);
+				}
+			}
+			else
+			{
+				if (cur_sample.has_local_displacements)
+				{
+					WriteQuantizedDisplacements(cur_sample.local_displacements, local_min[r], local_extent[r],
+						local_displacements_max_error, write_local_runs, write_local_displacements_q);
+				}
+
+				if (cur_sample.has_post_displacements)
+				{
+					WriteQuantizedDisplacements(cur_sample.post_displacements, post_min[r], post_extent[r],
+						post_displacements_max_error, write_post_runs, write_post_displacements_q);
+				}
+			}
+
+			CreatureFlatData::animationMeshBuilder flat_animation_mesh(fbb);
+			if (r < 0)
+			{
+				flat_animation_mesh.add_name(write_mesh_name);
+			}
+			else
+			{
+				flat_animation_mesh.add_region_index(r);
+			}
+
+			flat_animation_mesh.add_use_dq(cur_sample.use_dq);
+			flat_animation_mesh.add_use_local_displacements(cur_sample.use_local_displacements);
+			flat_animation_mesh.add_use_post_displacements(cur_sample.use_post_displacements);
+
+			if (cur_sample.has_local_displacements)
+			{
+				if (r < 0)
+				{
+					flat_animation_mesh.add_local_displacements(write_local_displacements);
+					flat_animation_mesh.add_local_displacements_runs(write_local_runs);
+					flat_animation_mesh.add_local_displacements_sparse(write_local_sparse);
+				}
+				else
+				{
+					flat_animation_mesh.add_local_displacements_runs(write_local_runs);
+					flat_animation_mesh.add_local_displacements_q(write_local_displacements_q);
+				}
+			}
+
+			if (cur_sample.has_post_displacements)
+			{
+				if (r < 0)
+				{
+					flat_animation_mesh.add_post_displacements(write_post_displacements);
+					flat_animation_mesh.add_post_displacements_runs(write_post_runs);
+					flat_animation_mesh.add_post_displacements_sparse(write_post_sparse);
+				}
+				else
+				{
+					flat_animation_mesh.add_post_displacements_runs(write_post_runs);
+					flat_animation_mesh.add_post_displacements_q(write_post_displacements_q);
+				}
+			}
+
+			meshes.push_back(flat_animation_mesh.Finish());
+		}
+
+		samples.push_back(WriteAnimationMeshTimeSample(mesh_track_times[f], meshes));
+	}
+
+	auto write_animation_mesh_time_sample_list = fbb.CreateVector(samples);
+	auto write_local_range_min = fbb.CreateVector(local_min);
+	auto write_local_range_extent = fbb.CreateVector(local_extent);
+	auto write_post_range_min = fbb.CreateVector(post_min);
+	auto write_post_range_extent = fbb.CreateVector(post_extent);
+
+	CreatureFlatData::animationMeshListBuilder flat_animation_mesh_list(fbb);
+	flat_animation_mesh_list.add_timeSamples(write_animation_mesh_time_sample_list);
+	flat_animation_mesh_list.add_local_range_min(write_local_range_min);
+	flat_animation_mesh_list.add_local_range_extent(write_local_range_extent);
+	flat_animation_mesh_list.add_post_range_min(write_post_range_min);
+	flat_animation_mesh_list.add_post_range_extent(write_post_range_extent);
+	flat_animation_mesh_list.add_quantize_bits(quantize_bits);
+
+	mesh_track_times.clear();
+	mesh_track_samples.clear();
+
+	return flat_animation_mesh_list.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationMesh>
+FlatDataWriter::WriteAnimationMesh(const char * mesh_name, rapidjson::Value& mesh_obj)
+{
+	int region_index = GetSampleIndex(region_indices, mesh_name);
+	flatbuffers::Offset<flatbuffers::String> write_mesh_name;
+	if (region_index < 0)
+	{
+		write_mesh_name = CreateSharedString(mesh_name);
+	}
+
+	flatbuffers::Offset<flatbuffers::Vector<float>> write_local_displacements, write_post_displacements;
+	flatbuffers::Offset<flatbuffers::Vector<int>> write_local_runs, write_post_runs;
+	flatbuffers::Offset<flatbuffers::Vector<float>> write_local_sparse, write_post_sparse;
+
+	if (mesh_obj.HasMember("local_displacements"))
+	{
+		WriteDisplacements(GetFloatArray(mesh_obj["local_displacements"]),
+			write_local_displacements, write_local_runs, write_local_sparse);
+	}
+
+	if (mesh_obj.HasMember("post_displacements"))
+	{
+		WriteDisplacements(GetFloatArray(mesh_obj["post_displacements"]),
+			write_post_displacements, write_post_runs, write_post_sparse);
+	}
+
+	CreatureFlatData::animationMeshBuilder flat_animation_mesh(fbb);
+	if (region_index < 0)
+	{
+		flat_animation_mesh.add_name(write_mesh_name);
+	}
+	else
+	{
+		flat_animation_mesh.add_region_index(region_index);
+	}
+
+	flat_animation_mesh.add_use_dq(mesh_obj["use_dq"].GetBool());
+	flat_animation_mesh.add_use_local_displacements(mesh_obj["use_local_displacements"].GetBool());
+	flat_animation_mesh.add_use_post_displacements(mesh_obj["use_post_displacements"].GetBool());
+
+	if (mesh_obj.HasMember("local_displacements"))
+	{
+		flat_animation_mesh.add_local_displacements(write_local_displacements);
+		flat_animation_mesh.add_local_displacements_runs(write_local_runs);
+		flat_animation_mesh.add_local_displacements_sparse(write_local_sparse);
+	}
+
+	if (mesh_obj.HasMember("post_displacements"))
+	{
+		flat_animation_mesh.add_post_displacements(write_post_displacements);
+		flat_animation_mesh.add_post_displacements_runs(write_post_runs);
+		flat_animation_mesh.add_post_displacements_sparse(write_post_sparse);
+	}
+
+	return flat_animation_mesh.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationMeshTimeSample>
+FlatDataWriter::WriteAnimationMeshTimeSample(int cur_time,
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationMesh> >& meshes)
+{
+	auto write_animation_mesh_list = fbb.CreateVector(meshes);
+
+	CreatureFlatData::animationMeshTimeSampleBuilder flat_animation_mesh_time_sample(fbb);
+	flat_animation_mesh_time_sample.add_time(cur_time);
+	flat_animation_mesh_time_sample.add_meshes(write_animation_mesh_list);
+
+	return flat_animation_mesh_time_sample.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationMeshList>
+FlatDataWriter::WriteAnimationMeshList(
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshTimeSample> >& samples)
+{
+	auto write_animation_mesh_time_sample_list = fbb.CreateVector(samples);
+	CreatureFlatData::animationMeshListBuilder flat_animation_mesh_list(fbb);
+	flat_animation_mesh_list.add_timeSamples(write_animation_mesh_time_sample_list);
+	return flat_animation_mesh_list.Finish();
+}
+
+// ----------- Animation UV Swaps -----------------
+
+flatbuffers::Offset<CreatureFlatData::animationUVSwap>
+FlatDataWriter::WriteAnimationUVSwap(const char * uv_swap_name, rapidjson::Value& uv_swap_obj)
+{
+	int region_index = GetSampleIndex(region_indices, uv_swap_name);
+	flatbuffers::Offset<flatbuffers::String> write_uv_swap_name;
+	if (region_index < 0)
+	{
+		write_uv_swap_name = CreateSharedString(uv_swap_name);
+	}
+
+	auto write_local_offset = fbb.CreateVector(GetFloatArray(uv_swap_obj["local_offset"]));
+	auto write_global_offset = fbb.CreateVector(GetFloatArray(uv_swap_obj["global_offset"]));
+	auto write_scale = fbb.CreateVector(GetFloatArray(uv_swap_obj["scale"]));
+
+	CreatureFlatData::animationUVSwapBuilder flat_animation_uv_swap(fbb);
+	if (region_index < 0)
+	{
+		flat_animation_uv_swap.add_name(write_uv_swap_name);
+	}
+	else
+	{
+		flat_animation_uv_swap.add_region_index(region_index);
+	}
+
+	flat_animation_uv_swap.add_local_offset(write_local_offset);
+	flat_animation_uv_swap.add_global_offset(write_global_offset);
+	flat_animation_uv_swap.add_scale(write_scale);
+	flat_animation_uv_swap.add_enabled(uv_swap_obj["enabled"].GetBool());
+
+	return flat_animation_uv_swap.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationUVSwapTimeSample>
+FlatDataWriter::WriteAnimationUVSwapTimeSample(int cur_time,
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwap> >& uv_swaps)
+{
+	auto write_animation_uv_swap_list = fbb.CreateVector(uv_swaps);
+	CreatureFlatData::animationUVSwapTimeSampleBuilder flat_animation_uv_swap_time_sample(fbb);
+	flat_animation_uv_swap_time_sample.add_time(cur_time);
+	flat_animation_uv_swap_time_sample.add_uvSwaps(write_animation_uv_swap_list);
+
+	return flat_animation_uv_swap_time_sample.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationUVSwapList>
+FlatDataWriter::WriteAnimationUVSwapList(
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwapTimeSample> >& samples)
+{
+	auto write_animation_uv_swap_time_sample_list = fbb.CreateVector(samples);
+	CreatureFlatData::animationUVSwapListBuilder flat_animation_uv_swap_list(fbb);
+	flat_animation_uv_swap_list.add_timeSamples(write_animation_uv_swap_time_sample_list);
+	return flat_animation_uv_swap_list.Finish();
+}
+
+// ----------- Animation Mesh Opacities -----------------
+
+flatbuffers::Offset<CreatureFlatData::animationMeshOpacity>
+FlatDataWriter::WriteAnimationMeshOpacity(const char * mesh_opacity_name, rapidjson::Value& mesh_opacity_obj)
+{
+	int region_index = GetSampleIndex(region_indices, mesh_opacity_name);
+	flatbuffers::Offset<flatbuffers::String> write_mesh_opacity_name;
+	if (region_index < 0)
+	{
+		write_mesh_opacity_name = CreateSharedString(mesh_opacity_name);
+	}
+
+	CreatureFlatData::animationMeshOpacityBuilder flat_animation_mesh_opacity(fbb);
+	if (region_index < 0)
+	{
+		flat_animation_mesh_opacity.add_name(write_mesh_opacity_name);
+	}
+	else
+	{
+		flat_animation_mesh_opacity.add_region_index(region_index);
+	}
+
+	flat_animation_mesh_opacity.add_opacity((float)mesh_opacity_obj["opacity"].GetDouble());
+
+	return flat_animation_mesh_opacity.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationMeshOpacityTimeSample>
+FlatDataWriter::WriteAnimationMeshOpacityTimeSample(int cur_time,
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacity> >& mesh_opacities)
+{
+	auto write_animation_mesh_opacity_list = fbb.CreateVector(mesh_opacities);
+	CreatureFlatData::animationMeshOpacityTimeSampleBuilder flat_animation_opacity_time_sample(fbb);
+	flat_animation_opacity_time_sample.add_time(cur_time);
+	flat_animation_opacity_time_sample.add_meshOpacities(write_animation_mesh_opacity_list);
+
+	return flat_animation_opacity_time_sample.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationMeshOpacityList>
+FlatDataWriter::WriteAnimationMeshOpacityList(
+	const std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacityTimeSample> >& samples)
+{
+	auto write_animation_mesh_opacity_time_sample_list = fbb.CreateVector(samples);
+	CreatureFlatData::animationMeshOpacityListBuilder flat_animation_mesh_opacity_list(fbb);
+	flat_animation_mesh_opacity_list.add_timeSamples(write_animation_mesh_opacity_time_sample_list);
+	return flat_animation_mesh_opacity_list.Finish();
+}
+
+// ----------- Animation Clips -----------------
+
+flatbuffers::Offset<CreatureFlatData::animationClip>
+FlatDataWriter::WriteAnimationClip(const char * anim_name,
+	flatbuffers::Offset<CreatureFlatData::animationBonesList> bones,
+	flatbuffers::Offset<CreatureFlatData::animationMeshList> meshes,
+	flatbuffers::Offset<CreatureFlatData::animationUVSwapList> uv_swaps,
+	flatbuffers::Offset<CreatureFlatData::animationMeshOpacityList> mesh_opacities,
+	flatbuffers::Offset<CreatureFlatData::animationBonesTrack> bones_track)
+{
+	auto write_anim_name = CreateSharedString(anim_name);
+	clip_names.push_back(anim_name);
+
+	CreatureFlatData::animationClipBuilder flat_animation_clip(fbb);
+	flat_animation_clip.add_name(write_anim_name);
+	flat_animation_clip.add_bones(bones);
+	flat_animation_clip.add_meshes(meshes);
+	flat_animation_clip.add_uvSwaps(uv_swaps);
+	flat_animation_clip.add_meshOpacities(mesh_opacities);
+	flat_animation_clip.add_bonesTrack(bones_track);
+
+	return flat_animation_clip.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::animationClip>
+FlatDataWriter::SpliceAnimationClip(const char * anim_name,
+	const flatbuffers::FlatBufferBuilder& clip_fbb,
+	flatbuffers::Offset<CreatureFlatData::animationClip> clip_loc)
+{
+	clip_names.push_back(anim_name);
+
+	// Offsets inside the clip are relative, so its bytes stay valid anywhere in fbb
+	// as long as they keep their alignment from the end of the buffer. Nothing in
+	// the schema needs more than 8 byte alignment.
+	fbb.Align(8);
+	fbb.PushBytes(clip_fbb.GetBufferPointer(), clip_fbb.GetSize());
+
+	return flatbuffers::Offset<CreatureFlatData::animationClip>(fbb.GetSize() - clip_fbb.GetSize() + clip_loc.o);
+}
+
+flatbuffers::Offset<CreatureFlatData::animation>
+FlatDataWriter::WriteAnimation(const std::vector<flatbuffers::Offset<CreatureFlatData::animationClip> >& clips)
+{
+	auto write_animation_clip_list = fbb.CreateVector(clips);
+	auto write_clips_by_name = WriteSortedNames(clip_names);
+	CreatureFlatData::animationBuilder flat_animation(fbb);
+	flat_animation.add_clips(write_animation_clip_list);
+	flat_animation.add_clips_by_name(write_clips_by_name);
+	return flat_animation.Finish();
+}
+
+// ----------- UV Swap Items -----------------
+
+flatbuffers::Offset<CreatureFlatData::uvSwapItemMesh>
+FlatDataWriter::WriteUVSwapItemMesh(const char * mesh_name, rapidjson::Value& mesh_data)
+{
+	std::vector<flatbuffers::Offset<CreatureFlatData::uvSwapItemData>> item_list;
+
+	for (int i = 0; i < mesh_data.Size(); i++)
+	{
+		CreatureFlatData::uvSwapItemDataBuilder flat_uv_swap_item_data(fbb);
+
+		auto& m_obj = mesh_data[i];
+		auto write_local_offset = fbb.CreateVector(GetFloatArray(m_obj["local_offset"]));
+		auto write_global_offset = fbb.CreateVector(GetFloatArray(m_obj["global_offset"]));
+		auto write_scale = fbb.CreateVector(GetFloatArray(m_obj["scale"]));
+
+		flat_uv_swap_item_data.add_local_offset(write_local_offset);
+		flat_uv_swap_item_data.add_global_offset(write_global_offset);
+		flat_uv_swap_item_data.add_scale(write_scale);
+		flat_uv_swap_item_data.add_tag(m_obj["tag"].GetInt());
+
+		item_list.push_back(flat_uv_swap_item_data.Finish());
+	}
+
+	auto write_mesh_name = CreateSharedString(mesh_name);
+	auto write_item_list = fbb.CreateVector(item_list);
+	uv_swap_mesh_names.push_back(mesh_name);
+
+
+	CreatureFlatData::uvSwapItemMeshBuilder flat_uv_swap_item_mesh(fbb);
+	flat_uv_swap_item_mesh.add_name(write_mesh_name);
+	flat_uv_swap_item_mesh.add_items(write_item_list);
+
+	return flat_uv_swap_item_mesh.Finish();
+}
+
+flatbuffers::Offset<CreatureFlatData::uvSwapItemHolder>
+FlatDataWriter::WriteUVSwapItemHolder(const std::vector<flatbuffers::Offset<CreatureFlatData::uvSwapItemMesh> >& item_meshes)
+{
+	auto write_item_meshes = fbb.CreateVector(item_meshes);
+	auto write_meshes_by_name = WriteSortedNames(uv_swap_mesh_names);
+	CreatureFlatData::uvSwapItemHolderBuilder flat_uv_swap_item_holder(fbb);
+	flat_uv_swap_item_holder.add_meshes(write_item_meshes);
+	flat_uv_swap_item_holder.add_meshes_by_name(write_meshes_by_name);
+	return flat_uv_swap_item_holder.Finish();
+}
+
+// ----------- Anchor Points -----------------
+
+flatbuffers::Offset<CreatureFlatData::anchorPointsHolder>
+FlatDataWriter::WriteAnchorPointsHolder(rapidjson::Value& anchor_points_obj)
+{
+	std::vector<flatbuffers::Offset<CreatureFlatData::anchorPointData>> anchor_list;
+	std::vector<std::string> anchor_clip_names;
+	for (int i = 0; i < anchor_points_obj.Size(); i++)
+	{
+		CreatureFlatData::anchorPointDataBuilder flat_anchor_point_data_builder(fbb);
+
+		auto& anchor_obj = anchor_points_obj[i];
+		auto write_point = fbb.CreateVector(GetFloatArray(anchor_obj["point"]));
+		auto write_anim_clip_name = CreateSharedString(anchor_obj["anim_clip_name"].GetString());
+		anchor_clip_names.push_back(anchor_obj["anim_clip_name"].GetString());
+
+		flat_anchor_point_data_builder.add_point(write_point);
+		flat_anchor_point_data_builder.add_anim_clip_name(write_anim_clip_name);
+
+		anchor_list.push_back(flat_anchor_point_data_builder.Finish());
+	}
+
+	auto write_anchor_list = fbb.CreateVector(anchor_list);
+	auto write_anchor_points_by_clip_name = WriteSortedNames(anchor_clip_names);
+	CreatureFlatData::anchorPointsHolderBuilder flat_anchor_point_holder_builder(fbb);
+	flat_anchor_point_holder_builder.add_anchorPoints(write_anchor_list);
+	flat_anchor_point_holder_builder.add_anchorPoints_by_clip_name(write_anchor_points_by_clip_name);
+	return flat_anchor_point_holder_builder.Finish();
+}
+
+// ------- Root Data -------------- //
+
+void
+FlatDataWriter::WriteRoot(flatbuffers::Offset<CreatureFlatData::mesh> mesh_loc,
+	flatbuffers::Offset<CreatureFlatData::skeleton> skeleton_loc,
+	flatbuffers::Offset<CreatureFlatData::animation> animation_loc,
+	flatbuffers::Offset<CreatureFlatData::uvSwapItemHolder> uv_swap_loc,
+	flatbuffers::Offset<CreatureFlatData::anchorPointsHolder> anchor_loc)
+{
+	CreatureFlatData::rootDataBuilder flat_root(fbb);
+	flat_root.add_dataSkeleton(skeleton_loc);
+	flat_root.add_dataMesh(mesh_loc);
+	flat_root.add_dataAnimation(animation_loc);
+	flat_root.add_dataUvSwapItem(uv_swap_loc);
+	flat_root.add_dataAnchorPoints(anchor_loc);
+	flat_root.add_version(format_version);
+
+	auto flat_root_loc = flat_root.Finish();
+
+	CreatureFlatData::FinishrootDataBuffer(fbb, flat_root_loc);
+}
+
+// ---- Serialize to Disk ------------- //
+
+bool WriteFlatDataFile(flatbuffers::FlatBufferBuilder& fbb,
+	const std::string& flat_filename_out,
+	bool verbose)
+{
+	remove(flat_filename_out.c_str());
+	std::ofstream ofile(flat_filename_out.c_str(), std::ios::binary);
+	if (!ofile)
+	{
+		std::cerr << "Error: Could not write Flat Binary File: " << flat_filename_out << std::endl;
+		return false;
+	}
+
+	ofile.write((char *)fbb.GetBufferPointer(), fbb.GetSize());
+	ofile.close();
+
+	if (verbose)
+	{
+		std::cout << "Serialized Flat Binary File to: " << flat_filename_out << " with file size of: " << fbb.GetSize() << " bytes." << std::endl;
+	}
+
+	return true;
+}
+
+// Chunks start on this alignment within the container, above anything the schema needs
+static const size_t container_chunk_align = 16;
+
+static size_t
+AlignContainerOffset(size_t offset_in)
+{
+	return (offset_in + container_chunk_align - 1) & ~(container_chunk_align - 1);
+}
+
+bool WriteFlatDataContainer(flatbuffers::FlatBufferBuilder& base_fbb,
+	const std::vector<std::string>& clip_names,
+	const std::vector<std::unique_ptr<flatbuffers::FlatBufferBuilder> >& clip_fbbs,
+	const std::string& container_filename_out,
+	bool compress_clips,
+	bool verbose)
+{
+	std::vector<int> sorted_indices(clip_names.size());
+	for (size_t i = 0; i < clip_names.size(); i++)
+	{
+		sorted_indices[i] = (int)i;
+	}
+
+	std::stable_sort(sorted_indices.begin(), sorted_indices.end(), [&](int a, int b) {
+		return clip_names[a] < clip_names[b];
+	});
+
+	// Bytes written for each chunk, the base first, and the compressed clips they point into
+	size_t chunk_count = clip_fbbs.size() + 1;
+	std::vector<const uint8_t *> chunk_data(chunk_count);
+	std::vector<size_t> chunk_sizes(chunk_count), chunk_compressed_sizes(chunk_count, 0);
+	std::vector<std::vector<uint8_t> > compressed_clips(compress_clips ? clip_fbbs.size() : 0);
+	size_t clips_size = 0, clips_written_size = 0;
+	for (size_t i = 0; i < chunk_count; i++)
+	{
+		flatbuffers::FlatBufferBuilder& chunk_fbb = (i == 0) ? base_fbb : *clip_fbbs[i - 1];
+		chunk_data[i] = chunk_fbb.GetBufferPointer();
+		chunk_sizes[i] = chunk_fbb.GetSize();
+		if ((i > 0) && compress_clips)
+		{
+			std::vector<uint8_t>& cur_compressed = compressed_clips[i - 1];
+			cur_compressed = CompressFlatDataBlocks(chunk_data[i], chunk_sizes[i]);
+			if (cur_compressed.size() < chunk_sizes[i])
+			{
+				chunk_data[i] = cur_compressed.data();
+				chunk_compressed_sizes[i] = cur_compressed.size();
+			}
+		}
+
+		if (i > 0)
+		{
+			clips_size += chunk_sizes[i];
+			clips_written_size += chunk_compressed_sizes[i] ? chunk_compressed_sizes[i] : chunk_sizes[i];
+		}
+	}
+
+	// The chunk offsets are written into the directory, which comes before the chunks,
+	// so the directory is rebuilt until the offsets it was built with match its size
+	flatbuffers::FlatBufferBuilder directory_fbb;
+	std::vector<size_t> chunk_offsets(chunk_count, 0);
+	size_t header_size = 8, chunks_start = AlignContainerOffset(header_size);
+	for (;;)
+	{
+		size_t write_offset = chunks_start;
+		for (size_t i = 0; i < chunk_count; i++)
+		{
+			chunk_offsets[i] = write_offset;
+			write_offset = AlignContainerOffset(write_offset
+				+ (chunk_compressed_sizes[i] ? chunk_compressed_sizes[i] : chunk_sizes[i]));
+		}
+
+		directory_fbb.Clear();
+		std::vector<flatbuffers::Offset<CreatureFlatData::clipChunk> > clip_chunks;
+		for (size_t i = 1; i < chunk_count; i++)
+		{
+			clip_chunks.push_back(CreatureFlatData::CreateclipChunk(directory_fbb,
+				directory_fbb.CreateString(clip_names[i - 1].c_str()),
+				(uint32_t)chunk_offsets[i], (uint32_t)chunk_sizes[i], (uint32_t)chunk_compressed_sizes[i]));
+		}
+
+		auto base_chunk = CreatureFlatData::CreateclipChunk(directory_fbb, 0,
+			(uint32_t)chunk_offsets[0], (uint32_t)chunk_sizes[0]);
+		auto write_clips = directory_fbb.CreateVector(clip_chunks);
+		auto write_clips_by_name = directory_fbb.CreateVector(sorted_indices);
+		directory_fbb.Finish(CreatureFlatData::CreateclipDirectory(directory_fbb, base_chunk,
+			write_clips, write_clips_by_name));
+
+		size_t needed_start = AlignContainerOffset(header_size + directory_fbb.GetSize());
+		if (needed_start == chunks_start)
+		{
+			break;
+		}
+
+		chunks_start = needed_start;
+	}
+
+	// The directory holds offsets and sizes as uint32, so the container, whose end is past
+	// every offset, and every chunk before compression have to fit in one
+	size_t last_chunk = chunk_count - 1;
+	size_t container_size = chunk_offsets[last_chunk]
+		+ (chunk_compressed_sizes[last_chunk] ? chunk_compressed_sizes[last_chunk] : chunk_sizes[last_chunk]);
+	bool fits_directory = (container_size <= UINT32_MAX);
+	for (size_t i = 0; i < chunk_count; i++)
+	{
+		fits_directory &= (chunk_sizes[i] <= UINT32_MAX);
+	}
+
+	if (!fits_directory)
+	{
+		std::cerr << "Error: Flat Binary Container is too large for its 32 bit directory: " << container_filename_out << std::endl;
+		return false;
+	}
+
+	remove(container_filename_out.c_str());
+	std::ofstream ofile(container_filename_out.c_str(), std::ios::binary);
+	if (!ofile)
+	{
+		std::cerr << "Error: Could not write Flat Binary File: " << container_filename_out << std::endl;
+		return false;
+	}
+
+	uint8_t header[8] = { 'C', 'R', 'F', 'C' };
+	flatbuffers::WriteScalar<uint32_t>(header + 4, (uint32_t)directory_fbb.GetSize());
+	ofile.write((const char *)header, sizeof(header));
+	ofile.write((const char *)directory_fbb.GetBufferPointer(), directory_fbb.GetSize());
+
+	size_t write_offset = header_size + directory_fbb.GetSize();
+	const char padding[container_chunk_align] = {};
+	for (size_t i = 0; i < chunk_count; i++)
+	{
+		size_t write_size = chunk_compressed_sizes[i] ? chunk_compressed_sizes[i] : chunk_sizes[i];
+		ofile.write(padding, chunk_offsets[i] - write_offset);
+		ofile.write((const char *)chunk_data[i], write_size);
+		write_offset = chunk_offsets[i] + write_size;
+	}
+
+	ofile.close();
+	if (!ofile)
+	{
+		std::cerr << "Error: Could not write Flat Binary File: " << container_filename_out << std::endl;
+		return false;
+	}
+
+	if (verbose)
+	{
+		std::cout << "Serialized Flat Binary Container to: " << container_filename_out << " with file size of: "
+			<< write_offset << " bytes, a " << base_fbb.GetSize() << " byte base and "
+			<< clip_fbbs.size() << " clip chunks." << std::endl;
+		if (compress_clips)
+		{
+			std::cout << "Compressed clip chunks from " << clips_size << " to " << clips_written_size << " bytes ("
+				<< (clips_size > 0 ? (double)clips_written_size / (double)clips_size : 0.0) << "x)." << std::endl;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,257 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <rapidjson/rapidjson.h>
+#include <rapidjson/document.h>
+#include <CreatureFlatData_generated.h>
+#include <flatbuffers.h>
+#include <ConvertFlatData.h>
+
+// Writes the tables of a Creature FlatData file from parsed Creature JSON values.
+// Shared by the DOM and streaming conversion engines so both emit the same layout.
+// In format version 2 animation samples reference their bone or mesh region by
+// its index in the skeleton or mesh tables, so those must be written first.
+class FlatDataWriter
+{
+public:
+	FlatDataWriter(flatbuffers::FlatBufferBuilder& fbb_in,
+		const ConvertFlatDataOptions& options_in = ConvertFlatDataOptions());
+
+	// Writes into fbb_in with the bone and region indices already written by indices_writer,
+	// so animation clips can be built apart from the skeleton and mesh they reference
+	FlatDataWriter(flatbuffers::FlatBufferBuilder& fbb_in,
+		const ConvertFlatDataOptions& options_in,
+		const FlatDataWriter& indices_writer);
+
+	// Mesh
+	flatbuffers::Offset<CreatureFlatData::meshRegion>
+	WriteMeshRegion(const char * region_name, rapidjson::Value& region_obj);
+
+	flatbuffers::Offset<CreatureFlatData::mesh>
+	WriteMesh(rapidjson::Value& points_obj,
+		rapidjson::Value& uvs_obj,
+		rapidjson::Value& indices_obj,
+		const std::vector<flatbuffers::Offset<CreatureFlatData::meshRegion> >& regions);
+
+	// Skeleton
+	flatbuffers::Offset<CreatureFlatData::skeletonBone>
+	WriteSkeletonBone(const char * bone_name, rapidjson::Value& bone_obj);
+
+	flatbuffers::Offset<CreatureFlatData::skeleton>
+	WriteSkeleton(const std::vector<flatbuffers::Offset<CreatureFlatData::skeletonBone> >& bones);
+
+	// Animation Bones
+	flatbuffers::Offset<CreatureFlatData::animationBone>
+	WriteAnimationBone(const char * bone_name, rapidjson::Value& bone_obj);
+
+	flatbuffers::Offset<CreatureFlatData::animationBonesTimeSample>
+	WriteAnimationBonesTimeSample(int cur_time,
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationBone> >& bones);
+
+	flatbuffers::Offset<CreatureFlatData::animationBonesList>
+	WriteAnimationBonesList(
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationBonesTimeSample> >& samples);
+
+	// Animation Bones Track
+	// Returns true if the bones of the next clip should be written as a dense track
+	bool UseBonesTrack() const;
+
+	// Starts a new frame of the track, holding the previous frame's bone positions
+	void BeginBonesTrackTimeSample(int cur_time);
+
+	// Writes a bone's sample into the current frame. Bones missing from the skeleton and
+	// samples without numeric start_pt and end_pt points are left out.
+	void AddBonesTrackBone(const char * bone_name, rapidjson::Value& bone_obj);
+
+	flatbuffers::Offset<CreatureFlatData::animationBonesTrack>
+	WriteBonesTrack();
+
+	// Animation Meshes
+	// Returns true if the meshes of the next clip should be buffered with
+	// BeginMeshTrackTimeSample/AddMeshTrackSample and written with WriteMeshTrack,
+	// which quantizes the displacements against the ranges of the whole clip.
+	bool UseMeshTrack() const;
+
+	void BeginMeshTrackTimeSample(int cur_time);
+
+	void AddMeshTrackSample(const char * mesh_name, rapidjson::Value& mesh_obj);
+
+	flatbuffers::Offset<CreatureFlatData::animationMeshList>
+	WriteMeshTrack();
+
+	flatbuffers::Offset<CreatureFlatData::animationMesh>
+	WriteAnimationMesh(const char * mesh_name, rapidjson::Value& mesh_obj);
+
+	flatbuffers::Offset<CreatureFlatData::animationMeshTimeSample>
+	WriteAnimationMeshTimeSample(int cur_time,
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationMesh> >& meshes);
+
+	flatbuffers::Offset<CreatureFlatData::animationMeshList>
+	WriteAnimationMeshList(
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshTimeSample> >& samples);
+
+	// Animation UV Swaps
+	flatbuffers::Offset<CreatureFlatData::animationUVSwap>
+	WriteAnimationUVSwap(const char * uv_swap_name, rapidjson::Value& uv_swap_obj);
+
+	flatbuffers::Offset<CreatureFlatData::animationUVSwapTimeSample>
+	WriteAnimationUVSwapTimeSample(int cur_time,
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwap> >& uv_swaps);
+
+	flatbuffers::Offset<CreatureFlatData::animationUVSwapList>
+	WriteAnimationUVSwapList(
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationUVSwapTimeSample> >& samples);
+
+	// Animation Mesh Opacities
+	flatbuffers::Offset<CreatureFlatData::animationMeshOpacity>
+	WriteAnimationMeshOpacity(const char * mesh_opacity_name, rapidjson::Value& mesh_opacity_obj);
+
+	flatbuffers::Offset<CreatureFlatData::animationMeshOpacityTimeSample>
+	WriteAnimationMeshOpacityTimeSample(int cur_time,
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacity> >& mesh_opacities);
+
+	flatbuffers::Offset<CreatureFlatData::animationMeshOpacityList>
+	WriteAnimationMeshOpacityList(
+		const std::vector<flatbuffers::Offset<CreatureFlatData::animationMeshOpacityTimeSample> >& samples);
+
+	// Animation Clips
+	flatbuffers::Offset<CreatureFlatData::animationClip>
+	WriteAnimationClip(const char * anim_name,
+		flatbuffers::Offset<CreatureFlatData::animationBonesList> bones,
+		flatbuffers::Offset<CreatureFlatData::animationMeshList> meshes,
+		flatbuffers::Offset<CreatureFlatData::animationUVSwapList> uv_swaps,
+		flatbuffers::Offset<CreatureFlatData::animationMeshOpacityList> mesh_opacities,
+		flatbuffers::Offset<CreatureFlatData::animationBonesTrack> bones_track = 0);
+
+	// Copies an animation clip built into clip_fbb, with nothing else in it, into
+	// this writer's builder and returns its offset there
+	flatbuffers::Offset<CreatureFlatData::animationClip>
+	SpliceAnimationClip(const char * anim_name,
+		const flatbuffers::FlatBufferBuilder& clip_fbb,
+		flatbuffers::Offset<CreatureFlatData::animationClip> clip_loc);
+
+	flatbuffers::Offset<CreatureFlatData::animation>
+	WriteAnimation(const std::vector<flatbuffers::Offset<CreatureFlatData::animationClip> >& clips);
+
+	// UV Swap Items
+	flatbuffers::Offset<CreatureFlatData::uvSwapItemMesh>
+	WriteUVSwapItemMesh(const char * mesh_name, rapidjson::Value& mesh_data);
+
+	flatbuffers::Offset<CreatureFlatData::uvSwapItemHolder>
+	WriteUVSwapItemHolder(const std::vector<flatbuffers::Offset<CreatureFlatData::uvSwapItemMesh> >& item_meshes);
+
+	// Anchor Points
+	flatbuffers::Offset<CreatureFlatData::anchorPointsHolder>
+	WriteAnchorPointsHolder(rapidjson::Value& anchor_points_obj);
+
+	// Root Data
+	void
+	WriteRoot(flatbuffers::Offset<CreatureFlatData::mesh> mesh_loc,
+		flatbuffers::Offset<CreatureFlatData::skeleton> skeleton_loc,
+		flatbuffers::Offset<CreatureFlatData::animation> animation_loc,
+		flatbuffers::Offset<CreatureFlatData::uvSwapItemHolder> uv_swap_loc,
+		flatbuffers::Offset<CreatureFlatData::anchorPointsHolder> anchor_loc);
+
+	// Prints the largest error introduced by quantization, or nothing if no values were quantized
+	void PrintQuantizeReport() const;
+
+	// Prints how many displacement vectors were written sparse
+	void PrintSparseReport() const;
+
+	// Adds the quantization errors and sparse counts of other_writer to the reports of this one
+	void MergeStats(const FlatDataWriter& other_writer);
+
+	// Returns the offset of a string with the contents of str, writing it
+	// only the first time those contents are seen
+	flatbuffers::Offset<flatbuffers::String>
+	CreateSharedString(const char * str);
+
+private:
+	// Returns the index an animation sample should reference name by,
+	// or -1 if the sample has to be keyed by its name instead
+	int GetSampleIndex(const std::unordered_map<std::string, int>& indices_in, const char * name);
+
+	// Writes a displacements vector as dense_out, or as runs_out and sparse_out if that is smaller
+	void WriteDisplacements(const std::vector<float>& values_in,
+		flatbuffers::Offset<flatbuffers::Vector<float>>& dense_out,
+		flatbuffers::Offset<flatbuffers::Vector<int>>& runs_out,
+		flatbuffers::Offset<flatbuffers::Vector<float>>& sparse_out);
+
+	// Writes a displacements vector quantized against the range min_in, extent_in as quantized_out,
+	// or only its non zero runs if that is smaller, with their (start, count) pairs in runs_out
+	void WriteQuantizedDisplacements(const std::vector<float>& values_in,
+		float min_in, float extent_in, float& max_error_io,
+		flatbuffers::Offset<flatbuffers::Vector<int>>& runs_out,
+		flatbuffers::Offset<flatbuffers::Vector<uint16_t>>& quantized_out);
+
+	// A buffered animation mesh sample of the clip being written
+	struct MeshTrackSample
+	{
+		std::string name;
+		int region_index;
+		bool use_dq, use_local_displacements, use_post_displacements;
+		bool has_local_displacements, has_post_displacements;
+		std::vector<float> local_displacements, post_displacements;
+	};
+
+	// Writes the indices of names_in sorted by the bytes of the names, or nothing before format version 2
+	flatbuffers::Offset<flatbuffers::Vector<int>> WriteSortedNames(const std::vector<std::string>& names_in);
+
+	// Quantizes values_in against the range min_in, extent_in, keeping the largest error in max_error_io
+	std::vector<uint16_t> Quantize(const std::vector<float>& values_in,
+		float min_in, float extent_in, float& max_error_io);
+
+	flatbuffers::FlatBufferBuilder& fbb;
+	int format_version;
+	bool dense_bone_tracks;
+	int quantize_bits;
+	int delta_interval;
+	bool sparse_displacements;
+	bool warned_missing_index, warned_missing_track_bone;
+	std::unordered_map<std::string, int> bone_indices, region_indices;
+
+	// Names of the bones, regions, clips and uv swap item meshes written, in order
+	std::vector<std::string> bone_names, region_names, clip_names, uv_swap_mesh_names;
+
+	// Bones track of the clip being written
+	std::vector<int> track_times;
+	std::vector<float> track_positions;
+
+	// 1 for each skeleton bone the clip being written has sampled so far
+	std::vector<uint8_t> track_animated;
+
+	// Mesh samples of the clip being written
+	std::vector<int> mesh_track_times;
+	std::vector<std::vector<MeshTrackSample> > mesh_track_samples;
+
+	// Displacement vectors written in each form
+	int dense_displacements_count, sparse_displacements_count;
+
+	// Values quantized and the largest quantization errors
+	size_t quantized_value_count;
+	float bones_max_error, local_displacements_max_error, post_displacements_max_error;
+	std::unordered_map<std::string, flatbuffers::Offset<flatbuffers::String> > string_cache;
+};
+
+// Reads the whole Creature JSON File with a single read into buffer_out,
+// zero terminated so it can be parsed in place
+bool ReadCreatureJsonBuffer(const std::string& filename_in,
+	std::vector<char>& buffer_out);
+
+// Writes the finished contents of fbb out to a Creature FlatData Binary file
+bool WriteFlatDataFile(flatbuffers::FlatBufferBuilder& fbb,
+	const std::string& flat_filename_out,
+	bool verbose = true);
+
+// Writes a clip container, laid out as described in CreatureFlatData.fbs, of the
+// finished rootData buffers of base_fbb and clip_fbbs, clip_fbbs[i] holding the clip
+// named clip_names[i]. With compress_clips each clip chunk that shrinks is stored compressed.
+bool WriteFlatDataContainer(flatbuffers::FlatBufferBuilder& base_fbb,
+	const std::vector<std::string>& clip_names,
+	const std::vector<std::unique_ptr<flatbuffers::FlatBufferBuilder> >& clip_fbbs,
+	const std::string& container_filename_out,
+	bool compress_clips = false,
+	bool verbose = true);
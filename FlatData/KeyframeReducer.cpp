@@ -0,0 +1,245 @@
+#include <iostream>
+#include <cmath>
+#include <KeyframeReducer.h>
+
+float
+GetKeyframeReduceTolerance(const ConvertFlatDataOptions& options_in, KeyframeSection section_in)
+{
+	switch (section_in)
+	{
+	case KEYFRAME_BONES:
+		return options_in.reduce_bones_tolerance;
+	case KEYFRAME_MESHES:
+		return options_in.reduce_meshes_tolerance;
+	case KEYFRAME_UV_SWAPS:
+		return options_in.reduce_uv_swaps_tolerance;
+	case KEYFRAME_MESH_OPACITIES:
+		return options_in.reduce_mesh_opacities_tolerance;
+	default:
+		break;
+	}
+
+	return -1.0f;
+}
+
+bool
+UseKeyframeReduce(const ConvertFlatDataOptions& options_in)
+{
+	for (int i = 0; i < KEYFRAME_SECTION_COUNT; i++)
+	{
+		if (GetKeyframeReduceTolerance(options_in, (KeyframeSection)i) >= 0.0f)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+KeyframeReduceStats::KeyframeReduceStats()
+{
+	for (int i = 0; i < KEYFRAME_SECTION_COUNT; i++)
+	{
+		kept[i] = 0;
+		dropped[i] = 0;
+	}
+}
+
+void
+KeyframeReduceStats::Add(const KeyframeReduceStats& other_stats)
+{
+	for (int i = 0; i < KEYFRAME_SECTION_COUNT; i++)
+	{
+		kept[i] += other_stats.kept[i];
+		dropped[i] += other_stats.dropped[i];
+	}
+}
+
+void
+KeyframeReduceStats::Print() const
+{
+	static const char * section_names[KEYFRAME_SECTION_COUNT] = {
+		"bones", "meshes", "uv swaps", "mesh opacities"
+	};
+
+	std::cout << "Keyframe reduction kept/dropped:";
+	for (int i = 0; i < KEYFRAME_SECTION_COUNT; i++)
+	{
+		std::cout << (i > 0 ? ", " : " ") << section_names[i] << " " << kept[i] << "/" << dropped[i];
+	}
+
+	std::cout << std::endl;
+}
+
+KeyframeReducer::KeyframeReducer(float tolerance_in, KeyframeSection section_in)
+	: tolerance(tolerance_in),
+	hold(section_in == KEYFRAME_UV_SWAPS),
+	has_kept(false)
+{
+}
+
+void
+KeyframeReducer::Flatten(const rapidjson::Value& value_in, Frame& frame_out)
+{
+	if (value_in.IsObject())
+	{
+		frame_out.signature += '{';
+		for (rapidjson::Value::ConstMemberIterator itr = value_in.MemberBegin();
+		itr != value_in.MemberEnd();
+			++itr)
+		{
+			frame_out.signature.append(itr->name.GetString(), itr->name.GetStringLength());
+			frame_out.signature += ':';
+			Flatten(itr->value, frame_out);
+		}
+		frame_out.signature += '}';
+	}
+	else if (value_in.IsArray())
+	{
+		frame_out.signature += '[';
+		frame_out.signature += std::to_string(value_in.Size());
+		for (rapidjson::SizeType i = 0; i < value_in.Size(); i++)
+		{
+			Flatten(value_in[i], frame_out);
+		}
+		frame_out.signature += ']';
+	}
+	else if (value_in.IsNumber())
+	{
+		frame_out.signature += '#';
+		frame_out.channels.push_back((float)value_in.GetDouble());
+	}
+	else if (value_in.IsBool())
+	{
+		frame_out.signature += value_in.GetBool() ? 't' : 'f';
+	}
+	else if (value_in.IsString())
+	{
+		frame_out.signature += '"';
+		frame_out.signature.append(value_in.GetString(), value_in.GetStringLength());
+		frame_out.signature += '"';
+	}
+	else
+	{
+		frame_out.signature += 'n';
+	}
+}
+
+bool
+KeyframeReducer::CanInterpolate(const Frame& start_in, const Frame& end_in, const Frame& frame_in) const
+{
+	if ((frame_in.signature != start_in.signature) || (frame_in.signature != end_in.signature))
+	{
+		return false;
+	}
+
+	float time_span = (float)(end_in.time - start_in.time);
+	float alpha = (time_span != 0.0f) ? (float)(frame_in.time - start_in.time) / time_span : 0.0f;
+
+	for (size_t i = 0; i < frame_in.channels.size(); i++)
+	{
+		float lerp_val = start_in.channels[i] + (end_in.channels[i] - start_in.channels[i]) * alpha;
+		if (std::fabs(lerp_val - frame_in.channels[i]) > tolerance)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool
+KeyframeReducer::CanHold(const Frame& kept_in, const Frame& frame_in) const
+{
+	if (frame_in.signature != kept_in.signature)
+	{
+		return false;
+	}
+
+	for (size_t i = 0; i < frame_in.channels.size(); i++)
+	{
+		if (std::fabs(kept_in.channels[i] - frame_in.channels[i]) > tolerance)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void
+KeyframeReducer::AddFrame(int cur_time, const rapidjson::Value& frame_obj)
+{
+	Frame new_frame;
+	new_frame.time = cur_time;
+	Flatten(frame_obj, new_frame);
+
+	if (!has_kept)
+	{
+		// The first frame is always kept
+		last_kept = new_frame;
+		has_kept = true;
+		decisions.push_back(true);
+		return;
+	}
+
+	if (hold)
+	{
+		if (!CanHold(last_kept, new_frame))
+		{
+			// The pending frames all hold the last kept one, the new frame starts the next hold
+			for (size_t i = 0; i < pending.size(); i++)
+			{
+				decisions.push_back(false);
+			}
+
+			decisions.push_back(true);
+			last_kept = new_frame;
+			pending.clear();
+			return;
+		}
+
+		pending.push_back(new_frame);
+		return;
+	}
+
+	bool can_extend = true;
+	for (size_t i = 0; can_extend && (i < pending.size()); i++)
+	{
+		can_extend = CanInterpolate(last_kept, new_frame, pending[i]);
+	}
+
+	if (!can_extend)
+	{
+		// The newest pending frame ends the segment that interpolates all the ones before it
+		for (size_t i = 0; i + 1 < pending.size(); i++)
+		{
+			decisions.push_back(false);
+		}
+
+		decisions.push_back(true);
+		last_kept = pending.back();
+		pending.clear();
+	}
+
+	pending.push_back(new_frame);
+}
+
+void
+KeyframeReducer::Finish()
+{
+	if (pending.empty())
+	{
+		return;
+	}
+
+	// The last frame is always kept
+	for (size_t i = 0; i + 1 < pending.size(); i++)
+	{
+		decisions.push_back(false);
+	}
+
+	decisions.push_back(true);
+	last_kept = pending.back();
+	pending.clear();
+}
@@ -0,0 +1,83 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <rapidjson/rapidjson.h>
+#include <rapidjson/document.h>
+#include <ConvertFlatData.h>
+
+// Animation sections a clip's time samples are reduced in
+enum KeyframeSection
+{
+	KEYFRAME_BONES,
+	KEYFRAME_MESHES,
+	KEYFRAME_UV_SWAPS,
+	KEYFRAME_MESH_OPACITIES,
+	KEYFRAME_SECTION_COUNT
+};
+
+// Returns the reduction tolerance options set for section_in, negative if disabled
+float GetKeyframeReduceTolerance(const ConvertFlatDataOptions& options_in, KeyframeSection section_in);
+
+// Returns true if options_in reduce any section
+bool UseKeyframeReduce(const ConvertFlatDataOptions& options_in);
+
+// Counts of the time samples kept and dropped by keyframe reduction
+struct KeyframeReduceStats
+{
+	KeyframeReduceStats();
+
+	void Print() const;
+
+	void Add(const KeyframeReduceStats& other_stats);
+
+	int kept[KEYFRAME_SECTION_COUNT];
+	int dropped[KEYFRAME_SECTION_COUNT];
+};
+
+// Decides which time samples of one section of a clip can be dropped because
+// linear interpolation between the neighbouring kept samples reproduces every
+// number in them within the tolerance. UV swaps are held rather than interpolated
+// by the sampler, so their samples are only dropped if the last kept one matches
+// them within the tolerance. Samples whose non numeric contents (names, flags,
+// array sizes) differ are never interpolated across or held.
+// Frames are added in order and decided greedily as soon as possible, so only
+// the frames since the last kept one need to be held by the caller.
+class KeyframeReducer
+{
+public:
+	KeyframeReducer(float tolerance_in, KeyframeSection section_in);
+
+	// Adds the next time sample of the section
+	void AddFrame(int cur_time, const rapidjson::Value& frame_obj);
+
+	// Decides the frames still pending once the section has ended
+	void Finish();
+
+	// Decisions for the added frames in the order they were added,
+	// true if the frame is kept. Callers pop them from the front.
+	std::deque<bool> decisions;
+
+private:
+	struct Frame
+	{
+		int time;
+		std::string signature;
+		std::vector<float> channels;
+	};
+
+	static void Flatten(const rapidjson::Value& value_in, Frame& frame_out);
+
+	// Returns true if frame_in is within tolerance of the interpolation of start_in and end_in
+	bool CanInterpolate(const Frame& start_in, const Frame& end_in, const Frame& frame_in) const;
+
+	// Returns true if frame_in is within tolerance of kept_in held until its time
+	bool CanHold(const Frame& kept_in, const Frame& frame_in) const;
+
+	float tolerance;
+	bool hold;
+	bool has_kept;
+	Frame last_kept;
+	std::vector<Frame> pending;
+};
@@ -0,0 +1,143 @@
+#include <WorkStealingPool.h>
+
+WorkStealingPool::WorkStealingPool(int thread_count)
+	: queued_count(0), unfinished_count(0), next_queue(0), sleeping_count(0),
+	stopping(false)
+{
+	if (thread_count <= 0)
+	{
+		thread_count = (int)std::thread::hardware_concurrency();
+		if (thread_count <= 0)
+		{
+			thread_count = 1;
+		}
+	}
+
+	for (int i = 0; i < thread_count; i++)
+	{
+		queues.push_back(std::unique_ptr<WorkerQueue>(new WorkerQueue));
+	}
+
+	for (int i = 0; i < thread_count; i++)
+	{
+		threads.push_back(std::thread(&WorkStealingPool::WorkerLoop, this, (size_t)i));
+	}
+}
+
+WorkStealingPool::~WorkStealingPool()
+{
+	Wait();
+
+	{
+		std::lock_guard<std::mutex> state_guard(state_lock);
+		stopping = true;
+	}
+
+	work_ready.notify_all();
+	for (auto& cur_thread : threads)
+	{
+		cur_thread.join();
+	}
+}
+
+void
+WorkStealingPool::Submit(const std::function<void()>& task)
+{
+	unfinished_count++;
+
+	{
+		// Counted under the queue lock so queued_count never trails the queues
+		WorkerQueue& submit_queue = *queues[next_queue++ % queues.size()];
+		std::lock_guard<std::mutex> queue_guard(submit_queue.lock);
+		submit_queue.tasks.push_back(task);
+		queued_count++;
+	}
+
+	// A worker counts itself sleeping before it checks queued_count under state_lock, so
+	// either it sees the task or this sees it and waits for it to be asleep before waking it
+	if (sleeping_count > 0)
+	{
+		{
+			std::lock_guard<std::mutex> state_guard(state_lock);
+		}
+
+		work_ready.notify_one();
+	}
+}
+
+void
+WorkStealingPool::Wait()
+{
+	std::unique_lock<std::mutex> state_guard(state_lock);
+	work_done.wait(state_guard, [this]() { return unfinished_count == 0; });
+}
+
+int
+WorkStealingPool::GetThreadCount() const
+{
+	return (int)threads.size();
+}
+
+bool
+WorkStealingPool::TryGetTask(size_t worker_index, std::function<void()>& task_out)
+{
+	// Newest task of our own queue first
+	{
+		WorkerQueue& own_queue = *queues[worker_index];
+		std::lock_guard<std::mutex> queue_guard(own_queue.lock);
+		if (!own_queue.tasks.empty())
+		{
+			task_out = std::move(own_queue.tasks.back());
+			own_queue.tasks.pop_back();
+			queued_count--;
+			return true;
+		}
+	}
+
+	// Then steal the oldest task of another queue
+	for (size_t i = 1; i < queues.size(); i++)
+	{
+		WorkerQueue& other_queue = *queues[(worker_index + i) % queues.size()];
+		std::lock_guard<std::mutex> queue_guard(other_queue.lock);
+		if (!other_queue.tasks.empty())
+		{
+			task_out = std::move(other_queue.tasks.front());
+			other_queue.tasks.pop_front();
+			queued_count--;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void
+WorkStealingPool::WorkerLoop(size_t worker_index)
+{
+	while (true)
+	{
+		std::function<void()> cur_task;
+		if (!TryGetTask(worker_index, cur_task))
+		{
+			// Sleep until a task is queued, rather than spin while another worker takes the last one
+			std::unique_lock<std::mutex> state_guard(state_lock);
+			sleeping_count++;
+			work_ready.wait(state_guard, [this]() { return (queued_count > 0) || stopping; });
+			sleeping_count--;
+			if (queued_count == 0)
+			{
+				return;
+			}
+
+			continue;
+		}
+
+		cur_task();
+
+		if (--unfinished_count == 0)
+		{
+			std::lock_guard<std::mutex> state_guard(state_lock);
+			work_done.notify_all();
+		}
+	}
+}
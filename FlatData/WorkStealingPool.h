@@ -0,0 +1,51 @@
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <memory>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+
+// A fixed set of worker threads, each with its own task queue. Workers run the newest
+// task of their own queue and steal the oldest task of another queue when theirs is empty,
+// so uneven tasks (clips or files of very different sizes) keep every core busy.
+class WorkStealingPool
+{
+public:
+	// A thread_count of 0 uses one thread per hardware core
+	WorkStealingPool(int thread_count = 0);
+
+	// Waits for the submitted tasks to finish before stopping the workers
+	~WorkStealingPool();
+
+	void Submit(const std::function<void()>& task);
+
+	// Blocks until every submitted task has finished
+	void Wait();
+
+	int GetThreadCount() const;
+
+private:
+	struct WorkerQueue
+	{
+		std::mutex lock;
+		std::deque<std::function<void()> > tasks;
+	};
+
+	bool TryGetTask(size_t worker_index, std::function<void()>& task_out);
+
+	void WorkerLoop(size_t worker_index);
+
+	std::vector<std::unique_ptr<WorkerQueue> > queues;
+	std::vector<std::thread> threads;
+
+	// The counts change under the queue locks only, state_lock is taken just to sleep and
+	// to wake sleeping workers or waiters
+	std::atomic<size_t> queued_count, unfinished_count, next_queue, sleeping_count;
+	std::mutex state_lock;
+	std::condition_variable work_ready, work_done;
+	bool stopping;
+};
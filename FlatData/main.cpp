@@ -9,22 +9,261 @@
 #include <iostream>
 #include <fstream>
 #include <cstdio>
+#include <cstdlib>
 #include <string>
 #include <vector>
 #include <ConvertFlatData.h>
+#include <BatchConvert.h>
+#include <ConvertCache.h>
+#include <BakeFlatData.h>
+#include <ConvertProfile.h>
 
 
 int main(int argc, const char * argv[]) {    
-    if(argc != 3)
+    bool batch_mode = (argc >= 2) && (std::string(argv[1]) == "-batch");
+    if(argc < 3)
     {
-        std::cerr<<"Runtime arguments: <Input JSON File> <Output FBB File>"<<std::endl;
+        std::cerr<<"Runtime arguments: <Input JSON File> <Output FBB File> [Options]"<<std::endl;
+        std::cerr<<"               or: -batch <Manifest File or Input Directory> [Output Directory] [Options]"<<std::endl;
+        std::cerr<<"Options:"<<std::endl;
+        std::cerr<<"  -insitu    Read the input with a single read and parse it in place"<<std::endl;
+        std::cerr<<"  -stream    Convert with the streaming SAX engine instead of a full DOM"<<std::endl;
+        std::cerr<<"  -dense     Write bone keyframes as one dense float track per clip"<<std::endl;
+        std::cerr<<"  -quantize <bits>  Write bone positions and displacements as fixed point values of 2 to 16 bits"<<std::endl;
+        std::cerr<<"  -delta <interval>  Delta encode consecutive float bone keyframes, keeping every interval-th one whole."<<std::endl;
+        std::cerr<<"             No smaller on its own, only more compressible with -compress. Ignored with -quantize,"<<std::endl;
+        std::cerr<<"             whose deltas would compress worse than the quantized values and undo sparse displacements"<<std::endl;
+        std::cerr<<"  -reduce <tolerance>  Drop keyframes that interpolation reproduces within the tolerance"<<std::endl;
+        std::cerr<<"  -reduce-bones, -reduce-meshes, -reduce-uvswaps, -reduce-opacities <tolerance>"<<std::endl;
+        std::cerr<<"             Set the keyframe reduction tolerance of one animation section"<<std::endl;
+        std::cerr<<"  -no-sparse Always write dense displacement vectors"<<std::endl;
+        std::cerr<<"  -parallel  Convert the animation clips in parallel, one thread per core"<<std::endl;
+        std::cerr<<"  -threads <count>  Convert the animation clips in parallel on count threads,"<<std::endl;
+        std::cerr<<"             or with -batch convert count files at the same time"<<std::endl;
+        std::cerr<<"  -cache <directory>  Copy unchanged inputs from a conversion cache instead of converting them"<<std::endl;
+        std::cerr<<"  -memory <MB>  With -batch, cap the estimated memory of the conversions running at the same time"<<std::endl;
+        std::cerr<<"  -v1        Write the legacy version 1 layout with name keyed animation samples"<<std::endl;
+        std::cerr<<"  -split     Write a clip container of a base chunk and one chunk per clip, loadable per clip"<<std::endl;
+        std::cerr<<"  -compress  Write a -split clip container with each clip chunk block compressed"<<std::endl;
+        std::cerr<<"  -bake <Baked FBB File>  Also write every clip frame skinned and quantized for playback"<<std::endl;
+        std::cerr<<"             without a skeleton, skinning on the -threads count of threads"<<std::endl;
+        std::cerr<<"  -profile <Report JSON File>  Write the wall time and allocations of each conversion stage"<<std::endl;
         return 0;
     }
     
-    // testing
-    std::string src_filename(argv[1]);
-    std::string dst_filename(argv[2]);
-    ConvertToFlatData(src_filename, dst_filename);
+    std::string src_filename(argv[batch_mode ? 2 : 1]);
+    std::string dst_filename;
+    int options_start = 3;
+    if(!batch_mode)
+    {
+        dst_filename = argv[2];
+    }
+    else if((argc > 3) && (argv[3][0] != '-'))
+    {
+        dst_filename = argv[3];
+        options_start = 4;
+    }
+
+    std::string bake_filename;
+    std::string profile_filename;
+    BatchConvertOptions batch_options;
+    ConvertFlatDataOptions& options = batch_options.convert_options;
+    for(int i = options_start; i < argc; i++)
+    {
+        std::string cur_arg(argv[i]);
+        if(cur_arg == "-insitu")
+        {
+            options.parse_insitu = true;
+        }
+        else if(cur_arg == "-stream")
+        {
+            options.stream_parse = true;
+        }
+        else if(cur_arg == "-dense")
+        {
+            options.dense_bone_tracks = true;
+        }
+        else if((cur_arg == "-quantize") && (i + 1 < argc))
+        {
+            options.quantize_bits = atoi(argv[++i]);
+            if((options.quantize_bits < 2) || (options.quantize_bits > 16))
+            {
+                std::cerr<<"Quantize bits must be between 2 and 16"<<std::endl;
+                return 1;
+            }
+        }
+        else if((cur_arg == "-delta") && (i + 1 < argc))
+        {
+            options.delta_interval = atoi(argv[++i]);
+            if(options.delta_interval < 1)
+            {
+                std::cerr<<"Delta interval must be at least 1"<<std::endl;
+                return 1;
+            }
+        }
+        else if((cur_arg == "-reduce") && (i + 1 < argc))
+        {
+            float tolerance = (float)atof(argv[++i]);
+            options.reduce_bones_tolerance = tolerance;
+            options.reduce_meshes_tolerance = tolerance;
+            options.reduce_uv_swaps_tolerance = tolerance;
+            options.reduce_mesh_opacities_tolerance = tolerance;
+        }
+        else if((cur_arg == "-reduce-bones") && (i + 1 < argc))
+        {
+            options.reduce_bones_tolerance = (float)atof(argv[++i]);
+        }
+        else if((cur_arg == "-reduce-meshes") && (i + 1 < argc))
+        {
+            options.reduce_meshes_tolerance = (float)atof(argv[++i]);
+        }
+        else if((cur_arg == "-reduce-uvswaps") && (i + 1 < argc))
+        {
+            options.reduce_uv_swaps_tolerance = (float)atof(argv[++i]);
+        }
+        else if((cur_arg == "-reduce-opacities") && (i + 1 < argc))
+        {
+            options.reduce_mesh_opacities_tolerance = (float)atof(argv[++i]);
+        }
+        else if(cur_arg == "-no-sparse")
+        {
+            options.sparse_displacements = false;
+        }
+        else if(cur_arg == "-parallel")
+        {
+            options.parallel_clips = true;
+        }
+        else if((cur_arg == "-threads") && (i + 1 < argc))
+        {
+            options.parallel_clips = true;
+            options.thread_count = atoi(argv[++i]);
+            batch_options.thread_count = options.thread_count;
+        }
+        else if((cur_arg == "-cache") && (i + 1 < argc))
+        {
+            batch_options.cache_dir = argv[++i];
+        }
+        else if((cur_arg == "-memory") && (i + 1 < argc))
+        {
+            batch_options.memory_limit_mb = atoi(argv[++i]);
+        }
+        else if(cur_arg == "-v1")
+        {
+            options.format_version = 1;
+        }
+        else if(cur_arg == "-split")
+        {
+            options.split_clips = true;
+        }
+        else if(cur_arg == "-compress")
+        {
+            options.split_clips = true;
+            options.compress_clips = true;
+        }
+        else if((cur_arg == "-bake") && (i + 1 < argc))
+        {
+            bake_filename = argv[++i];
+        }
+        else if((cur_arg == "-profile") && (i + 1 < argc))
+        {
+            profile_filename = argv[++i];
+        }
+        else
+        {
+            std::cerr<<"Unknown option: "<<cur_arg<<std::endl;
+            return 1;
+        }
+    }
+
+    if(batch_mode && !bake_filename.empty())
+    {
+        std::cerr<<"Baking is not supported with -batch"<<std::endl;
+        return 1;
+    }
+
+    if(batch_mode && !profile_filename.empty())
+    {
+        std::cerr<<"Profiling is not supported with -batch"<<std::endl;
+        return 1;
+    }
+
+    ConvertProfile convert_profile;
+    if(!profile_filename.empty())
+    {
+        options.profile = &convert_profile;
+        if(!ConvertProfile::CountsAllocations())
+        {
+            std::cerr<<"Warning: ConvertProfileNewHook.cpp is not linked in, the profile will not count allocations"<<std::endl;
+        }
+    }
+
+    if((options.format_version < 2)
+        && (options.dense_bone_tracks || (options.quantize_bits > 0) || (options.delta_interval > 0)))
+    {
+        std::cerr<<"-dense, -quantize and -delta can not be used with -v1"<<std::endl;
+        return 1;
+    }
+
+    if((options.delta_interval > 0) && (options.quantize_bits > 0))
+    {
+        std::cerr<<"Warning: -delta does not apply to -quantize output, its keyframes are written without deltas"<<std::endl;
+    }
+
+    if(options.split_clips && (options.stream_parse || !bake_filename.empty()))
+    {
+        std::cerr<<"-split and -compress can not be used with -stream or -bake"<<std::endl;
+        return 1;
+    }
+
+    if(batch_mode)
+    {
+        // A directory opens as a stream but fails to read a line from it
+        std::vector<BatchConvertEntry> entries;
+        std::ifstream manifest_file(src_filename.c_str());
+        std::string first_line;
+        bool is_manifest = manifest_file && std::getline(manifest_file, first_line);
+        manifest_file.close();
+
+        bool read_ok = is_manifest ?
+            ReadBatchManifest(src_filename, dst_filename, entries) :
+            ReadBatchDirectory(src_filename, dst_filename, entries);
+        if(!read_ok)
+        {
+            return 1;
+        }
+
+        return BatchConvertToFlatData(entries, batch_options) ? 0 : 1;
+    }
+
+    if(!batch_options.cache_dir.empty())
+    {
+        ConvertCache convert_cache(batch_options.cache_dir);
+        bool cache_hit = false;
+        bool success = convert_cache.Convert(src_filename, dst_filename, options, cache_hit);
+        convert_cache.PrintStats();
+        if(!profile_filename.empty() && !convert_profile.WriteJsonReport(profile_filename, src_filename, dst_filename))
+        {
+            std::cerr<<"Error: Could not write profile report: "<<profile_filename<<std::endl;
+        }
+
+        if(success && !bake_filename.empty())
+        {
+            success = BakeFlatDataFile(dst_filename, bake_filename, options.thread_count);
+        }
+
+        return success ? 0 : 1;
+    }
+
+    bool success = ConvertToFlatData(src_filename, dst_filename, options);
+    if(!profile_filename.empty() && !convert_profile.WriteJsonReport(profile_filename, src_filename, dst_filename))
+    {
+        std::cerr<<"Error: Could not write profile report: "<<profile_filename<<std::endl;
+    }
+
+    if(success && !bake_filename.empty())
+    {
+        success = BakeFlatDataFile(dst_filename, bake_filename, options.thread_count);
+    }
 
-    return 0;
+    return success ? 0 : 1;
 }